@@ -1,6 +1,17 @@
 #pragma once
 #include "vex.h"
 #include "pid.h"
+#include "looptimer.h"
+#include "odom.h"
+#include "sensors.h"
+#include "profile.h"
+#include "path.h"
+#include "trajectory.h"
+#include "motionhandle.h"
+#include "motion.h"
+#include "telemetry.h"
+#include <atomic>
+#include <functional>
 
 class chassis{
 private:
@@ -9,22 +20,45 @@ private:
     vex::motor_group* Left;
     vex::motor_group* Right;
 
-    vex::encoder* VerticalEncoder;
-    vex::rotation* VerticalRotation;
+    SensorHub* Sensors;
 
-    vex::inertial* Inertial;
+    /* ---------- Odometry ---------- */
+    odom* Odom;
 
     /* ---------- Functions ---------- */
-    std::function<std::vector<float>()> getRobotPosition;
-
     float restrain(float num, float min, float max);
     float clamp(float num, float min, float max);
     float radToDeg(float rad);
+    float trackedDistance(const SensorFrame &frame);
+    float circleIntersection(PathPoint start, PathPoint end, float x, float y, float radius);
+    float moveTo(float x, float y, float heading, bool useHeading, bool reverse, float timeout, float lead, float exitSpeed);
+    bool isCancelled();
+
+    struct Chain{
+        bool active = false;
+        float exitDistance = 0;
+        float exitAngle = 0;
+        float minSpeed = 0;
+        float leftoverDistance = 0;     // left undone by a chained drive before this motion
+        float leftoverRotation = 0;     // left undone by a chained turn, swing or arc, clockwise
+    };
+    Chain takeChain();
+    float carry(float output, float direction, const Chain &chain);
+    void endMotion(const Chain &chain, LoopTimer &loop);
+    void trackSpeed(const SensorFrame &frame);
+    static int runMotion(void* arg);
+
+    template<class Sensor, class Error, class Mixer>
+    float motionLoop(float amount, float timeout, const PIDConstants &constants, const ProfileConstants &profileConstants, Mixer &mixer);
+    float driveMotion(float distance, float timeout, float heading, const PIDConstants &constants, float headingKp);
+    float rotateMotion(motion::SideMixer mixer, float amount, bool absolute, float timeout, const PIDConstants &constants, const ProfileConstants &profileConstants);
+    float turnMotion(float amount, bool absolute, float timeout, const PIDConstants &constants);
+    float swingMotion(vex::turnType direction, float amount, bool absolute, float timeout, const PIDConstants &constants);
+    float arcMotion(vex::turnType direction, float radius, float amount, bool absolute, float timeout, const PIDConstants &constants);
 
     /* ---------- Data ---------- */
     enum verticalTracking{
-        rotation,
-        encoder,
+        trackingWheel,
         motorEncoder
     };
 
@@ -32,64 +66,93 @@ private:
     float trackWidth;
     float degreesToInches;
 
-    /* ---------- PID Constants ---------- */
-    struct {
-        float Kp = 0;
-        float Ki = 0;
-        float Kd = 0;
-        float integralTolerance = 0;
-        float settleTolerance = 0;
-        float settleTime = 0;
-        float minOutput = 0;
-        float maxOutput = 0;
+    uint32_t loopPeriod = 10;
+    LoopStats motionStats;
+    TelemetryRing* telemetry = 0;
 
+    /* ---------- PID Constants ---------- */
+    struct : PIDConstants {
         float headingKp = 0;
     }driveConstants;
+    PIDConstants turnConstants;
+    PIDConstants swingConstants;
+    PIDConstants arcConstants;
+
+    /* ---------- Motion Profiles ---------- */
+    MotionProfile profile;
+
+    ProfileConstants driveProfileConstants;
+    ProfileConstants turnProfileConstants;
 
+    /* ---------- Pose Constants ---------- */
     struct {
-        float Kp = 0;
-        float Ki = 0;
-        float Kd = 0;
-        float integralTolerance = 0;
-        float settleTolerance = 0;
-        float settleTime = 0;
-        float minOutput = 0;
-        float maxOutput = 0;
-    }turnConstants;
+        float lead = 0.6;
+        float closeDistance = 6;
+    }poseConstants;
 
+    /* ---------- RAMSETE Constants ---------- */
     struct {
+        float b = 2;
+        float zeta = 0.7;
+        float kS = 0;
+        float kV = 0;
+        float kA = 0;
+        float turnKV = 0;
+        float turnKA = 0;
+    }ramseteConstants;
+
+    /* ---------- Path Constants ---------- */
+    struct {
+        float lookahead = 0;
         float Kp = 0;
-        float Ki = 0;
-        float Kd = 0;
-        float integralTolerance = 0;
         float settleTolerance = 0;
-        float settleTime = 0;
-        float minOutput = 0;
         float maxOutput = 0;
-    }swingConstants;
+    }pathConstants;
 
+    /* ---------- Chaining ---------- */
     struct {
-        float Kp = 0;
-        float Ki = 0;
-        float Kd = 0;
-        float integralTolerance = 0;
-        float settleTolerance = 0;
-        float settleTime = 0;
-        float minOutput = 0;
-        float maxOutput = 0;
-    }arcConstants;
+        float exitDistance = 3;
+        float exitAngle = 10;
+        float minSpeed = 4;
+    }chainConstants;
+
+    Chain nextChain;                // set by chain(), taken by the next motion
+    bool carried = false;           // the last motion was chained and left the robot moving
+    SensorFrame speedFrame;
+    float measuredSpeed = 0;        // forward, in inches per second
+
+    /* ---------- Async Motions ---------- */
+    friend class MotionHandle;
+    vex::thread motionTask;
+    std::function<float()> asyncMotion;
+    std::atomic<uint32_t> startedMotion;    // number of the newest async motion
+    std::atomic<uint32_t> finishedMotion;   // number of the newest async motion to return
+    std::atomic<uint32_t> cancelledMotion;  // number of the newest async motion cancelled
+    float motionTime = 0;
+    float motionStartDistance = 0;
 
 public:
     /* --------- Constructor ---------- */
-    chassis(std::function<std::vector<float>()> getRobotPosition, vex::motor_group* Left, vex::motor_group* Right, vex::inertial* Inertial, float trackWidth, float degreesToInches);
-    chassis(std::function<std::vector<float>()> getRobotPosition, vex::motor_group* Left, vex::motor_group* Right, vex::inertial* Inertial, vex::encoder* VerticalEncoder, float trackWidth, float degreesToInches);
-    chassis(std::function<std::vector<float>()> getRobotPosition, vex::motor_group* Left, vex::motor_group* Right, vex::inertial* Inertial, vex::rotation* VerticalRotation, float trackWidth, float degreesToInches);
+    chassis(odom* Odom, SensorHub* Sensors, vex::motor_group* Left, vex::motor_group* Right, float trackWidth, float degreesToInches);
 
     /* ---------- Tune PIDs ---------- */
     void setDriveConstants(float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput, float headingKp = 0);
     void setTurnConstants(float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput);
     void setSwingConstants(float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput);
     void setArcConstants(float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput);
+    void setPoseConstants(float lead, float closeDistance);
+    void setPathConstants(float lookahead, float Kp, float settleTolerance, float maxOutput);
+    void setRamseteConstants(float b, float zeta, float kS, float kV, float kA, float turnKV, float turnKA);
+    void setChainConstants(float exitDistance, float exitAngle, float minSpeed);
+
+    /* ---------- Motion Profiles ---------- */
+    void setDriveProfile(float maxVelocity, float maxAcceleration, float maxJerk, float kS, float kV, float kA);
+    void setTurnProfile(float maxVelocity, float maxAcceleration, float maxJerk, float kS, float kV, float kA);
+
+    /* ---------- Timing ---------- */
+    void setLoopPeriod(uint32_t milliseconds);
+    LoopStats getMotionStats();
+    void setTelemetry(TelemetryRing* telemetry);
 
     /* ---------- Drive ---------- */
     float driveFor(float distance);
@@ -106,6 +169,12 @@ public:
     float driveTo(float x, float y, float driveTimeout, float turnTimeout);
     float driveToReverse(float x, float y);
     float driveToReverse(float x, float y, float driveTimeout, float turnTimeout);
+    float driveToPose(float x, float y, float heading);
+    float driveToPose(float x, float y, float heading, float timeout);
+    float driveToPose(float x, float y, float heading, float timeout, float lead, float exitSpeed);
+    float driveToPoseReverse(float x, float y, float heading);
+    float driveToPoseReverse(float x, float y, float heading, float timeout);
+    float driveToPoseReverse(float x, float y, float heading, float timeout, float lead, float exitSpeed);
 
     /* ---------- Turn ---------- */
     float turnFor(float degrees);
@@ -145,4 +214,32 @@ public:
 
     void setArcSpeed(vex::turnType direction, float radius, float speed, vex::velocityUnits unit);
     void setArcSpeed(vex::turnType direction, float radius, float speed, vex::voltageUnits unit);
+
+    /* ---------- Path ---------- */
+    float followPath(Path &path);
+    float followPath(Path &path, float timeout);
+    float followPath(Path &path, float timeout, bool reverse);
+    float followPath(Path &path, float timeout, bool reverse, float lookahead, float Kp, float settleTolerance, float maxOutput);
+
+    /* ---------- Trajectory ---------- */
+    float followTrajectory(const Trajectory &trajectory);
+    float followTrajectory(const Trajectory &trajectory, float b, float zeta);
+
+    /* ---------- Chaining ---------- */
+    chassis& chain();
+    chassis& chain(float exitDistance, float exitAngle, float minSpeed);
+
+    /* ---------- Async ---------- */
+    MotionHandle async(std::function<float()> motion);
+    MotionHandle driveForAsync(float distance);
+    MotionHandle driveForAsync(float distance, float timeout);
+    MotionHandle driveForAsync(float distance, float timeout, float heading);
+    MotionHandle turnToAsync(float heading);
+    MotionHandle turnToAsync(float heading, float timeout);
+    MotionHandle swingToAsync(vex::turnType direction, float heading);
+    MotionHandle swingToAsync(vex::turnType direction, float heading, float timeout);
+    MotionHandle arcToAsync(vex::turnType direction, float radius, float heading);
+    MotionHandle arcToAsync(vex::turnType direction, float radius, float heading, float timeout);
+    MotionHandle driveToAsync(float x, float y);
+    MotionHandle driveToAsync(float x, float y, float driveTimeout, float turnTimeout);
 };
\ No newline at end of file
@@ -0,0 +1,77 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       ekf.h                                                     */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Extended Kalman Filter pose estimator header              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "vex.h"
+#include "pose.h"
+#include "sensors.h"
+
+/**
+ * Tuning of the filter
+ * Noise values are standard deviations, distances are in inches and angles in radians
+ */
+struct EKFSettings{
+    float acceleration = 150;           // forward, per second squared
+    float lateralAcceleration = 40;     // sideways, only from contact or skidding
+    float angularAcceleration = 15;     // per second squared
+    float trackingWheel = 1.5;          // tracking wheel velocity, per second
+    float driveEncoder = 4;             // drive motor velocity, per second
+    float gyroRate = 0.03;              // per second
+    float heading = 0.005;
+    float lateralVelocity = 2;          // sideways speed assumed without a horizontal wheel, per second
+    float gate = 3;                     // drive encoder readings further than this many deviations away are rejected
+    int relockFrames = 25;              // accept drive encoders again after this many rejected frames in a row
+};
+
+class PoseEKF{
+    /* ---------- State ---------- */
+    // position, heading (radians clockwise from +y), forward and rightward velocity, clockwise yaw rate
+    enum{ X, Y, THETA, V, U, OMEGA, N };
+
+    float state[N];
+    float covariance[N][N];
+
+    SensorFrame previous;
+    bool initialized = false;
+    int rejectedInARow = 0;
+    uint32_t rejected = 0;
+
+    /* ---------- Geometry ---------- */
+    bool hasVertical = false;
+    bool hasHorizontal = false;
+    bool hasDrive = false;
+    float verticalDistanceFromCenter = 0;
+    float horizontalDistanceFromCenter = 0;
+    float verticalInchesPerDegree = 0;
+    float horizontalInchesPerDegree = 0;
+    float driveInchesPerDegree = 0;
+    float trackWidth = 0;
+
+    EKFSettings settings;
+
+    /* ---------- Functions ---------- */
+    void predict(float dt);
+    bool correct(int i, float a, int j, float b, float innovation, float variance, bool gated);
+
+public:
+    PoseEKF();
+
+    void setVerticalTracking(float verticalDistanceFromCenter, float verticalInchesPerDegree);
+    void setHorizontalTracking(float horizontalDistanceFromCenter, float horizontalInchesPerDegree);
+    void setDrive(float driveInchesPerDegree, float trackWidth);
+    void setSettings(const EKFSettings &settings);
+
+    void reset(float x, float y, float heading);
+    void update(const SensorFrame &frame);
+
+    Pose getPose();
+    float getVelocity();
+    float getPositionVariance();
+    float getHeadingVariance();
+    uint32_t getRejectedCount();
+};
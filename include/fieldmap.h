@@ -0,0 +1,65 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       fieldmap.h                                                */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Live field map of the odom pose and its trail header      */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "vex.h"
+#include <atomic>
+#include "grapher.h"
+#include "odom.h"
+
+/**
+ * Draws the field, where odom thinks the robot is and where it has been
+ * The field is 144 inches square with the origin in the middle, the tiles are
+ * drawn as a grid, the pose is a triangle pointing along the heading and the
+ * trail keeps a point every trailSpacing inches. Each frame erases the old
+ * marker by drawing its box of the map again, adds the new trail lines and draws
+ * the marker, nothing else. Near the edge of the field the marker is moved back
+ * inside the outline so its box is always erased. The pose comes from odom's seqlock snapshot, so
+ * drawing never holds up the odometry loop.
+ */
+class FieldMap{
+public:
+    static const int fieldInches = 144;
+
+private:
+    vex::brain::lcd* Brain_Screen;
+    odom* tracker;
+    Graph graph;
+    PlotStream trail;
+
+    float trailSpacing = 1;
+    float markerInches = 6;     // from the center of the marker to its tip
+    int outlineThickness = 2;
+    int inside[4];              // left, top, right and bottom pixels inside the outline
+    vex::color markerColor;
+
+    Pose trailEnd;              // pose of the newest trail point
+    bool hasTrail = false;
+    int markerBox[4];           // left, top, right and bottom pixels of the marker on the screen
+    bool hasMarker = false;
+    uint32_t poseSequence = 0;
+
+    vex::thread task;
+    std::atomic<bool> isRunning;
+    uint32_t framePeriod = 50;
+    uint32_t frames = 0;
+
+    void drawMarker(const Pose& pose);
+    static int run(void* arg);
+
+public:
+    FieldMap(vex::brain::lcd* Brain_Screen, odom* tracker);
+
+    void setArea(int minX, int maxX, int minY, int maxY);
+    void setTrailSpacing(float inches);
+
+    bool update();
+    void start(int framesPerSecond);
+    void stop();
+    uint32_t getFrames();
+};
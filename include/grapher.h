@@ -8,6 +8,11 @@
 /*----------------------------------------------------------------------------*/
 #pragma once
 #include "vex.h"
+#include <atomic>
+#include "looptimer.h"
+#include "plotstream.h"
+#include "rollingextent.h"
+#include "series.h"
 
 class Graph{
     vex::brain::lcd* Brain_Screen;
@@ -16,6 +21,7 @@ class Graph{
     float yPixelsPerUnit;    
     float minXValue;
     float minYValue;
+    bool hasScale = false;
 
     vex::color backgroundColor;
 
@@ -28,14 +34,82 @@ class Graph{
         int maxXPixel;
         int maxYPixel;
     } outline;
+
+    float gridXSpacing = 0;
+    float gridYSpacing = 0;
+    vex::color gridColor;
+
+    /**
+     * Maps values to screen pixels, worked out once per series instead of once per point
+     */
+    struct Transform{
+        float xScale;
+        float xOffset;
+        float yScale;
+        float yOffset;
+
+        int toX(float x) const{ return x * this->xScale + this->xOffset; }
+        int toY(float y) const{ return this->yOffset - y * this->yScale; }
+    };
+    Transform getTransform();
+
+    struct SeriesPixels;
+    struct StreamPixels;
+    template<class Pixels> void drawColumns(Pixels& pixels);
+    void drawGrid(int left, int top, int right, int bottom);
+
+    /**
+     * A PlotStream drawn as it grows
+     */
+    struct Stream{
+        PlotStream* samples;
+        vex::color color;
+        int thickness;
+        uint32_t drawn;     // number of the next sample to draw
+        uint32_t fed;       // number of the next sample to add to extent
+        RollingExtent<PlotStream::capacity>* extent;    // only while there is a window, 0 otherwise
+    };
+    static const int maxStreams = 4;
+    Stream streams[maxStreams];
+    int streamCount = 0;
+    bool needsRedraw = true;
+    float window = 0;       // x span shown while streaming, 0 to show every sample
+    float windowLeft = 0;
+    float newestX = 0;
+
+    vex::thread task;
+    std::atomic<bool> isRunning;
+    uint32_t framePeriod = 33;
+    uint32_t frames = 0;
+    uint32_t redraws = 0;
+
+    bool contains(float x, float y);
+    uint32_t firstShown(const Stream& stream, uint32_t head);
+    void drawSamples(Stream& stream, uint32_t head);
+    void rescaleStreams(const uint32_t* heads);
+    void fitWindow();
+    static int run(void* arg);
     
 public:
     void setGraph(int minX, int maxX, int minY, int maxY, vex::color backgroundColor, bool drawEmptyGraph = false); 
     void setOutline(vex::color outlineColor, int outlineThickness);
     void setScale(float xPixelsPerUnit, float yPixelsPerUnit, float minXValue, float minYValue);
-    void drawData(std::vector<std::vector<float>> data, vex::color dataColor, int penThickness);
+    void setGrid(float xSpacing, float ySpacing, vex::color gridColor);
+    void drawData(const SeriesView& data, vex::color dataColor, int penThickness);
     void drawOutline();
-    void autoScale(std::vector<std::vector<float>> data);
+    void autoScale(const SeriesView& data);
+    void redrawRegion(int left, int top, int right, int bottom);
+    int toScreenX(float x);
+    int toScreenY(float y);
+
+    bool addStream(PlotStream* samples, vex::color color, int thickness);
+    void setWindow(float span);
+    bool drawStreams();
+    void start(int framesPerSecond);
+    void stop();
+    uint32_t getFrames();
+    uint32_t getRedraws();
 
     Graph(vex::brain::lcd* Brain_Screen);
+    ~Graph();
 };
\ No newline at end of file
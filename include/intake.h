@@ -0,0 +1,88 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       intake.h                                                  */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Intake and color sort state machine header                */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "vex.h"
+
+/**
+ * What the driver and the optical sensor gave the intake this tick
+ */
+struct IntakeInput{
+    bool toggle = false;        // L1, starts or stops the intake on each press
+    bool reverse = false;       // L2, runs it backward while held
+    bool redirect = false;      // Y, arms or disarms redirecting the next ring on each press
+    bool nearObject = false;    // the optical sensor sees a ring
+    float hue = 0;
+};
+
+enum class IntakeState : uint8_t {
+    idle,           // stopped, or reversing while L2 is held
+    intaking,       // running forward, watching the optical sensor
+    armingEject,    // carrying a sorted ring up the hook to where it is thrown
+    ejecting,       // reversing to throw it
+    recovering      // back under the driver, ignoring the ring just thrown until it leaves the sensor
+};
+
+/**
+ * The intake and its color sort, advanced one tick at a time
+ * update never waits: it reads the driver's buttons every tick in every state,
+ * moves the hook along by at most one state and sets the motors. A sorted ring
+ * is carried forward by forwardDegrees of the hook, then the hook reverses until
+ * it is returnDegrees from where the ring was seen. Every state that waits on
+ * the hook gives up after a timeout, so a jammed hook hands the intake back to
+ * the driver instead of holding it. Stopping the intake or holding L2 cancels a
+ * sort at once.
+ */
+class Intake{
+    /**
+     * The rings a sort acts on and how far it moves the hook
+     */
+    struct Sort{
+        float minHue;
+        float maxHue;
+        float forwardDegrees;   // of the hook past where the ring was seen before reversing
+        float returnDegrees;    // of the hook past where the ring was seen to reverse back to, negative is behind it
+    };
+
+    vex::motor* Hook;
+    vex::motor* Front;
+
+    Sort eject = {180, 240, 58, 55};
+    Sort redirect = {0, 30, 20.215, -350};
+    Sort* sort = 0;             // the one in progress
+    float sortStart = 0;        // hook position when the ring was seen
+
+    IntakeState state = IntakeState::idle;
+    uint32_t stateStart = 0;    // vex::timer::system() when the state was entered
+    uint32_t armTimeout = 300;
+    uint32_t ejectTimeout = 600;
+    uint32_t recoverTime = 250;
+    uint32_t timeouts = 0;
+
+    bool isOn = false;
+    bool redirectMode = false;
+    bool wasToggle = false;
+    bool wasRedirect = false;
+
+    void enter(IntakeState state, uint32_t now);
+    static bool matches(const Sort& sort, float hue);
+
+public:
+    Intake(vex::motor* Hook, vex::motor* Front);
+
+    void setEject(float minHue, float maxHue, float forwardDegrees, float returnDegrees);
+    void setRedirect(float minHue, float maxHue, float forwardDegrees, float returnDegrees);
+    void setTimeouts(uint32_t armMilliseconds, uint32_t ejectMilliseconds, uint32_t recoverMilliseconds);
+
+    void update(const IntakeInput& input);
+
+    IntakeState getState();
+    bool getIsOn();
+    bool getRedirectMode();
+    uint32_t getTimeouts();
+};
@@ -0,0 +1,167 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       logformat.h                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Binary telemetry log format shared by brain and host      */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "telemetry.h"
+
+/**
+ * Telemetry log file, version 2, every multi byte number little endian
+ *
+ *   header     "VXLG", version u8, channel count u8, then per channel:
+ *              id u8, field count u8, name, then per field: name, scale f32
+ *              (a name is a length u8 and that many characters)
+ *   blocks     one per SD card write, until the end of the file:
+ *              sync marker 4 bytes, payload length varint, record count varint,
+ *              base timestamp varint, payload, Fletcher-16 u16 of everything
+ *              between the sync marker and the checksum (version 1: the payload only)
+ *   record     source << 4 | channel u8, sequence, timestamp delta zigzag varint,
+ *              then each of the channel's fields as a zigzag varint delta
+ *
+ * A field is stored as round(value * scale), so a scale of 100 keeps hundredths.
+ * Sequence numbers, timestamps and fields are deltas from the previous record of
+ * the same source, channel or block, and every block starts from scratch, so a
+ * block decodes on its own. The first record of a source in a block stores its
+ * sequence number, later ones store the number of records dropped in between.
+ * A reader that hits a bad checksum looks for the next sync marker, and a file
+ * cut off mid block still gives every record before the cut.
+ */
+namespace logformat{
+
+static const uint8_t magic[4] = {'V', 'X', 'L', 'G'};
+static const uint8_t version = 2;
+static const uint8_t syncMarker[4] = {0xA5, 0x5A, 0xC3, 0x3C};
+
+static const int maxSources = 16;
+static const int maxChannels = 16;
+static const int maxFields = 6;
+static const int maxRecordBytes = 1 + 3 + 5 + maxFields * 5;
+static const int maxBlockOverhead = 4 + 3 * 5 + 2;
+
+/**
+ * One value of a channel and how finely it is kept
+ */
+struct Field{
+    const char* name;
+    float scale;
+};
+
+/**
+ * What one TelemetryChannel's record values are
+ */
+struct Channel{
+    uint8_t id;
+    const char* name;
+    uint8_t fieldCount;
+    Field fields[maxFields];
+};
+
+/**
+ * The schema the brain writes into every log's header
+ * Readers use the header, not this table, so old logs still decode after it changes.
+ */
+static const Channel channels[] = {
+    {(uint8_t)TelemetryChannel::odom, "odom", 6, {{"x", 100}, {"y", 100}, {"heading", 100}, {"dt", 100000}, {"overruns", 1}, {"resets", 1}}},
+    {(uint8_t)TelemetryChannel::motion, "motion", 4, {{"setpoint", 100}, {"measured", 100}, {"remaining", 100}, {"output", 1000}}},
+    {(uint8_t)TelemetryChannel::path, "path", 5, {{"x", 100}, {"y", 100}, {"heading", 100}, {"left", 1000}, {"right", 1000}}},
+    {(uint8_t)TelemetryChannel::intake, "intake", 4, {{"toggle", 1}, {"redirect", 1}, {"hue", 10}, {"hookPosition", 10}}},
+    {(uint8_t)TelemetryChannel::sensors, "sensors", 6, {{"vertical", 100}, {"horizontal", 100}, {"left", 100}, {"right", 100}, {"rotation", 1000}, {"gyroRate", 100}}},
+    {(uint8_t)TelemetryChannel::status, "status", 3, {{"ring", 1}, {"dropped", 1}, {"lost", 1}}},
+};
+static const int channelCount = sizeof(channels) / sizeof(channels[0]);
+
+/* ---------- Varints ---------- */
+
+/**
+ * Writes an unsigned number 7 bits at a time, low bits first, with the top bit set on every byte but the last
+ *
+ * @return  the number of bytes written, at most 5
+ */
+inline int putVarint(uint8_t* out, uint32_t value){
+    int bytes = 0;
+    while(value >= 0x80){
+        out[bytes++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[bytes++] = (uint8_t)value;
+    return bytes;
+}
+
+/**
+ * Reads a number written by putVarint
+ *
+ * @param   in      where to read, moved past the number
+ * @param   end     the end of the readable bytes
+ * @param   value   the number read
+ *
+ * @return  false if the bytes ran out or the number is too long
+ */
+inline bool getVarint(const uint8_t*& in, const uint8_t* end, uint32_t& value){
+    if(in < end && *in < 0x80){
+        value = *in++;
+        return true;
+    }
+    value = 0;
+    for(int shift = 0; shift < 35 && in < end; shift += 7){
+        uint8_t byte = *in++;
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if(!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+/**
+ * Maps signed numbers to unsigned ones so small negatives stay short, 0, -1, 1, -2 to 0, 1, 2, 3
+ */
+inline uint32_t zigzag(int32_t value){
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+inline int32_t unzigzag(uint32_t value){
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+/**
+ * Rounds a value to its field's scale, saturating instead of overflowing
+ */
+inline int32_t quantize(float value, float scale){
+    float scaled = value * scale;
+    if(!(scaled == scaled)) return 0;
+    if(scaled >= 2147483520.0f) return 2147483520;
+    if(scaled <= -2147483520.0f) return -2147483520;
+    return (int32_t)lroundf(scaled);
+}
+
+/**
+ * Fletcher-16 checksum, cheap enough for the telemetry task
+ * The sums are only reduced every 5802 bytes, the most that cannot overflow 32 bits.
+ */
+inline uint16_t checksum(const uint8_t* data, uint32_t length){
+    uint32_t a = 0;
+    uint32_t b = 0;
+    while(length > 0){
+        uint32_t run = length < 5802 ? length : 5802;
+        length -= run;
+        while(run--){
+            a += *data++;
+            b += a;
+        }
+        a %= 255;
+        b %= 255;
+    }
+    return (uint16_t)(b << 8 | a);
+}
+
+/* ---------- Writing ---------- */
+
+uint32_t writeHeader(uint8_t* out, uint32_t capacity);
+uint32_t encodeBlock(const TelemetryRecord* records, uint32_t count, uint8_t* out);
+
+}
@@ -0,0 +1,45 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       looptimer.h                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Fixed rate loop timer header                              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "vex.h"
+
+/**
+ * Timing statistics of one loop, all times in seconds
+ */
+struct LoopStats{
+    uint32_t ticks = 0;
+    uint32_t overruns = 0;
+    float elapsed = 0;
+    float meanDt = 0;
+    float maxDt = 0;
+    float meanJitter = 0;
+    float maxJitter = 0;
+};
+
+class LoopTimer{
+    uint32_t periodMilliseconds;
+
+    uint32_t nextDeadline;
+    uint64_t startTime;
+    uint64_t previousTick;
+
+    float dt;
+    float jitterSum;
+    LoopStats stats;
+
+public:
+    LoopTimer(uint32_t periodMilliseconds);
+
+    void start();
+    float wait();
+
+    float getDt();
+    float getElapsed();
+    LoopStats getStats();
+};
@@ -0,0 +1,174 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       motion.h                                                  */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Compile time policies of the chassis motion loop          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "vex.h"
+#include "sensors.h"
+#include "pid.h"
+
+/**
+ * Gains and limits of one PID motion, in the units of the motion
+ */
+struct PIDConstants{
+    float Kp = 0;
+    float Ki = 0;
+    float Kd = 0;
+    float integralTolerance = 0;
+    float settleTolerance = 0;
+    float settleTime = 0;
+    float minOutput = 0;
+    float maxOutput = 0;
+
+    PIDConstants(){}
+    PIDConstants(float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput){
+        this->Kp = Kp;
+        this->Ki = Ki;
+        this->Kd = Kd;
+        this->integralTolerance = integralTolerance;
+        this->settleTolerance = settleTolerance;
+        this->settleTime = settleTime;
+        this->minOutput = minOutput;
+        this->maxOutput = maxOutput;
+    }
+};
+
+/**
+ * Limits and feedforward of a motion profile, a max velocity of 0 is no profile
+ */
+struct ProfileConstants{
+    float maxVelocity = 0;
+    float maxAcceleration = 0;
+    float maxJerk = 0;
+    float kS = 0;
+    float kV = 0;
+    float kA = 0;
+};
+
+/**
+ * Pieces of a chassis motion, picked at compile time
+ * chassis::motionLoop is the one settle loop behind every drive, turn, swing and arc. It is
+ * built from a sensor policy that reads what the motion moves, an error source that turns
+ * the target and a reading into an error, and an output mixer that turns the PID output
+ * into motor voltages. Choices made at run time, like the tracking source, pick an
+ * instantiation once per motion, so the loop never branches on them.
+ */
+namespace motion{
+
+/* ---------- Sensors ---------- */
+
+/**
+ * Forward distance from the vertical tracking wheel, in inches
+ */
+struct TrackingWheel{
+    static const bool angular = false;
+    static float read(const SensorFrame &frame, float degreesToInches){ return frame.vertical * degreesToInches; }
+};
+
+/**
+ * Forward distance from the left motor encoders, in inches
+ */
+struct MotorEncoder{
+    static const bool angular = false;
+    static float read(const SensorFrame &frame, float degreesToInches){ return frame.left * degreesToInches; }
+};
+
+/**
+ * Unwrapped rotation from the inertial sensor, in degrees clockwise
+ */
+struct Rotation{
+    static const bool angular = true;
+    static float read(const SensorFrame &frame, float degreesToInches){ return frame.rotation; }
+};
+
+/**
+ * Heading from the inertial sensor, in degrees from 0 to 360
+ */
+struct Heading{
+    static const bool angular = true;
+    static float read(const SensorFrame &frame, float degreesToInches){ return frame.heading; }
+};
+
+/* ---------- Errors ---------- */
+
+/**
+ * Wraps an angle to [-180, 180]
+ */
+inline float wrap(float angle){
+    while(angle > 180) angle -= 360;
+    while(angle < -180) angle += 360;
+    return angle;
+}
+
+/**
+ * Moves a given amount from wherever the motion starts
+ */
+struct RelativeError{
+    static const bool relative = true;
+    static float distance(float amount, float start){ return amount; }
+    static float error(float start, float target, float measured){ return target - (measured - start); }
+};
+
+/**
+ * Moves to an absolute heading the short way around
+ */
+struct HeadingError{
+    static const bool relative = false;
+    static float distance(float heading, float start){ return wrap(heading - start); }
+    static float error(float start, float target, float measured){ return wrap(start + target - measured); }
+};
+
+/* ---------- Mixers ---------- */
+
+/**
+ * Drives both sides with the output, steering with a proportional heading hold
+ */
+struct DriveMixer{
+    PID headingPID;
+    float heading;
+    float minOutput;
+    float maxOutput;
+
+    DriveMixer(float heading, float headingKp, float minOutput, float maxOutput, int cycleTime)
+        : headingPID(headingKp, 0, 0, 0, 0, 0, minOutput, maxOutput, cycleTime){
+        this->heading = heading;
+        this->minOutput = minOutput;
+        this->maxOutput = maxOutput;
+    }
+
+    void start(vex::motor_group* Left, vex::motor_group* Right){}
+    void apply(vex::motor_group* Left, vex::motor_group* Right, float output, const SensorFrame &frame, float dt){
+        float turn = this->headingPID.getOutputDt(wrap(this->heading - frame.heading), dt);
+        Left->spin(vex::directionType::fwd, fminf(fmaxf(output + turn, this->minOutput), this->maxOutput), vex::voltageUnits::volt);
+        Right->spin(vex::directionType::fwd, fminf(fmaxf(output - turn, this->minOutput), this->maxOutput), vex::voltageUnits::volt);
+    }
+};
+
+/**
+ * Drives each side at a fixed multiple of the output, for turns, swings and arcs
+ * A turn is (1, -1), a swing holds one side with a gain of 0, and an arc slows the inner side.
+ */
+struct SideMixer{
+    float leftGain;
+    float rightGain;
+
+    SideMixer(float leftGain, float rightGain){
+        this->leftGain = leftGain;
+        this->rightGain = rightGain;
+    }
+
+    void start(vex::motor_group* Left, vex::motor_group* Right){
+        if(this->leftGain == 0) Left->stop(vex::brakeType::hold);
+        if(this->rightGain == 0) Right->stop(vex::brakeType::hold);
+    }
+    void apply(vex::motor_group* Left, vex::motor_group* Right, float output, const SensorFrame &frame, float dt){
+        if(this->leftGain != 0) Left->spin(vex::directionType::fwd, this->leftGain * output, vex::voltageUnits::volt);
+        if(this->rightGain != 0) Right->spin(vex::directionType::fwd, this->rightGain * output, vex::voltageUnits::volt);
+    }
+};
+
+}
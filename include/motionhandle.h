@@ -0,0 +1,32 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       motionhandle.h                                            */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Background chassis motion handle header                   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "vex.h"
+
+class chassis;
+
+/**
+ * Refers to one motion started with chassis::async or one of the Async motions
+ * Waiting on or cancelling a motion that already finished returns right away,
+ * so a handle can be kept around after its motion is done.
+ */
+class MotionHandle{
+    chassis* Chassis;
+    uint32_t id;
+
+public:
+    MotionHandle();
+    MotionHandle(chassis* Chassis, uint32_t id);
+
+    bool isRunning();
+    float waitUntilSettled();
+    void waitUntilTraveled(float inches);
+    void waitUntilHeading(float heading);
+    void cancel();
+};
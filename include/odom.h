@@ -9,6 +9,13 @@
 
 #pragma once
 #include "vex.h"
+#include "ekf.h"
+#include "looptimer.h"
+#include "pose.h"
+#include "posehistory.h"
+#include "seqlock.h"
+#include "sensors.h"
+#include "telemetry.h"
 
 class odom{
     float verticalDistanceFromCenter;
@@ -16,31 +23,65 @@ class odom{
     float verticalInchesPerDegree;
     float horizontalInhcesPerDegree;
 
-    vex::inertial *Inertial;
+    SensorHub *Sensors;
 
-    vex::rotation *verticalRotation;
-    vex::rotation *horizontalRotation;
+    float previousVertical = 0;
+    float previousHorizontal = 0;
+    float previousHeading = 0;
+    bool rebase = true;
 
-    vex::encoder *verticalEncoder;
-    vex::encoder *horizontalEncoder;
+    bool usesEKF = false;
+    PoseEKF filter;
 
-    bool usesRotation;
+    std::atomic<bool> isRunning;
 
-    bool isRunning = false;
+    Pose pose;
+    Seqlock<Pose> publishedPose;
+    PoseHistory<256> history;
+    std::atomic<uint32_t> resets;   // number of times a setter moved the pose
 
-    std::vector<float> robotPosition = {0, 0, 0};
+    /**
+     * A setter's change to the pose, handed to the odometry task so it stays the only writer
+     */
+    struct PoseReset{
+        static const uint8_t x = 1;
+        static const uint8_t y = 2;
+        static const uint8_t heading = 4;
+
+        float values[3];            // x, y and heading
+        uint8_t fields;             // which of them to set
+    };
+    static const uint8_t resetIdle = 0;
+    static const uint8_t resetWriting = 1;     // a setter is filling in pendingReset
+    static const uint8_t resetPosted = 2;      // waiting for the odometry task to apply it
+    std::atomic<uint8_t> resetState;
+    PoseReset pendingReset;
 
     float degToRad(float deg);
+    void resetTracking(const SensorFrame &frame);
+    void publish();
+    void requestReset(float x, float y, float heading, uint8_t fields);
+    void applyReset();
 
     int updateRateMilliseconds;
+    LoopStats loopStats;
+    TelemetryRing* telemetry = 0;
 public:
     void start();
     void stop();
+    void update(const SensorFrame &frame);
+    LoopStats getLoopStats();
+    void setTelemetry(TelemetryRing* telemetry);
+
+    void useEKF(float driveInchesPerDegree, float trackWidth, EKFSettings settings = EKFSettings());
+    PoseEKF* getEKF();
 
-    odom(vex::rotation &verticalRotation, vex::rotation &horizontalRotation, vex::inertial &Inertial, float verticalDistanceFromCenter, float verticalInchesPerDegree, float horizontalDistanceFromCenter, float horizontalInchesPerDegree, int updateRateMilliseconds);
-    odom(vex::encoder &verticalEncoder, vex::encoder &horizontalEncoder, vex::inertial &Inertial, float verticalDistanceFromCenter, float verticalInchesPerDegree, float horizontalDistanceFromCenter, float horizontalInchesPerDegree, int updateRateMilliseconds);
+    odom(SensorHub &Sensors, float verticalDistanceFromCenter, float verticalInchesPerDegree, float horizontalDistanceFromCenter, float horizontalInchesPerDegree, int updateRateMilliseconds);
     odom();
 
+    Pose getPose();
+    uint32_t readPose(Pose &pose);
+    bool poseAt(uint64_t timestamp, Pose &pose);
     std::vector<float> getPosition();
     float getX();
     float getY();
@@ -0,0 +1,42 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       path.h                                                    */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Polyline path header for the path follower                */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <vector>
+
+/**
+ * One vertex of a path
+ * distance is the length of the path from its first point, in inches
+ */
+struct PathPoint{
+    float x = 0;
+    float y = 0;
+    float distance = 0;
+};
+
+/**
+ * A path on the field made of straight segments, in inches
+ * Curves are added as cubic Bezier curves and flattened into short segments
+ * when they are added, so following the path never evaluates a spline.
+ */
+class Path{
+    std::vector<PathPoint> points;
+
+public:
+    Path();
+    Path(float x, float y);
+
+    void clear();
+    void addPoint(float x, float y);
+    void addBezier(float x1, float y1, float x2, float y2, float x, float y, float spacing = 1);
+
+    PathPoint getPoint(int index);
+    PathPoint getEnd();
+    float getLength();
+    int size();
+};
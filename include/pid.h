@@ -8,26 +8,21 @@
 /*----------------------------------------------------------------------------*/
 #pragma once
 #include "vex.h"
+#include "pidcontroller.h"
 
-class PID{
-    float Kp;
-    float Ki;
-    float Kd;
-    float integralTolerance;
-    float settleTolerance;
-    float settleTime;
-    float minOutput;
-    float maxOutput;
-    int cycleTime;
+/**
+ * The PID every chassis motion uses
+ * Integral that resets outside its tolerance, plain change in error for the derivative,
+ * no feedforward or slew, and settles after settleTime inside settleTolerance
+ */
+typedef PIDController<policy::ToleranceIntegral, policy::ErrorDerivative, policy::NoFeedforward, policy::NoSlew, policy::ToleranceSettle> PID;
 
-    float previousError = 0;
-    float integral = 0;
-    float timeSettled = 0;
+extern template class PIDController<policy::ToleranceIntegral, policy::ErrorDerivative, policy::NoFeedforward, policy::NoSlew, policy::ToleranceSettle>;
 
-public:
-    PID();
-    PID(float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput, int cycleTime);
-    void setConstants(float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput, int cycleTime);
-    float getOutput(float error, bool stopIOvershoot = true);
-    bool isSettled();
-};
\ No newline at end of file
+/**
+ * The PID that tracks a motion profile
+ * Same policies as PID, plus kS, kV and kA feedforward on the profile's velocity and acceleration
+ */
+typedef PIDController<policy::ToleranceIntegral, policy::ErrorDerivative, policy::VelocityFeedforward, policy::NoSlew, policy::ToleranceSettle> ProfiledPID;
+
+extern template class PIDController<policy::ToleranceIntegral, policy::ErrorDerivative, policy::VelocityFeedforward, policy::NoSlew, policy::ToleranceSettle>;
\ No newline at end of file
@@ -0,0 +1,338 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pidcontroller.h                                           */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  PID Controller template with compile time policies        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "vex.h"
+
+/**
+ * Pieces of a PID controller, picked at compile time
+ * The controller inherits from one of each kind, so a policy with nothing to
+ * do has no storage and its calls inline away. Each policy's setter is
+ * reachable straight from the controller (pid.setFilter(0.6)).
+ */
+namespace policy{
+
+/* ---------- Integral ---------- */
+
+/**
+ * No integral term
+ */
+struct NoIntegral{
+    void setIntegral(float integralTolerance){}
+    void resetIntegral(){}
+    float integrate(float error, float previousError, float dt, bool stopIOvershoot){ return 0; }
+};
+
+/**
+ * Integrates the error over time while it is inside the integral tolerance
+ * Resets outside the tolerance, and when the error crosses zero if stopIOvershoot is set
+ */
+struct ToleranceIntegral{
+    float integralTolerance = 0;
+    float integral = 0;
+
+    void setIntegral(float integralTolerance){ this->integralTolerance = integralTolerance; }
+    void resetIntegral(){ this->integral = 0; }
+    float integrate(float error, float previousError, float dt, bool stopIOvershoot){
+        if((error * previousError < 0 && stopIOvershoot) || fabs(error) > this->integralTolerance) this->integral = 0;
+        else this->integral += error * dt;
+        return this->integral;
+    }
+};
+
+/**
+ * Always integrates the error but never lets the integral past +-integralLimit
+ */
+struct ClampedIntegral{
+    float integralLimit = 0;
+    float integral = 0;
+
+    void setIntegral(float integralLimit){ this->integralLimit = integralLimit; }
+    void resetIntegral(){ this->integral = 0; }
+    float integrate(float error, float previousError, float dt, bool stopIOvershoot){
+        this->integral += error * dt;
+        if(this->integral > this->integralLimit) this->integral = this->integralLimit;
+        if(this->integral < -this->integralLimit) this->integral = -this->integralLimit;
+        return this->integral;
+    }
+};
+
+/* ---------- Derivative ---------- */
+
+/**
+ * No derivative term
+ */
+struct NoDerivative{
+    void resetDerivative(){}
+    float derive(float error, float previousError, float measurement, float dt){ return 0; }
+};
+
+/**
+ * Rate of change of the error
+ */
+struct ErrorDerivative{
+    void resetDerivative(){}
+    float derive(float error, float previousError, float measurement, float dt){ return (error - previousError) / dt; }
+};
+
+/**
+ * Rate of change of the error passed through a first order low-pass filter
+ * filter is how much of the old value is kept each update, 0 is no filtering
+ */
+struct FilteredDerivative{
+    float filter = 0.5;
+    float derivative = 0;
+
+    void setFilter(float filter){ this->filter = filter; }
+    void resetDerivative(){ this->derivative = 0; }
+    float derive(float error, float previousError, float measurement, float dt){
+        this->derivative = this->filter * this->derivative + (1 - this->filter) * (error - previousError) / dt;
+        return this->derivative;
+    }
+};
+
+/**
+ * Rate of change of the measurement instead of the error, so a new target does not kick the output
+ * Same as ErrorDerivative while the target holds still
+ */
+struct MeasurementDerivative{
+    float previousMeasurement = 0;
+    bool primed = false;
+
+    void resetDerivative(){ this->primed = false; }
+    float derive(float error, float previousError, float measurement, float dt){
+        float rate = this->primed ? (this->previousMeasurement - measurement) / dt : 0;
+        this->previousMeasurement = measurement;
+        this->primed = true;
+        return rate;
+    }
+};
+
+/* ---------- Feedforward ---------- */
+
+/**
+ * No feedforward term
+ */
+struct NoFeedforward{
+    float feedforward(){ return 0; }
+};
+
+/**
+ * kS * sign(velocity) + kV * velocity + kA * acceleration of the reference
+ * Set the reference with setReference before each getOutput
+ */
+struct VelocityFeedforward{
+    float kS = 0;
+    float kV = 0;
+    float kA = 0;
+    float velocity = 0;
+    float acceleration = 0;
+
+    void setFeedforward(float kS, float kV, float kA){ this->kS = kS; this->kV = kV; this->kA = kA; }
+    void setReference(float velocity, float acceleration){ this->velocity = velocity; this->acceleration = acceleration; }
+    float feedforward(){
+        float sign = this->velocity > 0 ? 1 : (this->velocity < 0 ? -1 : 0);
+        return this->kS * sign + this->kV * this->velocity + this->kA * this->acceleration;
+    }
+};
+
+/* ---------- Slew ---------- */
+
+/**
+ * Output is used as is
+ */
+struct NoSlew{
+    void resetSlew(){}
+    float slew(float output, float dt){ return output; }
+};
+
+/**
+ * Output may only change by maxRate per second, or per update through getOutput(error)
+ */
+struct SlewLimit{
+    float maxRate = 0;
+    float previousOutput = 0;
+
+    void setSlew(float maxRate){ this->maxRate = maxRate; }
+    void resetSlew(){ this->previousOutput = 0; }
+    float slew(float output, float dt){
+        float step = this->maxRate * dt;
+        if(output > this->previousOutput + step) output = this->previousOutput + step;
+        if(output < this->previousOutput - step) output = this->previousOutput - step;
+        this->previousOutput = output;
+        return output;
+    }
+};
+
+/* ---------- Settle ---------- */
+
+/**
+ * Never settles, the caller ends the motion
+ */
+struct NoSettle{
+    void setSettle(float settleTolerance, float settleTime){}
+    void resetSettle(){}
+    void settle(float error, float milliseconds){}
+    bool isSettled(){ return false; }
+};
+
+/**
+ * Settled once the error has stayed inside settleTolerance for settleTime milliseconds
+ */
+struct ToleranceSettle{
+    float settleTolerance = 0;
+    float settleTime = 0;
+    float timeSettled = 0;
+
+    void setSettle(float settleTolerance, float settleTime){ this->settleTolerance = settleTolerance; this->settleTime = settleTime; }
+    void resetSettle(){ this->timeSettled = 0; }
+    void settle(float error, float milliseconds){
+        if(fabs(error) < this->settleTolerance) this->timeSettled += milliseconds;
+        else this->timeSettled = 0;
+    }
+    bool isSettled(){ return (this->settleTime <= this->timeSettled); }
+};
+
+}
+
+/**
+ * PID controller built from one policy of each kind
+ * getOutputDt(error, dt) works in seconds: the integral is the error integrated over
+ * time and the derivative is a rate, so gains hold when the loop period changes.
+ * getOutput(error) counts one update as one unit of time, the way the old PID did,
+ * with gains tuned per cycle.
+ *
+ * @tparam  Integral    policy::NoIntegral, ToleranceIntegral or ClampedIntegral
+ * @tparam  Derivative  policy::NoDerivative, ErrorDerivative, FilteredDerivative or MeasurementDerivative
+ * @tparam  Feedforward policy::NoFeedforward or VelocityFeedforward
+ * @tparam  Slew        policy::NoSlew or SlewLimit
+ * @tparam  Settle      policy::NoSettle or ToleranceSettle
+ */
+template<class Integral, class Derivative, class Feedforward, class Slew, class Settle>
+class PIDController : public Integral, public Derivative, public Feedforward, public Slew, public Settle{
+    float Kp = 0;
+    float Ki = 0;
+    float Kd = 0;
+    float minOutput = 0;
+    float maxOutput = 0;
+    int cycleTime = 0;
+
+    float previousError = 0;
+
+    /**
+     * Private function that runs one update of every policy
+     */
+    float step(float error, float measurement, float dt, float milliseconds, bool stopIOvershoot){
+        float output = this->Kp * error + this->Ki * this->integrate(error, this->previousError, dt, stopIOvershoot) \
+            + this->Kd * this->derive(error, this->previousError, measurement, dt);
+        output += this->feedforward();
+
+        this->previousError = error;
+
+        this->settle(error, milliseconds);
+
+        if(output > this->maxOutput) output = this->maxOutput;
+        if(output < this->minOutput) output = this->minOutput;
+
+        return this->slew(output, dt);
+    }
+
+public:
+    PIDController(){}
+
+    /**
+     * Creates a PID controller with the specified constants
+     *
+     * @param   Kp                  proportional constant
+     * @param   Ki                  integral constant
+     * @param   Kd                  derivative constant
+     * @param   integralTolerance   error tolerance for the integral to be increased, or the limit of a clamped integral
+     * @param   settleTolerance     error tolerance to be considered settled
+     * @param   settleTime          time settled for the PID to end
+     * @param   minOutput           minimum output
+     * @param   maxOutput           maximum output
+     * @param   cycleTime           cycle time in mS
+     */
+    PIDController(float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, \
+        float settleTime, float minOutput, float maxOutput, int cycleTime){
+
+        this->setConstants(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput, cycleTime);
+    }
+
+    /**
+     * Sets the constants of the controller, same arguments as the constructor
+     */
+    void setConstants(float Kp, float Ki, float Kd, float integralTolerance, \
+        float settleTolerance, float settleTime, float minOutput, float maxOutput, int cycleTime){
+
+        this->Kp = Kp;
+        this->Ki = Ki;
+        this->Kd = Kd;
+        this->setIntegral(integralTolerance);
+        this->setSettle(settleTolerance, settleTime);
+        this->minOutput = minOutput;
+        this->maxOutput = maxOutput;
+        this->cycleTime = cycleTime;
+    }
+
+    /**
+     * Clears the integral, derivative, slew and settle state for a new motion
+     */
+    void reset(){
+        this->previousError = 0;
+        this->resetIntegral();
+        this->resetDerivative();
+        this->resetSlew();
+        this->resetSettle();
+    }
+
+    /**
+     * Updates the PID and gives the output, with gains per cycle
+     * The integral is a plain sum of errors and the derivative the change since the last update
+     *
+     * @param   error           the current error
+     * @param   stopIOvershoot  prevents I from causing overshoots
+     *
+     * @return  the PID output
+     */
+    float getOutput(float error, bool stopIOvershoot = true){
+        return this->step(error, -error, 1, this->cycleTime, stopIOvershoot);
+    }
+
+    /**
+     * Updates the PID and gives the output, with gains per second
+     * The measured loop period scales the integral and derivative and is added to the settle time,
+     * a period that is not positive falls back to cycleTime
+     *
+     * @param   error           the current error
+     * @param   dt              the measured time since the last update, in seconds
+     * @param   stopIOvershoot  prevents I from causing overshoots
+     *
+     * @return  the PID output
+     */
+    float getOutputDt(float error, float dt, bool stopIOvershoot = true){
+        if(dt <= 0) dt = this->cycleTime / 1000.0f;
+        return this->step(error, -error, dt, dt * 1000, stopIOvershoot);
+    }
+
+    /**
+     * Updates the PID from a target and a measurement instead of their difference
+     * Only differs from getOutputDt(target - measurement, dt) with MeasurementDerivative
+     *
+     * @param   target          the setpoint
+     * @param   measurement     the current sensor value
+     * @param   dt              the measured time since the last update, in seconds
+     * @param   stopIOvershoot  prevents I from causing overshoots
+     *
+     * @return  the PID output
+     */
+    float getOutputFor(float target, float measurement, float dt, bool stopIOvershoot = true){
+        if(dt <= 0) dt = this->cycleTime / 1000.0f;
+        return this->step(target - measurement, measurement, dt, dt * 1000, stopIOvershoot);
+    }
+};
@@ -0,0 +1,58 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       plotstream.h                                              */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Lock free ring of samples a Graph streams from            */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * Samples a control task appends while a Graph's task draws them
+ * One task pushes and the Graph reads, neither ever waits for the other.
+ * The newest capacity samples are kept, a push past that overwrites the
+ * oldest one, and a reader that fell that far behind sees it with getOldest.
+ * Samples are numbered by the order they were pushed, not by their slot.
+ */
+class PlotStream{
+public:
+    static const uint32_t capacity = 1024;  // a power of two so the index wraps with the counter
+
+private:
+    float xs[capacity];
+    float ys[capacity];
+    std::atomic<uint32_t> head;             // samples pushed, written only by the producer
+
+public:
+    PlotStream() : head(0){}
+
+    /**
+     * Appends a sample, never blocks or allocates
+     */
+    void push(float x, float y){
+        uint32_t pushed = this->head.load(std::memory_order_relaxed);
+        this->xs[pushed % capacity] = x;
+        this->ys[pushed % capacity] = y;
+        this->head.store(pushed + 1, std::memory_order_release);
+    }
+
+    /**
+     * @return  the number of samples ever pushed, one past the newest sample's number
+     */
+    uint32_t getHead() const{
+        return this->head.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @return  the number of the oldest sample still kept when head samples have been pushed
+     */
+    static uint32_t getOldest(uint32_t head){
+        return head > capacity ? head - capacity : 0;
+    }
+
+    float getX(uint32_t sample) const{ return this->xs[sample % capacity]; }
+    float getY(uint32_t sample) const{ return this->ys[sample % capacity]; }
+};
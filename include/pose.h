@@ -0,0 +1,22 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pose.h                                                    */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Robot pose struct shared by odom and its consumers        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "vex.h"
+
+/**
+ * Position of the robot at one instant
+ * x and y are in inches, heading is in degrees [0, 360) clockwise from +y,
+ * timestamp is vex::timer::systemHighResolution() in microseconds
+ */
+struct Pose{
+    float x = 0;
+    float y = 0;
+    float heading = 0;
+    uint64_t timestamp = 0;
+};
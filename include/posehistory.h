@@ -0,0 +1,139 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       posehistory.h                                             */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Fixed capacity ring buffer of timestamped poses           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <atomic>
+#include <math.h>
+#include "pose.h"
+
+/**
+ * Remembers the last capacity poses so a sensor reading taken in the past can
+ * be matched to where the robot was at that moment.
+ * Storage is a plain member array, nothing is allocated after construction.
+ *
+ * push() and clear() come only from the odometry task, which also applies the
+ * odom setters' resets. Readers never block them; a reader whose slots were
+ * overwritten while it searched retries. Like Seqlock, a push counts itself
+ * as started before it writes its slot, so a reader that copied a slot still
+ * being written retries too.
+ *
+ * Slot is what the ring keeps, a Pose unless a tool needs to watch the writes.
+ */
+template<int capacity, class Slot = Pose>
+class PoseHistory{
+    Slot poses[capacity];
+    std::atomic<uint32_t> head;     // number of poses ever pushed
+    std::atomic<uint32_t> started;  // number of pushes begun, one ahead of head while a push writes its slot
+    std::atomic<uint32_t> tail;     // index of the oldest pose still valid
+
+    /**
+     * Private function that finds the oldest valid index for a given head
+     */
+    uint32_t oldest(uint32_t head) const{
+        uint32_t tail = this->tail.load(std::memory_order_acquire);
+        if(head - tail > (uint32_t)capacity) return head - capacity;
+        return tail;
+    }
+
+public:
+    PoseHistory() : head(0), started(0), tail(0){}
+
+    /**
+     * Adds the newest pose
+     * A pose older than the newest one starts the history over. One with the same
+     * timestamp goes in a slot of its own, a pose is never changed once pushed.
+     *
+     * @param   pose    the pose to add, timestamped in microseconds
+     */
+    void push(const Pose& pose){
+        uint32_t head = this->head.load(std::memory_order_relaxed);
+        if(head != this->oldest(head) && pose.timestamp < this->poses[(head - 1) % capacity].timestamp){
+            this->tail.store(head, std::memory_order_release);
+        }
+
+        this->started.store(head + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        this->poses[head % capacity] = pose;
+        this->head.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * Forgets every pose, used when the position is set and old poses no longer match the field
+     */
+    void clear(){
+        this->tail.store(this->head.load(std::memory_order_relaxed), std::memory_order_release);
+    }
+
+    /**
+     * @return  the number of poses held
+     */
+    int size() const{
+        uint32_t head = this->head.load(std::memory_order_acquire);
+        return head - this->oldest(head);
+    }
+
+    /**
+     * Finds where the robot was at a given time
+     * Binary searches for the two poses around the timestamp and interpolates between them,
+     * heading along the shorter way around. Of poses sharing the timestamp the newest is returned.
+     *
+     * @param   timestamp   the time to look up, in microseconds
+     * @param   pose        where to copy the pose, clamped to the oldest or newest pose when out of range
+     *
+     * @return  false if the history is empty or the timestamp is outside of it
+     */
+    bool poseAt(uint64_t timestamp, Pose& pose) const{
+        while(true){
+            uint32_t head = this->head.load(std::memory_order_acquire);
+            uint32_t first = this->oldest(head);
+            if(head == first) return false;
+
+            bool inside = true;
+            uint32_t low = first;
+            uint32_t high = head - 1;
+            Pose before = this->poses[low % capacity];
+            Pose after = this->poses[high % capacity];
+            if(timestamp <= before.timestamp){
+                after = before;
+                inside = timestamp == before.timestamp;
+            }
+            else if(timestamp >= after.timestamp){
+                before = after;
+                inside = timestamp == after.timestamp;
+            }
+            else{
+                // invariant: poses[low] is at or before the timestamp and poses[high] is after it
+                while(high - low > 1){
+                    uint32_t middle = low + (high - low) / 2;
+                    if(this->poses[middle % capacity].timestamp <= timestamp) low = middle;
+                    else high = middle;
+                }
+                before = this->poses[low % capacity];
+                after = this->poses[high % capacity];
+                if(before.timestamp == timestamp) after = before;
+            }
+
+            // a push moves head only once its slot is written, the slot it is writing already counts as gone
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(this->oldest(this->started.load(std::memory_order_relaxed)) > low) continue;
+
+            if(after.timestamp == before.timestamp){
+                pose = after;
+                return inside;
+            }
+
+            float t = (float)(timestamp - before.timestamp) / (float)(after.timestamp - before.timestamp);
+            float turn = fmodf(after.heading - before.heading + 540, 360) - 180;
+            pose.x = before.x + (after.x - before.x) * t;
+            pose.y = before.y + (after.y - before.y) * t;
+            pose.heading = fmodf(before.heading + turn * t + 360, 360);
+            pose.timestamp = timestamp;
+            return true;
+        }
+    }
+};
@@ -0,0 +1,55 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       profile.h                                                 */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Trapezoidal and S-curve motion profile header             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <vector>
+
+/**
+ * One setpoint of a motion profile, in the units of the move (inches or degrees) and seconds
+ */
+struct ProfilePoint{
+    float position = 0;
+    float velocity = 0;
+    float acceleration = 0;
+};
+
+/**
+ * Motion profile that ends at rest, precomputed into a table once per motion
+ * It starts at rest too unless it is given a start velocity, for a chained motion.
+ * A max jerk of 0 gives a trapezoidal profile, anything above gives a jerk limited S-curve.
+ * A max velocity of 0 gives a step straight to the target, so a plain PID motion
+ * can run through the same code.
+ */
+class MotionProfile{
+    struct Phase{
+        float duration;
+        float acceleration;
+        float jerk;
+    };
+
+    static const int maxPoints = 4096;
+
+    std::vector<ProfilePoint> points;
+    float period = 0.01;
+    float duration = 0;
+
+    float accelerationTime(float velocity, float maxAcceleration, float maxJerk);
+    float rampDistance(float startVelocity, float peakVelocity, float maxAcceleration, float maxJerk);
+    void buildRamp(float change, float direction, float maxAcceleration, float maxJerk, Phase* phases);
+
+public:
+    MotionProfile();
+
+    void generate(float distance, float maxVelocity, float maxAcceleration, float maxJerk, float period);
+    void generate(float distance, float maxVelocity, float maxAcceleration, float maxJerk, float period, float startVelocity);
+    ProfilePoint sample(float time);
+
+    float getDuration();
+    float getDistance();
+    int size();
+};
@@ -0,0 +1,100 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       rollingextent.h                                           */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Running min and max of a sliding window of points         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <stdint.h>
+
+/**
+ * Smallest and largest y of the points whose x is inside a window that only moves forward
+ * Keeps two monotonic deques, one with y rising from front to back whose front
+ * is the minimum and one with y falling whose front is the maximum. A new point
+ * first pops every point it beats off the back, so each point enters and
+ * leaves a deque once: push and evictBefore are O(1) amortized and the extent
+ * is read in O(1) however long the window is.
+ * x must not decrease from one push to the next. Storage is a plain member
+ * array, nothing is allocated after construction. A deque holds at most
+ * capacity points, one that runs out of room forgets its oldest point and
+ * isComplete is false until clear, so the owner rescans its window.
+ */
+template<int capacity>
+class RollingExtent{
+    struct Point{
+        float x;
+        float y;
+    };
+
+    /**
+     * Ring of points numbered by counters that only grow, like TelemetryRing
+     */
+    struct Deque{
+        Point points[capacity];
+        uint32_t front = 0;
+        uint32_t back = 0;
+
+        bool isEmpty() const{ return this->front == this->back; }
+        Point& first(){ return this->points[this->front % capacity]; }
+        Point& last(){ return this->points[(this->back - 1) % capacity]; }
+        const Point& first() const{ return this->points[this->front % capacity]; }
+
+        /**
+         * Adds a point behind every point it does not beat
+         * 
+         * @return  false if the deque was full and forgot its oldest point to make room
+         */
+        template<class Beats>
+        bool push(float x, float y, Beats beats){
+            while(!this->isEmpty() && !beats(this->last().y, y)) this->back--;
+            bool full = this->back - this->front == (uint32_t)capacity;
+            if(full) this->front++;
+            Point& point = this->points[this->back++ % capacity];
+            point.x = x;
+            point.y = y;
+            return !full;
+        }
+
+        void evictBefore(float x){
+            while(!this->isEmpty() && this->first().x < x) this->front++;
+        }
+    };
+
+    Deque lows;     // y rising from front to back
+    Deque highs;    // y falling from front to back
+    bool complete = true;
+
+    static bool below(float kept, float y){ return kept < y; }
+    static bool above(float kept, float y){ return kept > y; }
+
+public:
+    /**
+     * Adds the newest point
+     */
+    void push(float x, float y){
+        bool keptLow = this->lows.push(x, y, below);
+        bool keptHigh = this->highs.push(x, y, above);
+        this->complete = this->complete && keptLow && keptHigh;
+    }
+
+    /**
+     * Drops every point left of x, the left edge of the window
+     */
+    void evictBefore(float x){
+        this->lows.evictBefore(x);
+        this->highs.evictBefore(x);
+    }
+
+    void clear(){
+        this->lows.front = this->lows.back = 0;
+        this->highs.front = this->highs.back = 0;
+        this->complete = true;
+    }
+
+    bool isEmpty() const{ return this->lows.isEmpty(); }
+    bool isComplete() const{ return this->complete; }     // false once a point was forgotten, until clear
+    float getMin() const{ return this->lows.first().y; }
+    float getMax() const{ return this->highs.first().y; }
+};
@@ -0,0 +1,72 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       sensors.h                                                 */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Sensor Hub Class header                                   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "vex.h"
+#include <atomic>
+#include "seqlock.h"
+
+/**
+ * Every sensor reading taken in one tick
+ * Positions are raw device degrees, timestamp is in microseconds
+ */
+struct SensorFrame{
+    uint64_t timestamp = 0;
+    float vertical = 0;
+    float horizontal = 0;
+    float left = 0;
+    float right = 0;
+    float rotation = 0;
+    float heading = 0;
+    float gyroRate = 0;
+};
+
+/**
+ * Samples the drive and tracking sensors once a tick and shares the frame
+ * The odometry task, the chassis' motion task and MotionHandle's waits all call
+ * getFrame, and whichever comes first in a tick samples and publishes. That is
+ * several Seqlock writers, allowed because sample never yields (see seqlock.h).
+ */
+class SensorHub{
+    /* ---------- Devices ---------- */
+    vex::motor_group* Left;
+    vex::motor_group* Right;
+    vex::inertial* Inertial;
+
+    vex::rotation* verticalRotation = 0;
+    vex::rotation* horizontalRotation = 0;
+    vex::encoder* verticalEncoder = 0;
+    vex::encoder* horizontalEncoder = 0;
+
+    /* ---------- Data ---------- */
+    Seqlock<SensorFrame> latest;
+    std::atomic<bool> stale;
+    uint32_t maxAgeMicroseconds = 5000;
+    std::atomic<uint32_t> samples;
+    std::atomic<uint32_t> requests;
+
+public:
+    SensorHub(vex::motor_group* Left, vex::motor_group* Right, vex::inertial* Inertial);
+
+    void setVerticalTracking(vex::rotation* verticalRotation);
+    void setVerticalTracking(vex::encoder* verticalEncoder);
+    void setHorizontalTracking(vex::rotation* horizontalRotation);
+    void setHorizontalTracking(vex::encoder* horizontalEncoder);
+    bool hasVerticalTracking();
+    bool hasHorizontalTracking();
+    void setMaxAge(uint32_t milliseconds);
+
+    SensorFrame sample();
+    SensorFrame getFrame();
+    uint32_t readFrame(SensorFrame &frame);
+
+    void setHeading(float heading);
+
+    uint32_t getSampleCount();
+    uint32_t getRequestCount();
+};
@@ -0,0 +1,89 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       seqlock.h                                                 */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Single writer sequence lock for sharing small structs     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <atomic>
+#include <string.h>
+
+/**
+ * Publishes a small plain struct from one writer task to any number of readers
+ * The writer never waits and readers never block it, a reader that overlaps a
+ * write simply copies again. The value is stored as atomic words so a torn copy
+ * is detected by the sequence number instead of being undefined behaviour.
+ *
+ * T must be trivially copyable (plain floats and ints).
+ * Only one task may be inside write() at a time. Two writers that interleave
+ * their sequence increments publish a torn value. The V5 scheduler is
+ * cooperative, a task only gives up the cpu when it sleeps or waits, so several
+ * tasks may write if none of them can yield between building the value and
+ * write() returning (SensorHub's sample reads its devices and writes without
+ * yielding). A value built up over several ticks, like odom's pose, has one
+ * writer task, and changes from other tasks are handed to it (odom's setters).
+ * A preemptive port would need a writer lock here.
+ */
+template<typename T>
+class Seqlock{
+    static const int words = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> data[words];
+
+public:
+    Seqlock() : sequence(0){
+        for(int i = 0; i < words; i++) this->data[i].store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * Publishes a new value
+     *
+     * @param   value   the value to publish
+     */
+    void write(const T& value){
+        uint32_t buffer[words] = {};
+        memcpy(buffer, &value, sizeof(T));
+
+        uint32_t start = this->sequence.load(std::memory_order_relaxed);
+        this->sequence.store(start + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for(int i = 0; i < words; i++) this->data[i].store(buffer[i], std::memory_order_relaxed);
+
+        this->sequence.store(start + 2, std::memory_order_release);
+    }
+
+    /**
+     * Copies out a consistent snapshot of the latest value
+     *
+     * @param   value   where to copy the value
+     *
+     * @return  the number of writes so far, changes every time a new value is published
+     */
+    uint32_t read(T& value) const{
+        uint32_t buffer[words];
+        uint32_t before;
+        uint32_t after;
+        do{
+            before = this->sequence.load(std::memory_order_acquire);
+            for(int i = 0; i < words; i++) buffer[i] = this->data[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = this->sequence.load(std::memory_order_relaxed);
+        } while((before & 1) || before != after);
+
+        memcpy(&value, buffer, sizeof(T));
+        return before / 2;
+    }
+
+    /**
+     * Getter for the number of writes so far without copying the value
+     *
+     * @return  the write count
+     */
+    uint32_t getSequence() const{
+        return this->sequence.load(std::memory_order_acquire) / 2;
+    }
+};
@@ -0,0 +1,60 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       series.h                                                  */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Flat point storage the Graph draws from                   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <stdint.h>
+#include <vector>
+
+/**
+ * Points someone else owns, read through pointers without copying
+ * x and y of point i are x[i * stride] and y[i * stride], so points stored
+ * x0 y0 x1 y1 ... are SeriesView(data, data + 1, count, 2) and separate x and
+ * y arrays, like a column of logged values against its timestamps, are
+ * SeriesView(x, y, count).
+ */
+struct SeriesView{
+    const float* x;
+    const float* y;
+    uint32_t count;
+    uint32_t stride;
+
+    SeriesView() : x(0), y(0), count(0), stride(1){}
+    SeriesView(const float* x, const float* y, uint32_t count, uint32_t stride = 1) : x(x), y(y), count(count), stride(stride){}
+
+    uint32_t size() const{ return this->count; }
+    float getX(uint32_t i) const{ return this->x[i * this->stride]; }
+    float getY(uint32_t i) const{ return this->y[i * this->stride]; }
+};
+
+/**
+ * Points stored flat as x0 y0 x1 y1 ... in one allocation
+ * reserve() up front and push() never allocates while the robot runs.
+ */
+class Series{
+    std::vector<float> points;
+
+public:
+    Series(){}
+    explicit Series(uint32_t capacity){ this->points.reserve(2 * capacity); }
+
+    void reserve(uint32_t capacity){ this->points.reserve(2 * capacity); }
+    void clear(){ this->points.clear(); }
+    void push(float x, float y){
+        this->points.push_back(x);
+        this->points.push_back(y);
+    }
+
+    uint32_t size() const{ return this->points.size() / 2; }
+    float getX(uint32_t i) const{ return this->points[2 * i]; }
+    float getY(uint32_t i) const{ return this->points[2 * i + 1]; }
+
+    operator SeriesView() const{
+        const float* data = this->points.data();
+        return SeriesView(data, data + 1, this->size(), 2);
+    }
+};
@@ -0,0 +1,176 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       telemetry.h                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Lock free telemetry rings drained to the SD card header   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "vex.h"
+#include <atomic>
+
+/**
+ * What a telemetry record's values are
+ */
+enum class TelemetryChannel : uint8_t {
+    odom = 1,       // x, y, heading, loop dt, overruns
+    motion = 2,     // setpoint, measured, remaining, output, for drives, turns, swings and arcs
+    path = 3,       // x, y, heading, left output, right output, for moveTo, followPath and followTrajectory
+    intake = 4,     // toggle, redirect mode, optical hue, hook position
+    sensors = 5,    // vertical, horizontal, left, right, rotation, gyro rate, as odom read them
+    status = 6      // ring, records it dropped so far, records lost so far, written by Telemetry itself
+};
+
+/**
+ * One fixed size telemetry sample, 32 bytes
+ */
+struct TelemetryRecord{
+    uint32_t timestamp;     // microseconds since the brain started
+    uint8_t source;         // the ring it was pushed to, in the order producers were added
+    uint8_t channel;        // a TelemetryChannel
+    uint16_t sequence;      // counted per ring, a gap is dropped records
+    float values[6];
+};
+
+/**
+ * Single producer, single consumer ring of telemetry records
+ * One task pushes and the telemetry task pops, neither ever waits for the other.
+ * A push into a full ring drops the record and counts it instead of blocking.
+ * Only one task may push at a time.
+ */
+class TelemetryRing{
+public:
+    static const uint32_t capacity = 256;   // a power of two so the index wraps with the counters
+
+private:
+    TelemetryRecord records[capacity];
+    std::atomic<uint32_t> head;             // records pushed, written only by the producer
+    std::atomic<uint32_t> tail;             // records popped, written only by the consumer
+    std::atomic<uint32_t> dropped;          // records dropped, written only by the producer
+    uint8_t source;
+
+public:
+    TelemetryRing(uint8_t source) : head(0), tail(0), dropped(0){
+        this->source = source;
+    }
+
+    /**
+     * Copies a record into the ring, stamped with the time and this ring's sequence number
+     * Never blocks or allocates.
+     *
+     * @param   channel the TelemetryChannel of the values
+     * @param   a-f     the values, unused ones are left 0
+     *
+     * @return  false if the ring was full and the record was dropped
+     */
+    bool push(TelemetryChannel channel, float a, float b = 0, float c = 0, float d = 0, float e = 0, float f = 0){
+        uint32_t pushed = this->head.load(std::memory_order_relaxed);
+        if(pushed - this->tail.load(std::memory_order_acquire) >= capacity){
+            this->dropped.store(this->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        TelemetryRecord &record = this->records[pushed % capacity];
+        record.timestamp = (uint32_t)vex::timer::systemHighResolution();
+        record.source = this->source;
+        record.channel = (uint8_t)channel;
+        record.sequence = (uint16_t)(pushed + this->dropped.load(std::memory_order_relaxed));
+        record.values[0] = a;
+        record.values[1] = b;
+        record.values[2] = c;
+        record.values[3] = d;
+        record.values[4] = e;
+        record.values[5] = f;
+
+        this->head.store(pushed + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Copies out the oldest records, only the telemetry task may call this
+     *
+     * @param   out     where to copy the records
+     * @param   max     the most records to copy
+     *
+     * @return  the number of records copied
+     */
+    uint32_t pop(TelemetryRecord* out, uint32_t max){
+        uint32_t popped = this->tail.load(std::memory_order_relaxed);
+        uint32_t available = this->head.load(std::memory_order_acquire) - popped;
+        uint32_t count = available < max ? available : max;
+        for(uint32_t i = 0; i < count; i++) out[i] = this->records[(popped + i) % capacity];
+
+        this->tail.store(popped + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * Getter for the number of records dropped because the ring was full
+     */
+    uint32_t getDropped() const{
+        return this->dropped.load(std::memory_order_relaxed);
+    }
+};
+
+/**
+ * Collects records from every producer's ring and writes them to a file on the SD card
+ * A low priority task drains the rings into a buffer and appends the buffer to the file
+ * once it is full, so the card sees a few large sequential writes instead of one per record.
+ * A buffer that has not filled is written once it is writePeriod old, so a match that ends
+ * without stop loses at most that much of its log.
+ * The file is the compact log format in logformat.h. Register producers with addProducer
+ * before start.
+ */
+class Telemetry{
+public:
+    static const int maxProducers = 8;
+    static const uint8_t statusSource = 15;     // the source of Telemetry's own status records
+    static const uint32_t bufferRecords = 128;
+    static const uint32_t encodedBytes = bufferRecords * 40 + 32;  // room for a block of bufferRecords
+
+private:
+    vex::brain::sdcard* SDcard;
+    const char* fileName;
+
+    TelemetryRing* rings[maxProducers];
+    std::atomic<int> producers;
+    uint32_t reportedDrops[maxProducers];
+    uint16_t statusSequence = 0;
+
+    TelemetryRecord buffer[bufferRecords];
+    uint32_t buffered = 0;
+    uint8_t encoded[encodedBytes];
+    uint32_t flushPeriod = 20;
+    uint32_t writePeriod = 250;
+    uint32_t lastWrite = 0;         // vex::timer::system() of the last append or of start
+
+    vex::thread task;
+    std::atomic<bool> isRunning;
+
+    uint32_t written = 0;
+    uint32_t writtenBytes = 0;
+    uint32_t writes = 0;
+    uint32_t lost = 0;
+
+    uint32_t drain();
+    void reportDrops();
+    void flush();
+    static int run(void* arg);
+
+public:
+    Telemetry(vex::brain::sdcard* SDcard, const char* fileName);
+
+    TelemetryRing* addProducer();
+    void setFlushPeriod(uint32_t milliseconds);
+    void setWritePeriod(uint32_t milliseconds);
+
+    void start();
+    void stop();
+
+    uint32_t getDropped();
+    uint32_t getWritten();
+    uint32_t getWrittenBytes();
+    uint32_t getWrites();
+    uint32_t getLost();
+};
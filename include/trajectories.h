@@ -0,0 +1,559 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       trajectories.h                                            */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Generated by sim/tools/trajgen, do not edit               */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "trajectory.h"
+
+// from trajectories.txt, regenerate with "make trajectories" in sim/
+namespace trajectories{
+
+// sweep: 3 waypoints, 2.65 s, 90.2 in
+constexpr TrajectoryPoint sweepPoints[267] = {
+    {0, 0, 0, 0, 0},
+    {0, 2, 0, 100, 0},
+    {0, 3, 0, 200, 0},
+    {0, 5, 0, 300, 0},
+    {0, 8, 0, 400, 0},
+    {0, 13, 0, 500, 0},
+    {0, 18, 0, 600, 1},
+    {0, 25, 0, 700, 1},
+    {0, 32, 0, 800, 2},
+    {0, 41, 1, 900, 3},
+    {0, 50, 1, 1000, 4},
+    {0, 61, 1, 1100, 5},
+    {0, 72, 2, 1200, 7},
+    {0, 85, 3, 1300, 9},
+    {0, 98, 4, 1400, 11},
+    {0, 113, 5, 1500, 13},
+    {0, 128, 7, 1600, 16},
+    {0, 145, 8, 1700, 19},
+    {0, 162, 10, 1800, 23},
+    {0, 181, 13, 1900, 27},
+    {0, 200, 16, 2000, 32},
+    {0, 221, 19, 2100, 36},
+    {0, 242, 23, 2200, 42},
+    {0, 265, 28, 2300, 48},
+    {1, 288, 33, 2400, 54},
+    {1, 313, 38, 2500, 61},
+    {1, 338, 45, 2600, 68},
+    {1, 364, 52, 2700, 76},
+    {1, 392, 60, 2800, 85},
+    {2, 420, 69, 2900, 94},
+    {2, 450, 79, 3000, 103},
+    {3, 480, 90, 3100, 113},
+    {3, 512, 102, 3200, 124},
+    {4, 544, 115, 3300, 135},
+    {4, 578, 129, 3400, 147},
+    {5, 612, 144, 3500, 159},
+    {6, 648, 161, 3600, 172},
+    {7, 684, 178, 3700, 186},
+    {8, 722, 198, 3800, 200},
+    {10, 760, 218, 3900, 215},
+    {11, 800, 241, 4000, 230},
+    {13, 840, 264, 4100, 246},
+    {15, 882, 290, 4200, 263},
+    {17, 924, 317, 4300, 280},
+    {20, 968, 346, 4400, 298},
+    {23, 1012, 377, 4500, 317},
+    {26, 1057, 409, 4600, 337},
+    {29, 1104, 444, 4617, 351},
+    {33, 1149, 480, 4603, 364},
+    {37, 1195, 517, 4590, 376},
+    {41, 1241, 555, 4577, 388},
+    {46, 1286, 594, 4564, 400},
+    {51, 1332, 635, 4551, 412},
+    {56, 1377, 677, 4537, 424},
+    {61, 1422, 720, 4523, 437},
+    {67, 1467, 764, 4510, 449},
+    {73, 1511, 810, 4496, 462},
+    {80, 1556, 856, 4481, 475},
+    {87, 1600, 905, 4467, 489},
+    {94, 1644, 954, 4452, 502},
+    {102, 1688, 1005, 4437, 516},
+    {110, 1731, 1058, 4421, 531},
+    {118, 1775, 1111, 4405, 545},
+    {126, 1818, 1167, 4389, 560},
+    {136, 1860, 1223, 4372, 575},
+    {145, 1903, 1282, 4355, 591},
+    {155, 1945, 1342, 4338, 607},
+    {165, 1987, 1403, 4320, 624},
+    {176, 2029, 1466, 4301, 641},
+    {187, 2071, 1531, 4282, 658},
+    {198, 2112, 1598, 4263, 676},
+    {210, 2153, 1667, 4242, 694},
+    {223, 2193, 1737, 4222, 713},
+    {236, 2233, 1809, 4201, 733},
+    {249, 2273, 1883, 4179, 752},
+    {263, 2312, 1960, 4157, 772},
+    {277, 2351, 2038, 4135, 793},
+    {291, 2390, 2118, 4112, 814},
+    {306, 2428, 2201, 4088, 836},
+    {322, 2466, 2285, 4064, 858},
+    {338, 2503, 2372, 4040, 880},
+    {355, 2540, 2461, 4016, 902},
+    {372, 2576, 2553, 3991, 925},
+    {389, 2612, 2647, 3965, 948},
+    {407, 2647, 2743, 3940, 972},
+    {425, 2682, 2841, 3915, 995},
+    {444, 2716, 2942, 3889, 1019},
+    {463, 2749, 3045, 3863, 1042},
+    {483, 2782, 3150, 3838, 1065},
+    {504, 2815, 3258, 3813, 1088},
+    {524, 2847, 3368, 3788, 1111},
+    {546, 2878, 3480, 3763, 1134},
+    {567, 2908, 3594, 3739, 1156},
+    {589, 2938, 3711, 3716, 1177},
+    {612, 2968, 3830, 3693, 1198},
+    {635, 2996, 3951, 3671, 1218},
+    {659, 3024, 4073, 3650, 1237},
+    {683, 3052, 4198, 3630, 1256},
+    {707, 3078, 4325, 3612, 1273},
+    {732, 3104, 4453, 3595, 1288},
+    {758, 3130, 4582, 3579, 1303},
+    {784, 3154, 4713, 3565, 1316},
+    {810, 3178, 4845, 3552, 1327},
+    {837, 3201, 4978, 3542, 1337},
+    {864, 3224, 5113, 3533, 1345},
+    {892, 3246, 5247, 3526, 1351},
+    {920, 3267, 5383, 3521, 1356},
+    {949, 3287, 5519, 3518, 1358},
+    {978, 3307, 5654, 3518, 1359},
+    {1007, 3326, 5790, 3519, 1357},
+    {1037, 3344, 5926, 3523, 1354},
+    {1068, 3362, 6061, 3529, 1348},
+    {1099, 3379, 6195, 3538, 1340},
+    {1130, 3395, 6329, 3549, 1330},
+    {1162, 3411, 6461, 3562, 1318},
+    {1195, 3426, 6593, 3577, 1304},
+    {1228, 3440, 6722, 3595, 1288},
+    {1261, 3454, 6850, 3615, 1270},
+    {1295, 3467, 6976, 3637, 1250},
+    {1329, 3479, 7100, 3661, 1228},
+    {1364, 3490, 7222, 3687, 1204},
+    {1400, 3501, 7341, 3715, 1178},
+    {1435, 3512, 7457, 3746, 1150},
+    {1472, 3521, 7571, 3778, 1120},
+    {1509, 3530, 7681, 3812, 1089},
+    {1546, 3539, 7788, 3847, 1057},
+    {1584, 3546, 7892, 3885, 1022},
+    {1622, 3554, 7993, 3924, 986},
+    {1661, 3560, 8090, 3965, 949},
+    {1701, 3566, 8182, 4007, 910},
+    {1740, 3572, 8271, 4052, 869},
+    {1781, 3576, 8356, 4097, 828},
+    {1822, 3581, 8437, 4145, 784},
+    {1863, 3585, 8513, 4194, 739},
+    {1905, 3588, 8585, 4245, 692},
+    {1948, 3591, 8651, 4298, 644},
+    {1991, 3593, 8713, 4353, 593},
+    {2035, 3595, 8770, 4411, 540},
+    {2079, 3597, 8821, 4471, 485},
+    {2124, 3598, 8867, 4534, 427},
+    {2170, 3599, 8907, 4601, 365},
+    {2216, 3599, 8940, 4673, 300},
+    {2264, 3600, 8966, 4749, 230},
+    {2311, 3600, 8986, 4832, 154},
+    {2360, 3600, 8997, 4921, 72},
+    {2410, 3600, 9000, 4978, -19},
+    {2459, 3600, 8993, 4880, -110},
+    {2507, 3600, 8978, 4791, -192},
+    {2555, 3600, 8955, 4710, -266},
+    {2602, 3601, 8925, 4636, -334},
+    {2648, 3602, 8889, 4569, -395},
+    {2693, 3603, 8846, 4507, -452},
+    {2738, 3604, 8798, 4450, -505},
+    {2782, 3606, 8745, 4397, -553},
+    {2826, 3608, 8688, 4347, -598},
+    {2869, 3611, 8626, 4302, -640},
+    {2912, 3614, 8560, 4259, -679},
+    {2954, 3617, 8490, 4219, -716},
+    {2996, 3621, 8417, 4181, -751},
+    {3037, 3626, 8340, 4146, -783},
+    {3078, 3631, 8260, 4112, -814},
+    {3119, 3636, 8177, 4081, -843},
+    {3159, 3642, 8092, 4051, -870},
+    {3199, 3649, 8003, 4023, -896},
+    {3238, 3656, 7913, 3997, -920},
+    {3277, 3664, 7819, 3972, -943},
+    {3316, 3673, 7724, 3948, -965},
+    {3354, 3682, 7627, 3925, -985},
+    {3392, 3691, 7527, 3904, -1005},
+    {3430, 3701, 7426, 3884, -1023},
+    {3467, 3712, 7322, 3865, -1040},
+    {3504, 3724, 7218, 3847, -1057},
+    {3540, 3736, 7111, 3830, -1072},
+    {3576, 3748, 7003, 3814, -1087},
+    {3612, 3762, 6894, 3799, -1101},
+    {3647, 3776, 6783, 3785, -1114},
+    {3682, 3790, 6671, 3772, -1126},
+    {3716, 3806, 6558, 3760, -1137},
+    {3750, 3821, 6444, 3748, -1148},
+    {3784, 3838, 6328, 3737, -1157},
+    {3817, 3855, 6212, 3728, -1167},
+    {3850, 3873, 6095, 3718, -1175},
+    {3882, 3891, 5977, 3710, -1183},
+    {3914, 3910, 5859, 3702, -1190},
+    {3945, 3930, 5739, 3695, -1196},
+    {3976, 3950, 5619, 3689, -1202},
+    {4007, 3971, 5499, 3683, -1207},
+    {4036, 3992, 5378, 3678, -1212},
+    {4066, 4014, 5257, 3674, -1216},
+    {4095, 4037, 5135, 3670, -1219},
+    {4123, 4060, 5013, 3667, -1222},
+    {4151, 4084, 4891, 3665, -1224},
+    {4178, 4108, 4768, 3663, -1225},
+    {4205, 4133, 4646, 3662, -1226},
+    {4232, 4159, 4523, 3662, -1227},
+    {4257, 4185, 4400, 3662, -1227},
+    {4282, 4211, 4278, 3663, -1226},
+    {4307, 4239, 4155, 3664, -1224},
+    {4331, 4266, 4033, 3666, -1223},
+    {4354, 4295, 3911, 3669, -1220},
+    {4377, 4323, 3789, 3673, -1217},
+    {4400, 4352, 3667, 3677, -1213},
+    {4421, 4382, 3546, 3681, -1209},
+    {4442, 4412, 3425, 3687, -1204},
+    {4463, 4443, 3305, 3693, -1198},
+    {4483, 4474, 3186, 3699, -1192},
+    {4502, 4506, 3067, 3707, -1185},
+    {4520, 4538, 2949, 3715, -1178},
+    {4538, 4571, 2831, 3724, -1170},
+    {4556, 4604, 2715, 3734, -1161},
+    {4572, 4637, 2599, 3744, -1151},
+    {4589, 4671, 2485, 3755, -1141},
+    {4604, 4705, 2371, 3767, -1130},
+    {4619, 4740, 2259, 3780, -1118},
+    {4633, 4775, 2147, 3794, -1106},
+    {4647, 4811, 2037, 3809, -1092},
+    {4660, 4846, 1929, 3824, -1078},
+    {4672, 4883, 1822, 3841, -1063},
+    {4684, 4919, 1716, 3858, -1047},
+    {4695, 4957, 1613, 3877, -1030},
+    {4705, 4994, 1511, 3897, -1012},
+    {4715, 5032, 1410, 3917, -993},
+    {4724, 5070, 1312, 3939, -972},
+    {4733, 5108, 1216, 3963, -951},
+    {4741, 5147, 1122, 3987, -929},
+    {4748, 5187, 1030, 4013, -905},
+    {4755, 5226, 942, 3940, -858},
+    {4761, 5264, 859, 3840, -807},
+    {4767, 5302, 781, 3740, -756},
+    {4771, 5338, 707, 3640, -707},
+    {4776, 5374, 639, 3540, -660},
+    {4779, 5409, 575, 3440, -614},
+    {4783, 5443, 516, 3340, -570},
+    {4785, 5475, 461, 3240, -527},
+    {4788, 5507, 411, 3140, -486},
+    {4790, 5538, 364, 3040, -447},
+    {4792, 5568, 321, 2940, -410},
+    {4793, 5597, 282, 2840, -374},
+    {4794, 5625, 246, 2740, -340},
+    {4796, 5651, 214, 2640, -307},
+    {4796, 5677, 185, 2540, -277},
+    {4797, 5702, 159, 2440, -248},
+    {4798, 5726, 135, 2340, -221},
+    {4798, 5749, 114, 2240, -196},
+    {4799, 5771, 96, 2140, -173},
+    {4799, 5792, 80, 2040, -151},
+    {4799, 5812, 66, 1940, -131},
+    {4799, 5831, 53, 1840, -113},
+    {4800, 5849, 43, 1740, -96},
+    {4800, 5865, 34, 1640, -81},
+    {4800, 5881, 27, 1540, -68},
+    {4800, 5896, 20, 1440, -56},
+    {4800, 5910, 15, 1340, -45},
+    {4800, 5923, 11, 1240, -36},
+    {4800, 5935, 8, 1140, -28},
+    {4800, 5946, 6, 1040, -22},
+    {4800, 5956, 4, 940, -16},
+    {4800, 5965, 2, 840, -11},
+    {4800, 5973, 1, 740, -8},
+    {4800, 5979, 1, 640, -5},
+    {4800, 5985, 0, 540, -3},
+    {4800, 5990, 0, 440, -2},
+    {4800, 5994, 0, 340, -1},
+    {4800, 5996, 0, 240, 0},
+    {4800, 5998, 0, 140, 0},
+    {4800, 5999, 0, 40, 0},
+    {4800, 6000, 0, 0, 0},
+};
+constexpr Trajectory sweep = {sweepPoints, 267, 10};
+
+// sweepBack: 3 waypoints, 2.65 s, 90.2 in, driven backwards
+constexpr TrajectoryPoint sweepBackPoints[267] = {
+    {4800, 6000, 0, 0, 0},
+    {4800, 5998, 0, -100, 0},
+    {4800, 5997, 0, -200, 0},
+    {4800, 5995, 0, -300, 1},
+    {4800, 5992, 0, -400, 1},
+    {4800, 5987, 0, -500, 2},
+    {4800, 5982, 1, -600, 4},
+    {4800, 5975, 1, -700, 7},
+    {4800, 5968, 2, -800, 10},
+    {4800, 5959, 3, -900, 14},
+    {4800, 5950, 5, -1000, 19},
+    {4800, 5939, 7, -1100, 25},
+    {4800, 5928, 10, -1200, 33},
+    {4800, 5915, 14, -1300, 41},
+    {4800, 5902, 18, -1400, 51},
+    {4800, 5887, 24, -1500, 63},
+    {4800, 5872, 31, -1600, 76},
+    {4800, 5855, 39, -1700, 90},
+    {4800, 5838, 49, -1800, 106},
+    {4799, 5820, 60, -1900, 124},
+    {4799, 5800, 74, -2000, 143},
+    {4799, 5780, 89, -2100, 164},
+    {4798, 5758, 107, -2200, 186},
+    {4798, 5736, 126, -2300, 211},
+    {4797, 5712, 149, -2400, 237},
+    {4797, 5688, 174, -2500, 265},
+    {4796, 5662, 202, -2600, 295},
+    {4795, 5636, 233, -2700, 326},
+    {4794, 5608, 267, -2800, 360},
+    {4792, 5580, 305, -2900, 395},
+    {4791, 5550, 346, -3000, 432},
+    {4789, 5520, 391, -3100, 470},
+    {4786, 5488, 440, -3200, 511},
+    {4784, 5456, 493, -3300, 553},
+    {4781, 5423, 551, -3400, 596},
+    {4777, 5388, 613, -3500, 641},
+    {4773, 5353, 679, -3600, 688},
+    {4769, 5317, 750, -3700, 736},
+    {4764, 5280, 827, -3800, 786},
+    {4758, 5242, 908, -3900, 837},
+    {4751, 5203, 994, -4000, 890},
+    {4744, 5163, 1085, -3997, 919},
+    {4736, 5124, 1178, -3972, 942},
+    {4728, 5085, 1273, -3948, 964},
+    {4719, 5047, 1371, -3926, 985},
+    {4709, 5009, 1470, -3905, 1004},
+    {4699, 4972, 1571, -3885, 1022},
+    {4688, 4934, 1674, -3866, 1040},
+    {4677, 4897, 1779, -3848, 1056},
+    {4665, 4861, 1886, -3831, 1072},
+    {4652, 4825, 1994, -3815, 1087},
+    {4639, 4789, 2103, -3800, 1100},
+    {4625, 4754, 2214, -3786, 1113},
+    {4610, 4719, 2326, -3772, 1125},
+    {4595, 4685, 2439, -3760, 1137},
+    {4579, 4651, 2553, -3749, 1147},
+    {4563, 4617, 2668, -3738, 1157},
+    {4545, 4584, 2784, -3728, 1166},
+    {4528, 4551, 2901, -3719, 1175},
+    {4509, 4519, 3019, -3710, 1182},
+    {4490, 4487, 3138, -3702, 1190},
+    {4471, 4456, 3257, -3695, 1196},
+    {4451, 4425, 3377, -3689, 1202},
+    {4430, 4394, 3497, -3683, 1207},
+    {4408, 4364, 3618, -3678, 1212},
+    {4386, 4335, 3740, -3674, 1216},
+    {4364, 4306, 3861, -3670, 1219},
+    {4341, 4278, 3983, -3667, 1222},
+    {4317, 4250, 4106, -3665, 1224},
+    {4292, 4222, 4228, -3663, 1225},
+    {4267, 4196, 4351, -3662, 1226},
+    {4242, 4169, 4473, -3662, 1227},
+    {4216, 4143, 4596, -3662, 1227},
+    {4189, 4118, 4719, -3663, 1226},
+    {4162, 4094, 4841, -3664, 1225},
+    {4135, 4070, 4964, -3666, 1223},
+    {4106, 4046, 5086, -3669, 1220},
+    {4078, 4023, 5208, -3672, 1217},
+    {4048, 4001, 5329, -3676, 1213},
+    {4019, 3979, 5450, -3681, 1209},
+    {3988, 3958, 5571, -3686, 1204},
+    {3958, 3938, 5691, -3693, 1199},
+    {3927, 3918, 5811, -3699, 1192},
+    {3895, 3899, 5930, -3707, 1186},
+    {3863, 3880, 6048, -3715, 1178},
+    {3830, 3862, 6165, -3724, 1170},
+    {3797, 3845, 6282, -3733, 1161},
+    {3764, 3828, 6397, -3744, 1152},
+    {3730, 3812, 6512, -3755, 1141},
+    {3696, 3796, 6626, -3767, 1130},
+    {3661, 3782, 6738, -3780, 1119},
+    {3626, 3767, 6849, -3794, 1106},
+    {3590, 3754, 6959, -3808, 1093},
+    {3555, 3741, 7068, -3824, 1078},
+    {3518, 3728, 7175, -3840, 1063},
+    {3482, 3717, 7280, -3858, 1047},
+    {3445, 3706, 7384, -3876, 1030},
+    {3407, 3695, 7486, -3896, 1012},
+    {3369, 3685, 7587, -3917, 993},
+    {3331, 3676, 7685, -3939, 973},
+    {3293, 3667, 7781, -3962, 952},
+    {3254, 3659, 7875, -3986, 929},
+    {3214, 3652, 7967, -4012, 906},
+    {3175, 3645, 8056, -4040, 880},
+    {3135, 3639, 8143, -4069, 854},
+    {3094, 3633, 8227, -4099, 826},
+    {3054, 3628, 8308, -4132, 796},
+    {3012, 3623, 8386, -4167, 764},
+    {2971, 3619, 8461, -4203, 730},
+    {2929, 3615, 8532, -4242, 695},
+    {2886, 3612, 8600, -4284, 656},
+    {2843, 3609, 8663, -4329, 615},
+    {2800, 3607, 8723, -4376, 572},
+    {2756, 3605, 8778, -4428, 525},
+    {2711, 3603, 8828, -4483, 474},
+    {2666, 3602, 8872, -4543, 419},
+    {2620, 3601, 8911, -4608, 359},
+    {2574, 3601, 8944, -4679, 294},
+    {2527, 3600, 8970, -4757, 223},
+    {2479, 3600, 8988, -4843, 144},
+    {2430, 3600, 8998, -4938, 57},
+    {2380, 3600, 8999, -4960, -37},
+    {2331, 3600, 8991, -4867, -122},
+    {2283, 3600, 8975, -4782, -200},
+    {2235, 3600, 8951, -4703, -272},
+    {2189, 3599, 8921, -4630, -340},
+    {2143, 3598, 8884, -4561, -403},
+    {2097, 3597, 8840, -4496, -462},
+    {2053, 3596, 8791, -4435, -518},
+    {2009, 3594, 8737, -4376, -572},
+    {1965, 3592, 8677, -4320, -624},
+    {1923, 3589, 8612, -4266, -673},
+    {1880, 3586, 8542, -4214, -720},
+    {1839, 3582, 8468, -4164, -766},
+    {1797, 3578, 8389, -4116, -810},
+    {1757, 3574, 8306, -4070, -853},
+    {1717, 3568, 8219, -4025, -894},
+    {1677, 3563, 8127, -3982, -933},
+    {1638, 3556, 8032, -3940, -971},
+    {1599, 3549, 7933, -3901, -1008},
+    {1561, 3542, 7831, -3862, -1043},
+    {1524, 3534, 7725, -3826, -1076},
+    {1487, 3525, 7615, -3791, -1108},
+    {1450, 3516, 7503, -3758, -1138},
+    {1414, 3505, 7388, -3727, -1167},
+    {1378, 3495, 7270, -3698, -1193},
+    {1343, 3484, 7149, -3671, -1218},
+    {1309, 3472, 7026, -3646, -1241},
+    {1275, 3459, 6901, -3623, -1262},
+    {1241, 3446, 6774, -3603, -1281},
+    {1208, 3432, 6645, -3584, -1298},
+    {1175, 3417, 6514, -3568, -1313},
+    {1143, 3402, 6382, -3554, -1326},
+    {1112, 3386, 6249, -3542, -1337},
+    {1080, 3369, 6115, -3533, -1345},
+    {1050, 3351, 5980, -3525, -1352},
+    {1019, 3333, 5845, -3521, -1356},
+    {990, 3315, 5709, -3518, -1358},
+    {960, 3295, 5573, -3518, -1359},
+    {932, 3275, 5437, -3520, -1357},
+    {903, 3254, 5302, -3524, -1353},
+    {875, 3233, 5167, -3530, -1348},
+    {848, 3210, 5032, -3538, -1340},
+    {821, 3187, 4899, -3548, -1331},
+    {794, 3164, 4766, -3560, -1321},
+    {768, 3140, 4635, -3573, -1308},
+    {743, 3114, 4505, -3588, -1294},
+    {717, 3089, 4376, -3605, -1279},
+    {693, 3062, 4249, -3623, -1263},
+    {668, 3035, 4123, -3642, -1245},
+    {645, 3008, 4000, -3663, -1226},
+    {621, 2979, 3878, -3684, -1206},
+    {599, 2950, 3759, -3706, -1186},
+    {576, 2921, 3641, -3730, -1165},
+    {554, 2890, 3526, -3753, -1143},
+    {533, 2859, 3413, -3778, -1120},
+    {512, 2828, 3302, -3803, -1098},
+    {491, 2795, 3193, -3828, -1075},
+    {471, 2763, 3087, -3853, -1051},
+    {452, 2729, 2983, -3879, -1028},
+    {433, 2695, 2881, -3904, -1005},
+    {414, 2661, 2782, -3930, -981},
+    {396, 2626, 2685, -3955, -958},
+    {378, 2590, 2590, -3981, -935},
+    {361, 2554, 2498, -4006, -912},
+    {345, 2518, 2408, -4030, -889},
+    {328, 2481, 2320, -4055, -867},
+    {313, 2443, 2235, -4079, -845},
+    {297, 2405, 2151, -4102, -823},
+    {283, 2367, 2070, -4126, -802},
+    {268, 2328, 1991, -4148, -781},
+    {254, 2289, 1914, -4171, -760},
+    {241, 2249, 1839, -4192, -740},
+    {228, 2209, 1766, -4214, -721},
+    {215, 2169, 1695, -4234, -702},
+    {203, 2128, 1625, -4255, -683},
+    {192, 2087, 1558, -4274, -665},
+    {180, 2046, 1492, -4293, -648},
+    {169, 2004, 1428, -4312, -631},
+    {159, 1962, 1366, -4330, -614},
+    {149, 1920, 1306, -4348, -598},
+    {139, 1878, 1247, -4365, -582},
+    {130, 1835, 1189, -4382, -566},
+    {121, 1792, 1133, -4399, -551},
+    {113, 1749, 1079, -4415, -536},
+    {105, 1705, 1026, -4431, -522},
+    {97, 1661, 975, -4446, -508},
+    {90, 1618, 924, -4461, -494},
+    {83, 1573, 876, -4476, -481},
+    {76, 1529, 828, -4490, -468},
+    {70, 1485, 782, -4504, -455},
+    {64, 1440, 737, -4518, -442},
+    {58, 1395, 694, -4532, -429},
+    {53, 1350, 652, -4545, -417},
+    {48, 1305, 610, -4559, -405},
+    {43, 1259, 571, -4572, -393},
+    {39, 1214, 532, -4585, -380},
+    {35, 1168, 494, -4598, -368},
+    {31, 1122, 458, -4611, -356},
+    {27, 1076, 423, -4624, -344},
+    {24, 1030, 390, -4540, -325},
+    {21, 985, 358, -4440, -306},
+    {18, 942, 328, -4340, -288},
+    {16, 899, 301, -4240, -270},
+    {14, 857, 274, -4140, -253},
+    {12, 816, 250, -4040, -236},
+    {10, 776, 227, -3940, -221},
+    {9, 737, 206, -3840, -206},
+    {8, 699, 186, -3740, -191},
+    {7, 663, 168, -3640, -178},
+    {6, 627, 150, -3540, -164},
+    {5, 592, 135, -3440, -152},
+    {4, 558, 120, -3340, -140},
+    {3, 525, 107, -3240, -128},
+    {3, 493, 94, -3140, -117},
+    {2, 462, 83, -3040, -107},
+    {2, 432, 73, -2940, -97},
+    {2, 403, 64, -2840, -88},
+    {1, 375, 55, -2740, -80},
+    {1, 349, 48, -2640, -71},
+    {1, 323, 41, -2540, -64},
+    {1, 298, 35, -2440, -57},
+    {0, 274, 30, -2340, -50},
+    {0, 251, 25, -2240, -44},
+    {0, 229, 21, -2140, -39},
+    {0, 208, 17, -2040, -34},
+    {0, 188, 14, -1940, -29},
+    {0, 169, 11, -1840, -25},
+    {0, 151, 9, -1740, -21},
+    {0, 135, 7, -1640, -18},
+    {0, 119, 6, -1540, -15},
+    {0, 104, 4, -1440, -12},
+    {0, 90, 3, -1340, -10},
+    {0, 77, 2, -1240, -8},
+    {0, 65, 2, -1140, -6},
+    {0, 54, 1, -1040, -4},
+    {0, 44, 1, -940, -3},
+    {0, 35, 0, -840, -2},
+    {0, 27, 0, -740, -2},
+    {0, 21, 0, -640, -1},
+    {0, 15, 0, -540, -1},
+    {0, 10, 0, -440, 0},
+    {0, 6, 0, -340, 0},
+    {0, 4, 0, -240, 0},
+    {0, 2, 0, -140, 0},
+    {0, 1, 0, -40, 0},
+    {0, 0, 0, 0, 0},
+};
+constexpr Trajectory sweepBack = {sweepBackPoints, 267, 10};
+
+}
@@ -0,0 +1,77 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       trajectory.h                                              */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Time parameterized trajectory tables for RAMSETE          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <stdint.h>
+
+/**
+ * One reference point of a trajectory, stored as fixed point to keep the tables small
+ * Generated on the host by sim/tools/trajgen, see the scales below
+ */
+struct TrajectoryPoint{
+    int16_t x;                  // hundredths of an inch
+    int16_t y;                  // hundredths of an inch
+    int16_t heading;            // hundredths of a degree, clockwise from +y, in [-180, 180]
+    int16_t velocity;           // hundredths of an inch per second, negative driving backwards
+    int16_t angularVelocity;    // tenths of a degree per second, clockwise
+};
+
+/**
+ * A reference point in floats and the units odom uses
+ */
+struct TrajectoryState{
+    float x;
+    float y;
+    float heading;
+    float velocity;
+    float angularVelocity;
+};
+
+/**
+ * A whole trajectory, one point every period milliseconds from its start
+ * A plain aggregate so the generated tables can be constexpr and live in flash.
+ */
+struct Trajectory{
+    const TrajectoryPoint* points;
+    int count;
+    int period;
+
+    static constexpr float positionScale = 100;
+    static constexpr float headingScale = 100;
+    static constexpr float velocityScale = 100;
+    static constexpr float angularVelocityScale = 10;
+
+    /**
+     * Looks up the reference at a time into the trajectory
+     *
+     * @param   time    seconds since the trajectory started
+     *
+     * @return  the point at or just before that time, the last one once it is over
+     */
+    TrajectoryState at(float time) const{
+        int index = (int)(time * 1000 / this->period);
+        if(index < 0) index = 0;
+        if(index > this->count - 1) index = this->count - 1;
+
+        const TrajectoryPoint& point = this->points[index];
+        TrajectoryState state;
+        state.x = point.x / positionScale;
+        state.y = point.y / positionScale;
+        state.heading = point.heading / headingScale;
+        state.velocity = point.velocity / velocityScale;
+        state.angularVelocity = point.angularVelocity / angularVelocityScale;
+        return state;
+    }
+
+    /**
+     * @return  the length of the trajectory, in seconds
+     */
+    float getDuration() const{
+        return (this->count - 1) * this->period / 1000.0f;
+    }
+};
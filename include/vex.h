@@ -18,4 +18,4 @@
   } while (!(condition))
 
 #define repeat(iterations)                                                     \
-  for (int iterator = 0; iterator < iterations; iterator++)
\ No newline at end of file
+  for (int iterator = 0; iterator < iterations; iterator++)
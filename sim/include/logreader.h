@@ -0,0 +1,76 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       logreader.h                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Host decoder for the binary telemetry log format          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/**
+ * Every record of one channel, one column per field
+ * Fields are kept quantized, value() gives them back in their units.
+ */
+struct LogColumns{
+    uint8_t id = 0;
+    std::string name;
+    std::vector<std::string> fieldNames;
+    std::vector<float> scales;
+
+    std::vector<uint32_t> timestamp;    // microseconds since the brain started
+    std::vector<uint8_t> source;
+    std::vector<uint16_t> sequence;
+    std::vector<std::vector<int32_t>> fields;
+
+    size_t size() const{ return this->timestamp.size(); }
+    float value(int field, size_t row) const{ return this->fields[field][row] / this->scales[field]; }
+};
+
+/**
+ * What reading a log ran into
+ */
+struct LogStats{
+    uint32_t blocks = 0;
+    uint32_t badBlocks = 0;         // failed their checksum and were skipped
+    uint32_t truncatedBlocks = 0;   // cut off by the end of the file, read up to the cut
+    uint64_t skippedBytes = 0;      // between blocks, searched past for a sync marker
+    uint64_t records = 0;
+    uint64_t dropped = 0;           // gaps in the sequence numbers, records the brain could not queue
+    uint64_t reportedDrops = 0;     // the same from the brain's own status records, counts drops at the end too
+};
+
+/**
+ * Reads a telemetry log written by the brain's Telemetry into columns
+ * The schema comes from the file's header, so logs from older code decode as
+ * long as the format version is known.
+ */
+class LogReader{
+    int version = 0;
+    std::vector<LogColumns> channels;
+    int channelIndex[16];
+    int32_t lastSequence[16];
+    std::vector<size_t> rows;
+    LogStats stats;
+
+    void countRecords(const uint8_t* in, const uint8_t* end);
+    bool readHeader(const uint8_t*& in, const uint8_t* end, std::string& error);
+    bool readBlock(const uint8_t*& in, const uint8_t* end);
+
+public:
+    LogReader();
+
+    bool read(const uint8_t* data, size_t size, std::string& error);
+    bool readFile(const char* path, std::string& error);
+
+    int getVersion() const;
+    const std::vector<LogColumns>& getChannels() const;
+    const LogColumns* getChannel(const char* name) const;
+    const LogStats& getStats() const;
+
+    bool writeCSV(const char* prefix, uint64_t* bytes = 0) const;
+    bool writeColumns(const char* prefix, uint64_t* bytes = 0) const;
+};
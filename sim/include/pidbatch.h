@@ -0,0 +1,73 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pidbatch.h                                                */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Structure of arrays PID that advances many controllers    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <vector>
+
+/**
+ * Columns of a PIDBatch, one entry per controller
+ * Shared with the kernels, which may live in translation units built for other instruction sets
+ */
+struct PIDBatchData{
+    float* Kp;
+    float* Ki;
+    float* Kd;
+    float* integralTolerance;
+    float* settleTolerance;
+    float* settleTime;
+    float* minOutput;
+    float* maxOutput;
+    float* cycleTime;
+    float* previousError;
+    float* integral;
+    float* timeSettled;
+};
+
+/**
+ * How a kernel gets each controller's dt and settle increment, matching the PID overloads
+ */
+enum class PIDBatchMode{
+    cycle,      // getOutput(error): dt of one update, settle by cycleTime
+    seconds,    // getOutputDt(error, dt)
+    fallback,   // getOutputDt(error, dt) with dt <= 0: each controller uses its own cycleTime
+};
+
+/**
+ * Many PIDs with the same policies as the PID class, advanced together with SIMD
+ * Gives exactly the outputs and settle state that the same number of PID objects
+ * would, so a gain sweep can be scored with it and replayed with PID.
+ * Storage is allocated once in the constructor.
+ */
+class PIDBatch{
+public:
+    enum Kernel{ automatic, scalar, sse, avx, neon };
+
+private:
+    int count;
+    std::vector<float> storage;
+    PIDBatchData data;
+    Kernel kernel = scalar;
+
+    void advance(const float* errors, float dt, PIDBatchMode mode, float* outputs, bool stopIOvershoot);
+
+public:
+    PIDBatch(int count);
+
+    bool setKernel(Kernel kernel);
+    Kernel getKernel();
+    static const char* getKernelName(Kernel kernel);
+    static bool isSupported(Kernel kernel);
+
+    void setConstants(int index, float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput, int cycleTime);
+    void reset();
+
+    void getOutputs(const float* errors, float* outputs, bool stopIOvershoot = true);
+    void getOutputsDt(const float* errors, float dt, float* outputs, bool stopIOvershoot = true);
+    bool isSettled(int index);
+    int size();
+};
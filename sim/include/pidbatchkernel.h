@@ -0,0 +1,133 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pidbatchkernel.h                                          */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  PID batch kernel shared by every instruction set          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <math.h>
+#include "pidbatch.h"
+
+/**
+ * The PID math written once against a small set of lane operations
+ * Each translation unit includes this with its own Lanes type and gets its own
+ * copy (everything here is static or in an anonymous namespace), so units
+ * built with different instruction set flags never share an instantiation.
+ *
+ * Every operation is done in the same order as PIDController::step with the
+ * PID policies, and clamping uses compares and selects rather than min/max,
+ * so signed zeros come out the same too.
+ */
+
+namespace {
+
+/**
+ * One controller at a time, also used for the tail that does not fill a vector
+ */
+struct ScalarLanes{
+    typedef float Vector;
+    typedef bool Mask;
+    static const int width = 1;
+
+    static Vector load(const float* p){ return *p; }
+    static void store(float* p, Vector v){ *p = v; }
+    static Vector set(float x){ return x; }
+    static Vector add(Vector a, Vector b){ return a + b; }
+    static Vector sub(Vector a, Vector b){ return a - b; }
+    static Vector mul(Vector a, Vector b){ return a * b; }
+    static Vector div(Vector a, Vector b){ return a / b; }
+    static Vector abs(Vector a){ return fabsf(a); }
+    static Mask less(Vector a, Vector b){ return a < b; }
+    static Mask greater(Vector a, Vector b){ return a > b; }
+    static Mask either(Mask a, Mask b){ return a || b; }
+    static Vector select(Mask mask, Vector a, Vector b){ return mask ? a : b; }
+};
+
+}
+
+/**
+ * Advances controllers [begin, end) by one update, end - begin must be a multiple of the lane width
+ *
+ * @param   data            the controller columns
+ * @param   begin           first controller
+ * @param   end             one past the last controller
+ * @param   errors          the error of each controller
+ * @param   dt              seconds since the last update, used in PIDBatchMode::seconds
+ * @param   outputs         where to store each output
+ * @param   stopIOvershoot  resets the integral when the error crosses zero
+ */
+template<class Lanes, PIDBatchMode mode>
+static void advancePIDBatch(PIDBatchData& data, int begin, int end, const float* errors, float dt, float* outputs, bool stopIOvershoot){
+    typedef typename Lanes::Vector Vector;
+    typedef typename Lanes::Mask Mask;
+    const Vector zero = Lanes::set(0);
+    const Vector one = Lanes::set(1);
+    const Vector thousand = Lanes::set(1000);
+    const Vector seconds = Lanes::set(dt);
+    const Vector secondsInMilliseconds = Lanes::set(dt * 1000);
+
+    for(int i = begin; i < end; i += Lanes::width){
+        Vector error = Lanes::load(errors + i);
+        Vector previousError = Lanes::load(data.previousError + i);
+
+        Vector step;
+        Vector milliseconds;
+        if(mode == PIDBatchMode::cycle){
+            step = one;
+            milliseconds = Lanes::load(data.cycleTime + i);
+        }
+        else if(mode == PIDBatchMode::seconds){
+            step = seconds;
+            milliseconds = secondsInMilliseconds;
+        }
+        else{
+            step = Lanes::div(Lanes::load(data.cycleTime + i), thousand);
+            milliseconds = Lanes::mul(step, thousand);
+        }
+
+        // ToleranceIntegral
+        Mask reset = Lanes::greater(Lanes::abs(error), Lanes::load(data.integralTolerance + i));
+        if(stopIOvershoot) reset = Lanes::either(Lanes::less(Lanes::mul(error, previousError), zero), reset);
+        Vector integral = Lanes::select(reset, zero, Lanes::add(Lanes::load(data.integral + i), Lanes::mul(error, step)));
+
+        // ErrorDerivative
+        Vector derivative = Lanes::div(Lanes::sub(error, previousError), step);
+
+        Vector output = Lanes::add(Lanes::add(Lanes::mul(Lanes::load(data.Kp + i), error), Lanes::mul(Lanes::load(data.Ki + i), integral)), \
+            Lanes::mul(Lanes::load(data.Kd + i), derivative));
+        // NoFeedforward adds zero, which turns -0 into +0
+        output = Lanes::add(output, zero);
+
+        Lanes::store(data.integral + i, integral);
+        Lanes::store(data.previousError + i, error);
+
+        // ToleranceSettle
+        Mask inside = Lanes::less(Lanes::abs(error), Lanes::load(data.settleTolerance + i));
+        Vector timeSettled = Lanes::select(inside, Lanes::add(Lanes::load(data.timeSettled + i), milliseconds), zero);
+        Lanes::store(data.timeSettled + i, timeSettled);
+
+        Vector maxOutput = Lanes::load(data.maxOutput + i);
+        Vector minOutput = Lanes::load(data.minOutput + i);
+        output = Lanes::select(Lanes::greater(output, maxOutput), maxOutput, output);
+        output = Lanes::select(Lanes::less(output, minOutput), minOutput, output);
+
+        // NoSlew
+        Lanes::store(outputs + i, output);
+    }
+}
+
+/**
+ * Runs the kernel for one lane type over as many whole vectors as fit
+ *
+ * @return  the number of controllers advanced, the rest are left for the scalar tail
+ */
+template<class Lanes>
+static int advancePIDBatchLanes(PIDBatchData& data, int count, const float* errors, float dt, PIDBatchMode mode, float* outputs, bool stopIOvershoot){
+    int end = count - count % Lanes::width;
+    if(mode == PIDBatchMode::cycle) advancePIDBatch<Lanes, PIDBatchMode::cycle>(data, 0, end, errors, dt, outputs, stopIOvershoot);
+    else if(mode == PIDBatchMode::seconds) advancePIDBatch<Lanes, PIDBatchMode::seconds>(data, 0, end, errors, dt, outputs, stopIOvershoot);
+    else advancePIDBatch<Lanes, PIDBatchMode::fallback>(data, 0, end, errors, dt, outputs, stopIOvershoot);
+    return end;
+}
@@ -0,0 +1,137 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       robot.h                                                   */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Simulated differential drive robot and its devices        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <random>
+#include "v5_vcs.h"
+
+namespace sim {
+
+/**
+ * Physical description of the simulated robot
+ * Lengths are in inches, the defaults are close to our 6 motor 450 rpm drive
+ */
+struct RobotConfig {
+    float trackWidth = 12.5;            // distance between the left and right wheels
+    float wheelDiameter = 3.25;
+    float wheelToMotor = 0.75;          // wheel rpm per motor cartridge rpm
+    float cartridgeRpm = 600;           // free speed of the motor cartridge
+    int motorsPerSide = 3;
+    float stallTorque = 0.35;           // N*m per motor at the cartridge output
+    float mass = 6.5;                   // kg
+    float inertia = 0.25;               // kg*m^2 about the tracking center
+    float linearDrag = 2.0;             // N per m/s
+    float angularDrag = 0.3;            // N*m per rad/s
+    float traction = 0.9;               // wheel friction coefficient, limits launch force before slipping
+
+    float verticalOffset = 0.5;         // vertical tracking wheel, inches right of the tracking center
+    float horizontalOffset = 2.0;       // horizontal tracking wheel, inches behind the tracking center
+    float trackingWheelDiameter = 2.0;
+
+    float gyroNoise = 0.02;             // standard deviation of each inertial reading, degrees
+    float gyroDrift = 0.0;              // heading drift, degrees per second
+    unsigned int seed = 1;
+};
+
+/**
+ * One simulated V5 smart motor
+ * The vex::motor command sets the mode, the physics writes position and velocity back
+ */
+struct Motor {
+    enum class Mode { stopped, voltage, velocity };
+
+    Mode mode = Mode::stopped;
+    vex::brakeType brake = vex::brakeType::coast;
+    float command = 0;          // volts or rpm depending on mode
+    float holdPosition = 0;     // degrees, latched when stopped with hold
+
+    float position = 0;         // degrees of the cartridge output
+    float zero = 0;             // degrees subtracted from position when read
+    float velocity = 0;         // rpm of the cartridge output
+    float cartridgeRpm = 600;
+
+    float voltage();
+    bool isShorted();
+};
+
+/**
+ * Passive tracking wheel read through a vex::rotation or vex::encoder
+ */
+class TrackingWheel {
+    float degrees = 0;
+    float zero = 0;
+    float resolution;
+public:
+    float rate = 0;             // degrees per second
+
+    TrackingWheel(float resolution) : resolution(resolution) {}
+    void advance(float deltaDegrees, float dt);
+    float read();
+    void set(float value);
+};
+
+class Robot;
+
+/**
+ * Simulated V5 inertial sensor
+ * Heading follows the true robot heading plus drift and per reading noise
+ */
+class Inertial {
+    Robot* robot;
+    float headingOffset = 0;
+    float rotationOffset = 0;
+    std::normal_distribution<float> noise;
+public:
+    Inertial(Robot* robot);
+    float rotation();
+    float heading();
+    void setRotation(float value);
+    void setHeading(float value);
+    float rate();
+};
+
+/**
+ * Differential drive model
+ * Each side is a set of DC motors driving a wheel with a traction limit.
+ * Position is in inches, heading is in radians measured clockwise from +y,
+ * which matches the odom convention.
+ */
+class Robot {
+public:
+    RobotConfig config;
+
+    Motor leftMotors[8];
+    Motor rightMotors[8];
+    TrackingWheel verticalWheel;
+    TrackingWheel horizontalWheel;
+    TrackingWheel verticalEncoder;
+    TrackingWheel horizontalEncoder;
+    Inertial imu;
+    std::mt19937 random;
+
+    float x = 0;
+    float y = 0;
+    float heading = 0;
+    float velocity = 0;         // forward, m/s
+    float angularVelocity = 0;  // clockwise, rad/s
+    float leftSlip = 0;         // wheel surface speed above ground speed, m/s
+    float rightSlip = 0;
+    float contactRate = 0;      // rotation from pushes during the last step, rad/s
+    double time = 0;            // seconds since the world started
+
+    Robot(const RobotConfig& config);
+    void step(float dt);
+    void push(float dx, float dy, float dHeading);
+    void setPose(float x, float y, float heading);
+
+private:
+    float contactTurn = 0;
+    float sideForce(Motor* motors, float surfaceSpeed, float& slip, float dt);
+};
+
+}
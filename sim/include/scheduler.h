@@ -0,0 +1,67 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       scheduler.h                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Virtual time cooperative scheduler for host builds        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <stdint.h>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace sim {
+
+class World;
+
+/**
+ * One vex::thread running inside a simulated world
+ */
+class Task {
+public:
+    uint64_t wake = 0;
+    uint64_t order = 0;
+    bool finished = false;
+    std::condition_variable turn;
+};
+
+/**
+ * VEXos runs tasks cooperatively, a task only gives up the cpu when it sleeps.
+ * The host scheduler does the same thing with real threads: exactly one task
+ * holds the turn, and sleeping hands the turn to the task with the earliest
+ * wake time. Time only moves when every task is asleep, so the world clock
+ * jumps straight to the next wake and the simulation runs as fast as the
+ * robot code can execute.
+ */
+class Scheduler {
+    World* world;
+    std::mutex lock;
+    std::vector<Task*> alive;
+    std::vector<Task*> owned;
+    Task* running;
+    uint64_t nextOrder = 0;
+    bool stopping = false;
+
+    void handOff(std::unique_lock<std::mutex>& guard, Task* self);
+public:
+    Scheduler(World* world);
+    ~Scheduler();
+
+    Task* spawn(std::function<void()> body);
+    void sleep(uint64_t microseconds);
+    void join(Task* task);
+    bool shutdown(uint64_t graceMicroseconds);
+
+    static Task* current();
+};
+
+/**
+ * Thrown out of sleep() in every background task when the world shuts down
+ * so loops such as odom::start unwind without needing to be stopped by hand
+ */
+struct Shutdown {};
+
+}
@@ -0,0 +1,41 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       screen.h                                                  */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Software framebuffer standing in for the brain screen     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include <stdint.h>
+
+namespace sim {
+
+/**
+ * 480x240 framebuffer with the same drawing calls as vex::brain::lcd
+ * Counts draw calls so graph code can be profiled off the brain
+ */
+class Screen {
+public:
+    static const int width = 480;
+    static const int height = 240;
+
+    uint32_t pixels[width * height];
+    uint32_t penColor = 0xFFFFFF;
+    uint32_t fillColor = 0;
+    int penWidth = 1;
+
+    uint64_t drawCalls = 0;
+    uint64_t pixelsWritten = 0;
+    uint64_t frames = 0;
+
+    Screen();
+    void clear(uint32_t color);
+    void pixel(int x, int y, uint32_t color);
+    void line(int x1, int y1, int x2, int y2);
+    void rectangle(int x, int y, int w, int h);
+    void circle(int x, int y, int radius);
+    bool writePPM(const char* path);
+};
+
+}
@@ -0,0 +1,37 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       v5.h                                                      */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Host stand-in for the V5 SDK C header                     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+/**
+ * The host build only needs the port numbers from the SDK C layer,
+ * everything else lives in the vex namespace declared in v5_vcs.h
+ */
+#include <stdint.h>
+
+#define PORT1   0
+#define PORT2   1
+#define PORT3   2
+#define PORT4   3
+#define PORT5   4
+#define PORT6   5
+#define PORT7   6
+#define PORT8   7
+#define PORT9   8
+#define PORT10  9
+#define PORT11  10
+#define PORT12  11
+#define PORT13  12
+#define PORT14  13
+#define PORT15  14
+#define PORT16  15
+#define PORT17  16
+#define PORT18  17
+#define PORT19  18
+#define PORT20  19
+#define PORT21  20
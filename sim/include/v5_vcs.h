@@ -0,0 +1,230 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       v5_vcs.h                                                  */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Host stand-in for the subset of the vex:: API we use      */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+
+/**
+ * Every robot class talks to hardware through the vex:: device classes.
+ * On the brain those come from the SDK, on the host this header declares
+ * the same names with the same signatures and routes them to a simulated
+ * robot (see world.h). Only the calls the robot code actually uses are here,
+ * add more as they are needed.
+ */
+#include <stdint.h>
+#include <vector>
+
+namespace sim {
+    struct Motor;
+    class Inertial;
+    class TrackingWheel;
+    class Screen;
+    class Task;
+}
+
+namespace vex {
+
+/* ---------- Units ---------- */
+enum class directionType { fwd = 0, rev, undefined };
+enum class brakeType { coast = 0, brake, hold, undefined };
+enum class velocityUnits { pct = 0, rpm, dps, raw };
+enum class voltageUnits { volt = 0, mV };
+enum class percentUnits { pct = 0 };
+enum class rotationUnits { deg = 0, rev, raw };
+enum class timeUnits { sec = 0, msec };
+enum class turnType { left = 0, right };
+enum class axisType { xaxis = 0, yaxis, zaxis };
+enum class ledState { off = 0, on };
+
+const directionType fwd = directionType::fwd;
+const directionType forward = directionType::fwd;
+const directionType reverse = directionType::rev;
+const velocityUnits rpm = velocityUnits::rpm;
+const velocityUnits dps = velocityUnits::dps;
+const percentUnits percent = percentUnits::pct;
+const rotationUnits degrees = rotationUnits::deg;
+const rotationUnits turns = rotationUnits::rev;
+const voltageUnits volt = voltageUnits::volt;
+const timeUnits msec = timeUnits::msec;
+const timeUnits seconds = timeUnits::sec;
+const brakeType coast = brakeType::coast;
+const brakeType brake = brakeType::brake;
+const brakeType hold = brakeType::hold;
+
+/* ---------- Color ---------- */
+class color {
+    uint32_t value;
+public:
+    color() : value(0) {}
+    color(int value) : value((uint32_t)value) {}
+    color(int r, int g, int b) : value(((r & 0xFF) << 16) | ((g & 0xFF) << 8) | (b & 0xFF)) {}
+    uint32_t rgb() const { return this->value; }
+
+    static const color black;
+    static const color white;
+    static const color red;
+    static const color green;
+    static const color blue;
+    static const color yellow;
+    static const color orange;
+    static const color purple;
+    static const color cyan;
+};
+
+/* ---------- Devices ---------- */
+class motor {
+    sim::Motor* device;
+public:
+    motor(sim::Motor* device);
+
+    void spin(directionType dir, double velocity, velocityUnits units);
+    void spin(directionType dir, double velocity, percentUnits units);
+    void spin(directionType dir, double voltage, voltageUnits units);
+    void stop(brakeType mode);
+    void stop();
+
+    double position(rotationUnits units);
+    void setPosition(double value, rotationUnits units);
+    double velocity(velocityUnits units);
+    double voltage(voltageUnits units = voltageUnits::volt);
+};
+
+class motor_group {
+    std::vector<motor> motors;
+public:
+    motor_group() {}
+    motor_group(const std::vector<motor>& motors) : motors(motors) {}
+    template<typename... Args> motor_group(motor& first, Args&... others) : motors{first, others...} {}
+
+    void spin(directionType dir, double velocity, velocityUnits units);
+    void spin(directionType dir, double velocity, percentUnits units);
+    void spin(directionType dir, double voltage, voltageUnits units);
+    void stop(brakeType mode);
+    void stop();
+
+    double position(rotationUnits units);
+    void setPosition(double value, rotationUnits units);
+    double velocity(velocityUnits units);
+    int32_t count() { return (int32_t)this->motors.size(); }
+};
+
+class rotation {
+    sim::TrackingWheel* device;
+public:
+    rotation(sim::TrackingWheel* device) : device(device) {}
+
+    double position(rotationUnits units);
+    void setPosition(double value, rotationUnits units);
+    void resetPosition() { this->setPosition(0, rotationUnits::deg); }
+    double velocity(velocityUnits units);
+};
+
+class encoder {
+    sim::TrackingWheel* device;
+public:
+    encoder(sim::TrackingWheel* device) : device(device) {}
+
+    double position(rotationUnits units);
+    void setPosition(double value, rotationUnits units);
+    void resetRotation() { this->setPosition(0, rotationUnits::deg); }
+    double velocity(velocityUnits units);
+};
+
+class inertial {
+    sim::Inertial* device;
+public:
+    inertial(sim::Inertial* device) : device(device) {}
+
+    double heading(rotationUnits units = rotationUnits::deg);
+    double rotation(rotationUnits units = rotationUnits::deg);
+    void setHeading(double value, rotationUnits units);
+    void setRotation(double value, rotationUnits units);
+    double gyroRate(axisType axis, velocityUnits units);
+    void calibrate() {}
+    bool isCalibrating() { return false; }
+};
+
+class brain {
+public:
+    class lcd {
+        sim::Screen* device;
+    public:
+        lcd(sim::Screen* device) : device(device) {}
+
+        void setPenColor(const color& value);
+        void setFillColor(const color& value);
+        void setPenWidth(uint32_t width);
+        void drawPixel(int x, int y);
+        void drawLine(int x1, int y1, int x2, int y2);
+        void drawRectangle(int x, int y, int width, int height);
+        void drawCircle(int x, int y, int radius);
+        void clearScreen();
+        void clearScreen(const color& value);
+        bool render();
+        bool render(bool bVsyncWait, bool bRunScheduler = true);
+    };
+
+    /**
+     * Files go to the host's working directory, there is always a card inserted
+     */
+    class sdcard {
+    public:
+        sdcard() {}
+
+        bool isInserted() { return true; }
+        int32_t savefile(const char* name, uint8_t* buffer, int32_t len);
+        int32_t appendfile(const char* name, uint8_t* buffer, int32_t len);
+        int32_t size(const char* name);
+        bool exists(const char* name);
+    };
+};
+
+/* ---------- Time and tasks ---------- */
+class timer {
+public:
+    static uint32_t system();
+    static uint64_t systemHighResolution();
+};
+
+class thread {
+    sim::Task* handle;
+    void launch(int (*callback)(void*), void* arg);
+public:
+    static const int32_t threadPriorityLow = 1;
+    static const int32_t threadPriorityNormal = 7;
+    static const int32_t threadPriorityHigh = 15;
+
+    thread() : handle(0) {}
+    thread(void (*callback)(void));
+    thread(int (*callback)(void));
+    thread(int (*callback)(void*), void* arg);
+
+    void join();
+    bool joinable() { return this->handle != 0; }
+    void detach() {}
+    void interrupt() {}
+    void setPriority(int32_t priority) {}
+};
+
+class task : public thread {
+public:
+    task() {}
+    task(int (*callback)(void)) : thread(callback) {}
+    task(int (*callback)(void*), void* arg) : thread(callback, arg) {}
+
+    static void sleep(uint32_t time);
+};
+
+namespace this_thread {
+    void sleep_for(uint32_t time);
+    void sleep_until(uint32_t time);
+    void yield();
+}
+
+void wait(double time, timeUnits units);
+
+}
@@ -0,0 +1,54 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       world.h                                                   */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Simulated world that owns the robot, clock and devices    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#pragma once
+#include "robot.h"
+#include "scheduler.h"
+#include "screen.h"
+
+namespace sim {
+
+/**
+ * A world is one simulated robot with its own clock and tasks.
+ * Create it on the thread that will drive the episode, every vex:: call made
+ * from that thread (or from vex::threads it starts) goes to this world.
+ * Several worlds can run at once on different host threads.
+ */
+class World {
+    Scheduler scheduler;
+    uint64_t now = 0;
+    uint64_t stepMicroseconds;
+    std::vector<Motor*> freeMotors;
+
+public:
+    Robot robot;
+    Screen display;
+
+    vex::motor_group Left;
+    vex::motor_group Right;
+    vex::rotation VerticalRotation;
+    vex::rotation HorizontalRotation;
+    vex::encoder VerticalEncoder;
+    vex::encoder HorizontalEncoder;
+    vex::inertial Inertial;
+    vex::brain::lcd Brain_Screen;
+
+    World(const RobotConfig& config = RobotConfig(), uint64_t stepMicroseconds = 1000);
+    ~World();
+
+    vex::motor motor(int port);
+
+    uint64_t time() { return this->now; }
+    void advanceTo(uint64_t time);
+    void run(float seconds);
+
+    Scheduler& tasks() { return this->scheduler; }
+    static World* current();
+};
+
+}
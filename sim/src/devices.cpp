@@ -0,0 +1,334 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       devices.cpp                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Host implementation of the vex:: device classes           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <chrono>
+#include <thread>
+#include "world.h"
+
+namespace vex {
+
+const color color::black = color(0, 0, 0);
+const color color::white = color(255, 255, 255);
+const color color::red = color(255, 0, 0);
+const color color::green = color(0, 255, 0);
+const color color::blue = color(0, 0, 255);
+const color color::yellow = color(255, 255, 0);
+const color color::orange = color(255, 165, 0);
+const color color::purple = color(128, 0, 128);
+const color color::cyan = color(0, 255, 255);
+
+/**
+ * Private function that converts degrees into the requested rotation unit
+ */
+static double fromDegrees(double value, rotationUnits units){
+    if(units == rotationUnits::rev) return value / 360;
+    if(units == rotationUnits::raw) return value * 10;
+    return value;
+}
+
+static double toDegrees(double value, rotationUnits units){
+    if(units == rotationUnits::rev) return value * 360;
+    if(units == rotationUnits::raw) return value / 10;
+    return value;
+}
+
+/* ---------- Motor ---------- */
+motor::motor(sim::Motor* device){
+    this->device = device;
+}
+
+void motor::spin(directionType dir, double velocity, velocityUnits units){
+    double rpm = velocity;
+    if(units == velocityUnits::pct) rpm = velocity / 100 * this->device->cartridgeRpm;
+    if(units == velocityUnits::dps) rpm = velocity / 6;
+    this->device->mode = sim::Motor::Mode::velocity;
+    this->device->command = dir == directionType::rev ? -rpm : rpm;
+}
+
+void motor::spin(directionType dir, double velocity, percentUnits units){
+    this->spin(dir, velocity, velocityUnits::pct);
+}
+
+void motor::spin(directionType dir, double voltage, voltageUnits units){
+    double volts = units == voltageUnits::mV ? voltage / 1000 : voltage;
+    this->device->mode = sim::Motor::Mode::voltage;
+    this->device->command = dir == directionType::rev ? -volts : volts;
+}
+
+void motor::stop(brakeType mode){
+    if(this->device->mode != sim::Motor::Mode::stopped || this->device->brake != mode) this->device->holdPosition = this->device->position;
+    this->device->mode = sim::Motor::Mode::stopped;
+    this->device->brake = mode;
+}
+
+void motor::stop(){
+    this->stop(this->device->brake);
+}
+
+double motor::position(rotationUnits units){
+    return fromDegrees(this->device->position - this->device->zero, units);
+}
+
+void motor::setPosition(double value, rotationUnits units){
+    this->device->zero = this->device->position - toDegrees(value, units);
+}
+
+double motor::velocity(velocityUnits units){
+    if(units == velocityUnits::pct) return this->device->velocity / this->device->cartridgeRpm * 100;
+    if(units == velocityUnits::dps) return this->device->velocity * 6;
+    return this->device->velocity;
+}
+
+double motor::voltage(voltageUnits units){
+    double volts = this->device->isShorted() ? this->device->voltage() : 0;
+    return units == voltageUnits::mV ? volts * 1000 : volts;
+}
+
+/* ---------- Motor Group ---------- */
+void motor_group::spin(directionType dir, double velocity, velocityUnits units){
+    for(motor& m : this->motors) m.spin(dir, velocity, units);
+}
+
+void motor_group::spin(directionType dir, double velocity, percentUnits units){
+    for(motor& m : this->motors) m.spin(dir, velocity, units);
+}
+
+void motor_group::spin(directionType dir, double voltage, voltageUnits units){
+    for(motor& m : this->motors) m.spin(dir, voltage, units);
+}
+
+void motor_group::stop(brakeType mode){
+    for(motor& m : this->motors) m.stop(mode);
+}
+
+void motor_group::stop(){
+    for(motor& m : this->motors) m.stop();
+}
+
+double motor_group::position(rotationUnits units){
+    return this->motors.empty() ? 0 : this->motors.front().position(units);
+}
+
+void motor_group::setPosition(double value, rotationUnits units){
+    for(motor& m : this->motors) m.setPosition(value, units);
+}
+
+double motor_group::velocity(velocityUnits units){
+    return this->motors.empty() ? 0 : this->motors.front().velocity(units);
+}
+
+/* ---------- Tracking Sensors ---------- */
+double rotation::position(rotationUnits units){
+    return fromDegrees(this->device->read(), units);
+}
+
+void rotation::setPosition(double value, rotationUnits units){
+    this->device->set(toDegrees(value, units));
+}
+
+double rotation::velocity(velocityUnits units){
+    if(units == velocityUnits::rpm) return this->device->rate / 6;
+    return this->device->rate;
+}
+
+double encoder::position(rotationUnits units){
+    return fromDegrees(this->device->read(), units);
+}
+
+void encoder::setPosition(double value, rotationUnits units){
+    this->device->set(toDegrees(value, units));
+}
+
+double encoder::velocity(velocityUnits units){
+    if(units == velocityUnits::rpm) return this->device->rate / 6;
+    return this->device->rate;
+}
+
+/* ---------- Inertial ---------- */
+double inertial::heading(rotationUnits units){
+    return fromDegrees(this->device->heading(), units);
+}
+
+double inertial::rotation(rotationUnits units){
+    return fromDegrees(this->device->rotation(), units);
+}
+
+void inertial::setHeading(double value, rotationUnits units){
+    this->device->setHeading(toDegrees(value, units));
+}
+
+void inertial::setRotation(double value, rotationUnits units){
+    this->device->setRotation(toDegrees(value, units));
+}
+
+double inertial::gyroRate(axisType axis, velocityUnits units){
+    if(axis != axisType::zaxis) return 0;
+    if(units == velocityUnits::rpm) return this->device->rate() / 6;
+    return this->device->rate();
+}
+
+/* ---------- Screen ---------- */
+void brain::lcd::setPenColor(const color& value){
+    this->device->penColor = value.rgb();
+}
+
+void brain::lcd::setFillColor(const color& value){
+    this->device->fillColor = value.rgb();
+}
+
+void brain::lcd::setPenWidth(uint32_t width){
+    this->device->penWidth = width;
+}
+
+void brain::lcd::drawPixel(int x, int y){
+    this->device->drawCalls++;
+    this->device->pixel(x, y, this->device->penColor);
+}
+
+void brain::lcd::drawLine(int x1, int y1, int x2, int y2){
+    this->device->line(x1, y1, x2, y2);
+}
+
+void brain::lcd::drawRectangle(int x, int y, int width, int height){
+    this->device->rectangle(x, y, width, height);
+}
+
+void brain::lcd::drawCircle(int x, int y, int radius){
+    this->device->circle(x, y, radius);
+}
+
+void brain::lcd::clearScreen(){
+    this->device->clear(0);
+}
+
+void brain::lcd::clearScreen(const color& value){
+    this->device->clear(value.rgb());
+}
+
+bool brain::lcd::render(){
+    this->device->frames++;
+    return true;
+}
+
+bool brain::lcd::render(bool bVsyncWait, bool bRunScheduler){
+    return this->render();
+}
+
+/* ---------- SD card ---------- */
+/**
+ * Private function that writes a buffer to a host file opened in a mode
+ */
+static int32_t writeFile(const char* name, const char* mode, uint8_t* buffer, int32_t len){
+    FILE* file = fopen(name, mode);
+    if(!file) return 0;
+    int32_t written = len > 0 ? (int32_t)fwrite(buffer, 1, len, file) : 0;
+    fclose(file);
+    return written;
+}
+
+int32_t brain::sdcard::savefile(const char* name, uint8_t* buffer, int32_t len){
+    return writeFile(name, "wb", buffer, len);
+}
+
+int32_t brain::sdcard::appendfile(const char* name, uint8_t* buffer, int32_t len){
+    return writeFile(name, "ab", buffer, len);
+}
+
+int32_t brain::sdcard::size(const char* name){
+    FILE* file = fopen(name, "rb");
+    if(!file) return 0;
+    fseek(file, 0, SEEK_END);
+    int32_t bytes = (int32_t)ftell(file);
+    fclose(file);
+    return bytes;
+}
+
+bool brain::sdcard::exists(const char* name){
+    FILE* file = fopen(name, "rb");
+    if(file) fclose(file);
+    return file != 0;
+}
+
+/* ---------- Time ---------- */
+uint64_t timer::systemHighResolution(){
+    sim::World* world = sim::World::current();
+    if(world) return world->time();
+
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint32_t timer::system(){
+    return (uint32_t)(timer::systemHighResolution() / 1000);
+}
+
+/**
+ * Private function that sleeps in virtual time inside a world, real time outside of one
+ */
+static void sleepMicroseconds(uint64_t microseconds){
+    sim::World* world = sim::World::current();
+    if(world && sim::Scheduler::current()) world->tasks().sleep(microseconds);
+    else std::this_thread::sleep_for(std::chrono::microseconds(microseconds));
+}
+
+/* ---------- Tasks ---------- */
+static int runVoid(void* callback){
+    ((void (*)(void))callback)();
+    return 0;
+}
+
+static int runInt(void* callback){
+    return ((int (*)(void))callback)();
+}
+
+void thread::launch(int (*callback)(void*), void* arg){
+    sim::World* world = sim::World::current();
+    this->handle = 0;
+    if(world) this->handle = world->tasks().spawn([callback, arg]{ callback(arg); });
+    else std::thread([callback, arg]{ callback(arg); }).detach();
+}
+
+thread::thread(void (*callback)(void)){
+    this->launch(runVoid, (void*)callback);
+}
+
+thread::thread(int (*callback)(void)){
+    this->launch(runInt, (void*)callback);
+}
+
+thread::thread(int (*callback)(void*), void* arg){
+    this->launch(callback, arg);
+}
+
+void thread::join(){
+    sim::World* world = sim::World::current();
+    if(world && this->handle) world->tasks().join(this->handle);
+}
+
+void task::sleep(uint32_t time){
+    sleepMicroseconds((uint64_t)time * 1000);
+}
+
+void this_thread::sleep_for(uint32_t time){
+    sleepMicroseconds((uint64_t)time * 1000);
+}
+
+void this_thread::sleep_until(uint32_t time){
+    uint32_t now = timer::system();
+    if(time > now) sleepMicroseconds((uint64_t)(time - now) * 1000);
+}
+
+void this_thread::yield(){
+    sleepMicroseconds(0);
+}
+
+void wait(double time, timeUnits units){
+    sleepMicroseconds((uint64_t)(units == timeUnits::sec ? time * 1e6 : time * 1e3));
+}
+
+}
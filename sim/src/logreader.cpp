@@ -0,0 +1,449 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       logreader.cpp                                             */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Host decoder for the binary telemetry log format          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "logreader.h"
+#include "logformat.h"
+
+LogReader::LogReader(){
+    for(int i = 0; i < 16; i++){
+        this->channelIndex[i] = -1;
+        this->lastSequence[i] = -1;
+    }
+}
+
+/**
+ * Private function that reads a length prefixed name
+ */
+static bool getName(const uint8_t*& in, const uint8_t* end, std::string& name){
+    if(in >= end || in + 1 + *in > end) return false;
+    name.assign((const char*)in + 1, *in);
+    in += 1 + *in;
+    return true;
+}
+
+/**
+ * Private function that reads the magic, version and schema
+ */
+bool LogReader::readHeader(const uint8_t*& in, const uint8_t* end, std::string& error){
+    if(end - in < 6 || memcmp(in, logformat::magic, 4) != 0){
+        error = "not a telemetry log";
+        return false;
+    }
+    this->version = in[4];
+    if(this->version < 1 || this->version > logformat::version){
+        error = "unknown log version " + std::to_string(this->version);
+        return false;
+    }
+    int count = in[5];
+    in += 6;
+
+    for(int i = 0; i < count; i++){
+        if(end - in < 2){
+            error = "log header cut off";
+            return false;
+        }
+        LogColumns channel;
+        channel.id = in[0];
+        int fields = in[1];
+        in += 2;
+        bool ok = fields <= logformat::maxFields && channel.id < 16 && getName(in, end, channel.name);
+        for(int j = 0; ok && j < fields; j++){
+            std::string name;
+            ok = getName(in, end, name) && end - in >= 4;
+            if(!ok) break;
+            float scale;
+            memcpy(&scale, in, 4);
+            in += 4;
+            channel.fieldNames.push_back(name);
+            channel.scales.push_back(scale);
+        }
+        if(!ok){
+            error = "bad channel in log header";
+            return false;
+        }
+        channel.fields.resize(fields);
+        this->channelIndex[channel.id] = this->channels.size();
+        this->channels.push_back(channel);
+    }
+    return true;
+}
+
+/**
+ * Private function that sizes every column of a channel
+ */
+static void resizeColumns(LogColumns& channel, size_t rows){
+    channel.timestamp.resize(rows);
+    channel.source.resize(rows);
+    channel.sequence.resize(rows);
+    for(std::vector<int32_t>& field : channel.fields) field.resize(rows);
+}
+
+/**
+ * Private function that counts each channel's records without decoding them, so the columns are sized once
+ * Damaged blocks can make the counts a little off, decoding grows or trims the columns to fit.
+ */
+void LogReader::countRecords(const uint8_t* in, const uint8_t* end){
+    std::vector<size_t> counts(this->channels.size());
+    while(end - in >= 4){
+        if(memcmp(in, logformat::syncMarker, 4) != 0){
+            in++;
+            continue;
+        }
+        in += 4;
+        uint32_t payloadLength;
+        uint32_t count;
+        uint32_t base;
+        if(!logformat::getVarint(in, end, payloadLength) || !logformat::getVarint(in, end, count) || !logformat::getVarint(in, end, base)) break;
+        const uint8_t* payloadEnd = (size_t)(end - in) < payloadLength ? end : in + payloadLength;
+        for(uint32_t i = 0; i < count && in < payloadEnd; i++){
+            int index = this->channelIndex[*in++ & 15];
+            if(index < 0) break;
+            int varints = 2 + this->channels[index].fields.size();
+            while(varints > 0 && in < payloadEnd) if(!(*in++ & 0x80)) varints--;
+            counts[index]++;
+        }
+        in = payloadEnd;
+    }
+    for(size_t i = 0; i < this->channels.size(); i++) resizeColumns(this->channels[i], counts[i]);
+}
+
+/**
+ * Private function that reads one block, in points at its sync marker
+ * A block that fails its checksum, or claims to run past the end of the file with another
+ * block after it, is skipped by moving one byte on so the next sync marker is searched for.
+ *
+ * @return  false once the end of the file is reached
+ */
+bool LogReader::readBlock(const uint8_t*& in, const uint8_t* end){
+    const uint8_t* start = in;
+    uint32_t payloadLength;
+    uint32_t count;
+    uint32_t base;
+    in += 4;
+    if(!logformat::getVarint(in, end, payloadLength) || !logformat::getVarint(in, end, count) || !logformat::getVarint(in, end, base)){
+        this->stats.truncatedBlocks++;
+        in = end;
+        return false;
+    }
+
+    const uint8_t* payload = in;
+    const uint8_t* payloadEnd = end;
+    bool truncated = (size_t)(end - payload) < (size_t)payloadLength + 2;
+    if(truncated){
+        // only the last block can be cut off, a later sync marker means this length is damaged
+        for(const uint8_t* next = payload; end - next >= 4; next++){
+            if(memcmp(next, logformat::syncMarker, 4) == 0){
+                this->stats.badBlocks++;
+                in = start + 1;
+                return true;
+            }
+        }
+    }
+    else{
+        payloadEnd = payload + payloadLength;
+        uint16_t sum = payloadEnd[0] | payloadEnd[1] << 8;
+        const uint8_t* summed = this->version >= 2 ? start + 4 : payload;
+        if(logformat::checksum(summed, payloadEnd - summed) != sum){
+            this->stats.badBlocks++;
+            in = start + 1;
+            return true;
+        }
+    }
+
+    int32_t previous[16][logformat::maxFields] = {};
+    bool seen[16] = {};
+    uint32_t time = base;
+    int32_t values[logformat::maxFields];
+    const uint8_t* cursor = payload;
+    for(uint32_t i = 0; i < count; i++){
+        // decoded into locals first, a record cut off by the end of the file is not kept
+        if(cursor >= payloadEnd) break;
+        int source = *cursor >> 4;
+        int channelId = *cursor & 15;
+        cursor++;
+        int index = this->channelIndex[channelId];
+        if(index < 0) break;
+        LogColumns& channel = this->channels[index];
+
+        uint32_t sequenceField;
+        uint32_t timeField;
+        if(!logformat::getVarint(cursor, payloadEnd, sequenceField) || !logformat::getVarint(cursor, payloadEnd, timeField)) break;
+        bool complete = true;
+        int fields = channel.fields.size();
+        for(int j = 0; j < fields; j++){
+            uint32_t delta;
+            if(!logformat::getVarint(cursor, payloadEnd, delta)){
+                complete = false;
+                break;
+            }
+            values[j] = (int32_t)((uint32_t)previous[channelId][j] + (uint32_t)logformat::unzigzag(delta));
+        }
+        if(!complete) break;
+
+        uint16_t sequence;
+        if(seen[source]) sequence = (uint16_t)(this->lastSequence[source] + sequenceField + 1);
+        else sequence = (uint16_t)sequenceField;
+        if(this->lastSequence[source] >= 0) this->stats.dropped += (uint16_t)(sequence - this->lastSequence[source] - 1);
+        this->lastSequence[source] = sequence;
+        seen[source] = true;
+
+        time += (uint32_t)logformat::unzigzag(timeField);
+        size_t row = this->rows[index]++;
+        if(row >= channel.size()) resizeColumns(channel, row * 2 + 64);
+        for(int j = 0; j < fields; j++){
+            previous[channelId][j] = values[j];
+            channel.fields[j][row] = values[j];
+        }
+        channel.timestamp[row] = time;
+        channel.source[row] = source;
+        channel.sequence[row] = sequence;
+        this->stats.records++;
+    }
+
+    this->stats.blocks++;
+    if(truncated){
+        this->stats.truncatedBlocks++;
+        in = end;
+        return false;
+    }
+    in = payloadEnd + 2;
+    return true;
+}
+
+/**
+ * Decodes a whole log from memory, replacing anything read before
+ *
+ * @param   data    the log's bytes
+ * @param   size    the number of bytes
+ * @param   error   why the log could not be read
+ *
+ * @return  false if the header is unreadable, damaged blocks only show up in the stats
+ */
+bool LogReader::read(const uint8_t* data, size_t size, std::string& error){
+    *this = LogReader();
+    const uint8_t* in = data;
+    const uint8_t* end = data + size;
+    if(!this->readHeader(in, end, error)) return false;
+
+    this->countRecords(in, end);
+    this->rows.assign(this->channels.size(), 0);
+
+    while(end - in >= 4){
+        if(memcmp(in, logformat::syncMarker, 4) != 0){
+            const uint8_t* next = in + 1;
+            while(end - next >= 4 && memcmp(next, logformat::syncMarker, 4) != 0) next++;
+            if(end - next < 4) next = end;
+            this->stats.skippedBytes += next - in;
+            in = next;
+            continue;
+        }
+        if(!this->readBlock(in, end)) break;
+    }
+    if(in < end) this->stats.skippedBytes += end - in;
+    for(size_t i = 0; i < this->channels.size(); i++) resizeColumns(this->channels[i], this->rows[i]);
+
+    // each status record has a ring's running total, the last one of each ring is its total
+    const LogColumns* status = this->getChannel("status");
+    if(status && status->fields.size() >= 2){
+        float drops[16] = {};
+        for(size_t row = 0; row < status->size(); row++){
+            int ring = status->fields[0][row];
+            if(ring >= 0 && ring < 16) drops[ring] = status->value(1, row);
+        }
+        for(int i = 0; i < 16; i++) this->stats.reportedDrops += drops[i];
+    }
+    return true;
+}
+
+/**
+ * Decodes a log file
+ */
+bool LogReader::readFile(const char* path, std::string& error){
+    FILE* file = fopen(path, "rb");
+    if(!file){
+        error = std::string("cannot open ") + path;
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    std::vector<uint8_t> data(size > 0 ? size : 0);
+    size_t got = data.empty() ? 0 : fread(data.data(), 1, data.size(), file);
+    fclose(file);
+    return this->read(data.data(), got, error);
+}
+
+int LogReader::getVersion() const{
+    return this->version;
+}
+
+const std::vector<LogColumns>& LogReader::getChannels() const{
+    return this->channels;
+}
+
+const LogColumns* LogReader::getChannel(const char* name) const{
+    for(const LogColumns& channel : this->channels) if(channel.name == name) return &channel;
+    return 0;
+}
+
+const LogStats& LogReader::getStats() const{
+    return this->stats;
+}
+
+/**
+ * Private function that appends an integer, written out by hand since snprintf is most of the cost of a CSV
+ */
+static char* putInteger(char* out, uint64_t value){
+    char digits[20];
+    int count = 0;
+    do{
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    } while(value);
+    while(count) *out++ = digits[--count];
+    return out;
+}
+
+/**
+ * Private function that appends a quantized value with as many decimals as its scale keeps
+ */
+static char* putQuantized(char* out, int32_t value, float scale, int decimals){
+    if(decimals < 0) return out + sprintf(out, "%.9g", value / scale);
+
+    uint64_t magnitude = value < 0 ? -(int64_t)value : value;
+    if(value < 0) *out++ = '-';
+    uint64_t unit = 1;
+    for(int i = 0; i < decimals; i++) unit *= 10;
+    out = putInteger(out, magnitude / unit);
+    if(decimals > 0){
+        *out++ = '.';
+        uint64_t fraction = magnitude % unit;
+        for(int i = decimals - 1; i >= 0; i--){
+            out[i] = '0' + fraction % 10;
+            fraction /= 10;
+        }
+        out += decimals;
+    }
+    return out;
+}
+
+/**
+ * Private function that gives the decimals a power of ten scale keeps, or -1 for any other scale
+ */
+static int decimalsOf(float scale){
+    float unit = 1;
+    for(int decimals = 0; decimals <= 9; decimals++){
+        if(scale == unit) return decimals;
+        unit *= 10;
+    }
+    return -1;
+}
+
+/**
+ * Writes one CSV per channel, named prefix_channel.csv
+ * Values are written with exactly the precision the log kept them at.
+ *
+ * @param   prefix  the start of every file name
+ * @param   bytes   if not 0, set to the bytes written
+ *
+ * @return  false if a file could not be written
+ */
+bool LogReader::writeCSV(const char* prefix, uint64_t* bytes) const{
+    uint64_t total = 0;
+    std::vector<char> buffer(1 << 20);
+    for(const LogColumns& channel : this->channels){
+        if(channel.size() == 0) continue;
+        std::string path = std::string(prefix) + "_" + channel.name + ".csv";
+        FILE* file = fopen(path.c_str(), "wb");
+        if(!file) return false;
+
+        std::string header = "time_us,source,sequence";
+        for(const std::string& name : channel.fieldNames) header += "," + name;
+        header += "\n";
+        fwrite(header.data(), 1, header.size(), file);
+        total += header.size();
+
+        int fields = channel.fields.size();
+        std::vector<int> decimals(fields);
+        for(int j = 0; j < fields; j++) decimals[j] = decimalsOf(channel.scales[j]);
+
+        char* out = buffer.data();
+        char* flushAt = buffer.data() + buffer.size() - 256;
+        for(size_t row = 0; row < channel.size(); row++){
+            out = putInteger(out, channel.timestamp[row]);
+            *out++ = ',';
+            out = putInteger(out, channel.source[row]);
+            *out++ = ',';
+            out = putInteger(out, channel.sequence[row]);
+            for(int j = 0; j < fields; j++){
+                *out++ = ',';
+                out = putQuantized(out, channel.fields[j][row], channel.scales[j], decimals[j]);
+            }
+            *out++ = '\n';
+            if(out >= flushAt){
+                fwrite(buffer.data(), 1, out - buffer.data(), file);
+                total += out - buffer.data();
+                out = buffer.data();
+            }
+        }
+        fwrite(buffer.data(), 1, out - buffer.data(), file);
+        total += out - buffer.data();
+        fclose(file);
+    }
+    if(bytes) *bytes = total;
+    return true;
+}
+
+/**
+ * Writes one columnar file per channel, named prefix_channel.col
+ * "VXCL", rows u32, columns u8, each column's name as a length u8 and characters,
+ * then each column whole: time in microseconds as u32, then every field as f32.
+ *
+ * @param   prefix  the start of every file name
+ * @param   bytes   if not 0, set to the bytes written
+ *
+ * @return  false if a file could not be written
+ */
+bool LogReader::writeColumns(const char* prefix, uint64_t* bytes) const{
+    uint64_t total = 0;
+    for(const LogColumns& channel : this->channels){
+        if(channel.size() == 0) continue;
+        std::string path = std::string(prefix) + "_" + channel.name + ".col";
+        FILE* file = fopen(path.c_str(), "wb");
+        if(!file) return false;
+
+        uint32_t rows = channel.size();
+        uint8_t columns = 1 + channel.fields.size();
+        std::string header = "VXCL";
+        header.append((const char*)&rows, 4);
+        header += (char)columns;
+        header += (char)7;
+        header += "time_us";
+        for(const std::string& name : channel.fieldNames){
+            header += (char)name.size();
+            header += name;
+        }
+        fwrite(header.data(), 1, header.size(), file);
+        fwrite(channel.timestamp.data(), 4, rows, file);
+        total += header.size() + 4 * (uint64_t)rows;
+
+        std::vector<float> column(rows);
+        for(size_t j = 0; j < channel.fields.size(); j++){
+            float scale = channel.scales[j];
+            for(uint32_t row = 0; row < rows; row++) column[row] = channel.fields[j][row] / scale;
+            fwrite(column.data(), 4, rows, file);
+            total += 4 * (uint64_t)rows;
+        }
+        fclose(file);
+    }
+    if(bytes) *bytes = total;
+    return true;
+}
@@ -0,0 +1,238 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pidbatch.cpp                                              */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Structure of arrays PID, scalar, SSE and NEON kernels     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include "pidbatchkernel.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define PIDBATCH_SSE 1
+#if defined(PIDBATCH_HAS_AVX)
+int advancePIDBatchAVX(PIDBatchData& data, int count, const float* errors, float dt, PIDBatchMode mode, float* outputs, bool stopIOvershoot);
+#endif
+#endif
+
+// ARMv7 NEON flushes denormals and has no divide, only AArch64 NEON matches the scalar math
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#define PIDBATCH_NEON 1
+#endif
+
+namespace {
+
+#if defined(PIDBATCH_SSE)
+/**
+ * Four controllers per SSE2 register
+ */
+struct SSELanes{
+    typedef __m128 Vector;
+    typedef __m128 Mask;
+    static const int width = 4;
+
+    static Vector load(const float* p){ return _mm_loadu_ps(p); }
+    static void store(float* p, Vector v){ _mm_storeu_ps(p, v); }
+    static Vector set(float x){ return _mm_set1_ps(x); }
+    static Vector add(Vector a, Vector b){ return _mm_add_ps(a, b); }
+    static Vector sub(Vector a, Vector b){ return _mm_sub_ps(a, b); }
+    static Vector mul(Vector a, Vector b){ return _mm_mul_ps(a, b); }
+    static Vector div(Vector a, Vector b){ return _mm_div_ps(a, b); }
+    static Vector abs(Vector a){ return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static Mask less(Vector a, Vector b){ return _mm_cmplt_ps(a, b); }
+    static Mask greater(Vector a, Vector b){ return _mm_cmpgt_ps(a, b); }
+    static Mask either(Mask a, Mask b){ return _mm_or_ps(a, b); }
+    static Vector select(Mask mask, Vector a, Vector b){ return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+};
+#endif
+
+#if defined(PIDBATCH_NEON)
+/**
+ * Four controllers per NEON register
+ */
+struct NEONLanes{
+    typedef float32x4_t Vector;
+    typedef uint32x4_t Mask;
+    static const int width = 4;
+
+    static Vector load(const float* p){ return vld1q_f32(p); }
+    static void store(float* p, Vector v){ vst1q_f32(p, v); }
+    static Vector set(float x){ return vdupq_n_f32(x); }
+    static Vector add(Vector a, Vector b){ return vaddq_f32(a, b); }
+    static Vector sub(Vector a, Vector b){ return vsubq_f32(a, b); }
+    static Vector mul(Vector a, Vector b){ return vmulq_f32(a, b); }
+    static Vector div(Vector a, Vector b){ return vdivq_f32(a, b); }
+    static Vector abs(Vector a){ return vabsq_f32(a); }
+    static Mask less(Vector a, Vector b){ return vcltq_f32(a, b); }
+    static Mask greater(Vector a, Vector b){ return vcgtq_f32(a, b); }
+    static Mask either(Mask a, Mask b){ return vorrq_u32(a, b); }
+    static Vector select(Mask mask, Vector a, Vector b){ return vbslq_f32(mask, a, b); }
+};
+#endif
+
+}
+
+/**
+ * Constructor method
+ * Every controller starts with zero gains, pick them with setConstants
+ *
+ * @param   count   the number of controllers
+ */
+PIDBatch::PIDBatch(int count) : storage(12 * count, 0.0f){
+    this->count = count;
+    float* column = this->storage.data();
+    float** columns[12] = {&this->data.Kp, &this->data.Ki, &this->data.Kd, &this->data.integralTolerance, &this->data.settleTolerance,
+        &this->data.settleTime, &this->data.minOutput, &this->data.maxOutput, &this->data.cycleTime, &this->data.previousError,
+        &this->data.integral, &this->data.timeSettled};
+    for(int i = 0; i < 12; i++) *columns[i] = column + i * count;
+    this->setKernel(automatic);
+}
+
+/**
+ * Whether a kernel can run on this machine
+ *
+ * @param   kernel  the kernel to check
+ *
+ * @return  true if it was compiled in and the processor supports it
+ */
+bool PIDBatch::isSupported(Kernel kernel){
+    if(kernel == automatic || kernel == scalar) return true;
+#if defined(PIDBATCH_SSE)
+    if(kernel == sse) return true;
+#if defined(PIDBATCH_HAS_AVX)
+    if(kernel == avx) return __builtin_cpu_supports("avx");
+#endif
+#endif
+#if defined(PIDBATCH_NEON)
+    if(kernel == neon) return true;
+#endif
+    return false;
+}
+
+/**
+ * Picks the instruction set, automatic takes the widest one supported
+ *
+ * @param   kernel  the kernel to use
+ *
+ * @return  false if the kernel is not supported, the current one is kept
+ */
+bool PIDBatch::setKernel(Kernel kernel){
+    if(!PIDBatch::isSupported(kernel)) return false;
+    if(kernel == automatic){
+        const Kernel widest[4] = {avx, sse, neon, scalar};
+        for(Kernel candidate : widest){
+            if(PIDBatch::isSupported(candidate)){
+                kernel = candidate;
+                break;
+            }
+        }
+    }
+    this->kernel = kernel;
+    return true;
+}
+
+/**
+ * @return  the kernel in use
+ */
+PIDBatch::Kernel PIDBatch::getKernel(){
+    return this->kernel;
+}
+
+/**
+ * @return  the name of a kernel, for printing
+ */
+const char* PIDBatch::getKernelName(Kernel kernel){
+    const char* names[5] = {"automatic", "scalar", "sse", "avx", "neon"};
+    return names[kernel];
+}
+
+/**
+ * Sets the constants of one controller, same arguments as the PID constructor
+ */
+void PIDBatch::setConstants(int index, float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, \
+    float settleTime, float minOutput, float maxOutput, int cycleTime){
+
+    this->data.Kp[index] = Kp;
+    this->data.Ki[index] = Ki;
+    this->data.Kd[index] = Kd;
+    this->data.integralTolerance[index] = integralTolerance;
+    this->data.settleTolerance[index] = settleTolerance;
+    this->data.settleTime[index] = settleTime;
+    this->data.minOutput[index] = minOutput;
+    this->data.maxOutput[index] = maxOutput;
+    this->data.cycleTime[index] = cycleTime;
+}
+
+/**
+ * Clears every controller's integral, previous error and settle time
+ */
+void PIDBatch::reset(){
+    for(int i = 0; i < this->count; i++){
+        this->data.previousError[i] = 0;
+        this->data.integral[i] = 0;
+        this->data.timeSettled[i] = 0;
+    }
+}
+
+/**
+ * Private function that runs the chosen kernel and finishes the tail with the scalar one
+ */
+void PIDBatch::advance(const float* errors, float dt, PIDBatchMode mode, float* outputs, bool stopIOvershoot){
+    int done = 0;
+#if defined(PIDBATCH_SSE)
+#if defined(PIDBATCH_HAS_AVX)
+    if(this->kernel == avx) done = advancePIDBatchAVX(this->data, this->count, errors, dt, mode, outputs, stopIOvershoot);
+#endif
+    if(this->kernel == sse) done = advancePIDBatchLanes<SSELanes>(this->data, this->count, errors, dt, mode, outputs, stopIOvershoot);
+#endif
+#if defined(PIDBATCH_NEON)
+    if(this->kernel == neon) done = advancePIDBatchLanes<NEONLanes>(this->data, this->count, errors, dt, mode, outputs, stopIOvershoot);
+#endif
+
+    if(mode == PIDBatchMode::cycle) advancePIDBatch<ScalarLanes, PIDBatchMode::cycle>(this->data, done, this->count, errors, dt, outputs, stopIOvershoot);
+    else if(mode == PIDBatchMode::seconds) advancePIDBatch<ScalarLanes, PIDBatchMode::seconds>(this->data, done, this->count, errors, dt, outputs, stopIOvershoot);
+    else advancePIDBatch<ScalarLanes, PIDBatchMode::fallback>(this->data, done, this->count, errors, dt, outputs, stopIOvershoot);
+}
+
+/**
+ * Updates every controller with per cycle gains, like PID::getOutput(error)
+ *
+ * @param   errors          the current error of each controller
+ * @param   outputs         where to store each output
+ * @param   stopIOvershoot  prevents I from causing overshoots
+ */
+void PIDBatch::getOutputs(const float* errors, float* outputs, bool stopIOvershoot){
+    this->advance(errors, 1, PIDBatchMode::cycle, outputs, stopIOvershoot);
+}
+
+/**
+ * Updates every controller with per second gains, like PID::getOutputDt(error, dt)
+ *
+ * @param   errors          the current error of each controller
+ * @param   dt              the measured time since the last update, in seconds
+ * @param   outputs         where to store each output
+ * @param   stopIOvershoot  prevents I from causing overshoots
+ */
+void PIDBatch::getOutputsDt(const float* errors, float dt, float* outputs, bool stopIOvershoot){
+    this->advance(errors, dt, dt > 0 ? PIDBatchMode::seconds : PIDBatchMode::fallback, outputs, stopIOvershoot);
+}
+
+/**
+ * Determines if one controller is settled
+ *
+ * @param   index   the controller
+ *
+ * @return  true if settled
+ */
+bool PIDBatch::isSettled(int index){
+    return (this->data.settleTime[index] <= this->data.timeSettled[index]);
+}
+
+/**
+ * @return  the number of controllers
+ */
+int PIDBatch::size(){
+    return this->count;
+}
@@ -0,0 +1,53 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pidbatchavx.cpp                                           */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Structure of arrays PID, AVX kernel                       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+// The makefile builds this file alone with -mavx, PIDBatch only calls into it
+// after checking the processor supports AVX
+#include "pidbatchkernel.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+
+namespace {
+
+/**
+ * Eight controllers per AVX register
+ */
+struct AVXLanes{
+    typedef __m256 Vector;
+    typedef __m256 Mask;
+    static const int width = 8;
+
+    static Vector load(const float* p){ return _mm256_loadu_ps(p); }
+    static void store(float* p, Vector v){ _mm256_storeu_ps(p, v); }
+    static Vector set(float x){ return _mm256_set1_ps(x); }
+    static Vector add(Vector a, Vector b){ return _mm256_add_ps(a, b); }
+    static Vector sub(Vector a, Vector b){ return _mm256_sub_ps(a, b); }
+    static Vector mul(Vector a, Vector b){ return _mm256_mul_ps(a, b); }
+    static Vector div(Vector a, Vector b){ return _mm256_div_ps(a, b); }
+    static Vector abs(Vector a){ return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static Mask less(Vector a, Vector b){ return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Mask greater(Vector a, Vector b){ return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static Mask either(Mask a, Mask b){ return _mm256_or_ps(a, b); }
+    // and/andnot/or rather than blendv, which measured several times slower on some hosts
+    static Vector select(Mask mask, Vector a, Vector b){ return _mm256_or_ps(_mm256_and_ps(mask, a), _mm256_andnot_ps(mask, b)); }
+};
+
+}
+
+/**
+ * AVX entry point for PIDBatch
+ *
+ * @return  the number of controllers advanced, a multiple of 8
+ */
+int advancePIDBatchAVX(PIDBatchData& data, int count, const float* errors, float dt, PIDBatchMode mode, float* outputs, bool stopIOvershoot){
+    int done = advancePIDBatchLanes<AVXLanes>(data, count, errors, dt, mode, outputs, stopIOvershoot);
+    _mm256_zeroupper();
+    return done;
+}
+#endif
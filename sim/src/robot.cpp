@@ -0,0 +1,249 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       robot.cpp                                                 */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Simulated differential drive robot and its devices        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <math.h>
+#include "robot.h"
+
+namespace sim {
+
+static const float metersPerInch = 0.0254;
+static const float gravity = 9.81;
+
+/**
+ * Voltage the motor applies to its windings given its mode
+ * Velocity mode and hold mode stand in for the motor's internal controllers
+ *
+ * @return  applied voltage, -12 to 12
+ */
+float Motor::voltage(){
+    float volts = 0;
+    if(this->mode == Mode::voltage) volts = this->command;
+    else if(this->mode == Mode::velocity) volts = 12 * this->command / this->cartridgeRpm + 0.05 * (this->command - this->velocity);
+    else if(this->brake == vex::brakeType::hold) volts = 0.4 * (this->holdPosition - this->position) - 0.02 * this->velocity;
+
+    if(volts > 12) volts = 12;
+    if(volts < -12) volts = -12;
+    return volts;
+}
+
+/**
+ * Whether the windings are connected, a coasting motor produces no torque at all
+ *
+ * @return  false only when stopped in coast
+ */
+bool Motor::isShorted(){
+    return this->mode != Mode::stopped || this->brake != vex::brakeType::coast;
+}
+
+/**
+ * Moves the tracking wheel
+ *
+ * @param   deltaDegrees    rotation of the wheel this step
+ * @param   dt              length of the step, in seconds
+ */
+void TrackingWheel::advance(float deltaDegrees, float dt){
+    this->degrees += deltaDegrees;
+    this->rate = deltaDegrees / dt;
+}
+
+/**
+ * Reads the wheel the way the sensor would, quantized to its resolution
+ *
+ * @return  position in degrees
+ */
+float TrackingWheel::read(){
+    return floorf((this->degrees - this->zero) / this->resolution) * this->resolution;
+}
+
+/**
+ * Sets the reported position without moving the wheel
+ *
+ * @param   value   the new position in degrees
+ */
+void TrackingWheel::set(float value){
+    this->zero = this->degrees - value;
+}
+
+Inertial::Inertial(Robot* robot) : noise(0, robot->config.gyroNoise){
+    this->robot = robot;
+}
+
+/**
+ * Continuous heading, drifts and is noisy like the real sensor
+ *
+ * @return  rotation in degrees, clockwise positive
+ */
+float Inertial::rotation(){
+    float drift = this->robot->config.gyroDrift * this->robot->time;
+    return this->robot->heading * 180 / M_PI + drift + this->rotationOffset + this->noise(this->robot->random);
+}
+
+/**
+ * Heading wrapped to [0, 360)
+ *
+ * @return  heading in degrees
+ */
+float Inertial::heading(){
+    float drift = this->robot->config.gyroDrift * this->robot->time;
+    float heading = fmodf(this->robot->heading * 180 / M_PI + drift + this->headingOffset + this->noise(this->robot->random), 360);
+    if(heading < 0) heading += 360;
+    return heading;
+}
+
+void Inertial::setRotation(float value){
+    this->rotationOffset += value - this->rotation();
+}
+
+void Inertial::setHeading(float value){
+    this->headingOffset += value - this->heading();
+}
+
+/**
+ * Yaw rate
+ *
+ * @return  degrees per second, clockwise positive
+ */
+float Inertial::rate(){
+    return (this->robot->angularVelocity + this->robot->contactRate) * 180 / M_PI + this->noise(this->robot->random);
+}
+
+/**
+ * Constructor method
+ *
+ * @param   config  the physical description of the robot
+ */
+Robot::Robot(const RobotConfig& config) :
+    config(config), verticalWheel(0.088), horizontalWheel(0.088), verticalEncoder(1), horizontalEncoder(1),
+    imu(this), random(config.seed)
+{
+    for(int i = 0; i < 8; i++){
+        this->leftMotors[i].cartridgeRpm = config.cartridgeRpm;
+        this->rightMotors[i].cartridgeRpm = config.cartridgeRpm;
+    }
+}
+
+/**
+ * Private function that computes the ground force from one side of the drive
+ * Force beyond the traction limit spins the wheels up instead of the robot
+ *
+ * @param   motors          the motors on that side
+ * @param   groundSpeed     speed of the ground under the wheels, in m/s
+ * @param   slip            the side's wheel slip, updated in place
+ * @param   dt              length of the step, in seconds
+ *
+ * @return  the force pushing the robot forward on that side, in N
+ */
+float Robot::sideForce(Motor* motors, float groundSpeed, float& slip, float dt){
+    float wheelRadius = this->config.wheelDiameter / 2 * metersPerInch;
+    float freeSpeed = this->config.cartridgeRpm * this->config.wheelToMotor * 2 * M_PI / 60;
+    float stallTorque = this->config.stallTorque * this->config.motorsPerSide / this->config.wheelToMotor;
+
+    float wheelSpeed = (groundSpeed + slip) / wheelRadius;
+    float torque = 0;
+    if(motors[0].isShorted()) torque = stallTorque * (motors[0].voltage() / 12 - wheelSpeed / freeSpeed);
+    float force = torque / wheelRadius;
+
+    float limit = this->config.traction * this->config.mass * gravity / 2;
+    float wheelMass = 0.3;
+    if(force > limit || force < -limit){
+        float grip = force > 0 ? limit : -limit;
+        slip += (force - grip) / wheelMass * dt;
+        return grip;
+    }
+
+    slip -= slip * (dt / 0.02 < 1 ? dt / 0.02 : 1);
+    return force;
+}
+
+/**
+ * Advances the physics by one step
+ *
+ * @param   dt  length of the step, in seconds
+ */
+void Robot::step(float dt){
+    float halfTrack = this->config.trackWidth / 2 * metersPerInch;
+    float wheelRadius = this->config.wheelDiameter / 2 * metersPerInch;
+
+    float leftGround = this->velocity + this->angularVelocity * halfTrack;
+    float rightGround = this->velocity - this->angularVelocity * halfTrack;
+    float leftForce = this->sideForce(this->leftMotors, leftGround, this->leftSlip, dt);
+    float rightForce = this->sideForce(this->rightMotors, rightGround, this->rightSlip, dt);
+
+    float acceleration = (leftForce + rightForce - this->config.linearDrag * this->velocity) / this->config.mass;
+    float angularAcceleration = ((leftForce - rightForce) * halfTrack - this->config.angularDrag * this->angularVelocity) / this->config.inertia;
+    this->velocity += acceleration * dt;
+    this->angularVelocity += angularAcceleration * dt;
+
+    float midHeading = this->heading + this->angularVelocity * dt / 2;
+    this->heading += this->angularVelocity * dt;
+    this->x += this->velocity * sinf(midHeading) * dt / metersPerInch;
+    this->y += this->velocity * cosf(midHeading) * dt / metersPerInch;
+
+    float motorDegreesPerMeter = 180 / M_PI / wheelRadius / this->config.wheelToMotor;
+    float leftSurface = leftGround + this->leftSlip;
+    float rightSurface = rightGround + this->rightSlip;
+    for(int i = 0; i < this->config.motorsPerSide; i++){
+        this->leftMotors[i].position += leftSurface * motorDegreesPerMeter * dt;
+        this->leftMotors[i].velocity = leftSurface * motorDegreesPerMeter / 6;
+        this->rightMotors[i].position += rightSurface * motorDegreesPerMeter * dt;
+        this->rightMotors[i].velocity = rightSurface * motorDegreesPerMeter / 6;
+    }
+
+    float trackingDegreesPerInch = 360 / (M_PI * this->config.trackingWheelDiameter);
+    float forward = (this->velocity / metersPerInch - this->angularVelocity * this->config.verticalOffset) * dt;
+    float sideways = -this->angularVelocity * this->config.horizontalOffset * dt;
+    this->verticalWheel.advance(forward * trackingDegreesPerInch, dt);
+    this->horizontalWheel.advance(sideways * trackingDegreesPerInch, dt);
+    this->verticalEncoder.advance(forward * trackingDegreesPerInch, dt);
+    this->horizontalEncoder.advance(sideways * trackingDegreesPerInch, dt);
+
+    this->contactRate = this->contactTurn / dt;
+    this->contactTurn = 0;
+    this->time += dt;
+}
+
+/**
+ * Shoves the robot as if it was hit by another robot
+ * The tracking wheels and inertial see the motion, the drive wheels skid.
+ * The inertial reports the rotation as yaw rate over the next physics step.
+ *
+ * @param   dx          field x displacement, in inches
+ * @param   dy          field y displacement, in inches
+ * @param   dHeading    rotation, in degrees
+ */
+void Robot::push(float dx, float dy, float dHeading){
+    float trackingDegreesPerInch = 360 / (M_PI * this->config.trackingWheelDiameter);
+    float turn = dHeading * M_PI / 180;
+    float forward = dx * sinf(this->heading) + dy * cosf(this->heading);
+    float right = dx * cosf(this->heading) - dy * sinf(this->heading);
+
+    this->verticalWheel.advance((forward - turn * this->config.verticalOffset) * trackingDegreesPerInch, 1);
+    this->horizontalWheel.advance((right - turn * this->config.horizontalOffset) * trackingDegreesPerInch, 1);
+    this->verticalEncoder.advance((forward - turn * this->config.verticalOffset) * trackingDegreesPerInch, 1);
+    this->horizontalEncoder.advance((right - turn * this->config.horizontalOffset) * trackingDegreesPerInch, 1);
+
+    this->x += dx;
+    this->y += dy;
+    this->heading += turn;
+    this->contactTurn += turn;
+}
+
+/**
+ * Teleports the robot without moving any sensor
+ *
+ * @param   x       field x, in inches
+ * @param   y       field y, in inches
+ * @param   heading heading, in degrees
+ */
+void Robot::setPose(float x, float y, float heading){
+    this->x = x;
+    this->y = y;
+    this->heading = heading * M_PI / 180;
+}
+
+}
@@ -0,0 +1,160 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       scheduler.cpp                                             */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Virtual time cooperative scheduler for host builds        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <algorithm>
+#include <thread>
+#include "world.h"
+
+namespace sim {
+
+static thread_local Task* currentTask = 0;
+extern thread_local World* currentWorld;
+
+/**
+ * Creates the scheduler and registers the calling thread as its first task
+ *
+ * @param   world   the world whose clock this scheduler advances
+ */
+Scheduler::Scheduler(World* world){
+    this->world = world;
+    Task* main = new Task();
+    main->order = this->nextOrder++;
+    this->alive.push_back(main);
+    this->owned.push_back(main);
+    this->running = main;
+    currentTask = main;
+}
+
+Scheduler::~Scheduler(){
+    for(Task* task : this->owned) delete task;
+    currentTask = 0;
+}
+
+/**
+ * Private function that gives the turn to the earliest waking task
+ * and blocks the caller until it is handed the turn again
+ * Must be called with the lock held
+ *
+ * @param   guard   the held scheduler lock
+ * @param   self    the calling task, or null if it has finished
+ */
+void Scheduler::handOff(std::unique_lock<std::mutex>& guard, Task* self){
+    Task* next = *std::min_element(this->alive.begin(), this->alive.end(), [](Task* a, Task* b){
+        return a->wake < b->wake || (a->wake == b->wake && a->order < b->order);
+    });
+
+    if(next->wake > this->world->time()) this->world->advanceTo(next->wake);
+
+    this->running = next;
+    if(next == self) return;
+    next->turn.notify_one();
+
+    if(self == 0) return;
+    self->turn.wait(guard, [&]{ return this->running == self; });
+}
+
+/**
+ * Starts a new task, it first runs when the caller next sleeps
+ *
+ * @param   body    the function the task runs
+ *
+ * @return  the task handle
+ */
+Task* Scheduler::spawn(std::function<void()> body){
+    std::unique_lock<std::mutex> guard(this->lock);
+
+    Task* task = new Task();
+    task->wake = this->world->time();
+    task->order = this->nextOrder++;
+    this->alive.push_back(task);
+    this->owned.push_back(task);
+
+    World* world = this->world;
+    std::thread([this, task, world, body]{
+        currentTask = task;
+        currentWorld = world;
+        {
+            std::unique_lock<std::mutex> guard(this->lock);
+            task->turn.wait(guard, [&]{ return this->running == task; });
+        }
+
+        try{
+            body();
+        }
+        catch(Shutdown&){}
+
+        std::unique_lock<std::mutex> guard(this->lock);
+        task->finished = true;
+        this->alive.erase(std::find(this->alive.begin(), this->alive.end(), task));
+        this->handOff(guard, 0);
+    }).detach();
+
+    return task;
+}
+
+/**
+ * Puts the calling task to sleep and lets the others run
+ *
+ * @param   microseconds    virtual time to sleep for
+ */
+void Scheduler::sleep(uint64_t microseconds){
+    std::unique_lock<std::mutex> guard(this->lock);
+    Task* self = currentTask;
+
+    self->wake = this->world->time() + microseconds;
+    self->order = this->nextOrder++;
+    this->handOff(guard, self);
+
+    if(this->stopping && self != this->owned.front()) throw Shutdown();
+}
+
+/**
+ * Sleeps the calling task until another task finishes
+ *
+ * @param   task    the task to wait for
+ */
+void Scheduler::join(Task* task){
+    while(!task->finished) this->sleep(1000);
+}
+
+/**
+ * Stops every background task by unwinding it out of its next sleep
+ * Must be called from the task that created the world
+ *
+ * @param   graceMicroseconds   how long to wait for the tasks to finish
+ *
+ * @return  true if every task finished
+ */
+bool Scheduler::shutdown(uint64_t graceMicroseconds){
+    {
+        std::unique_lock<std::mutex> guard(this->lock);
+        this->stopping = true;
+        for(Task* task : this->alive) if(task != currentTask) task->wake = this->world->time();
+    }
+
+    uint64_t deadline = this->world->time() + graceMicroseconds;
+    while(this->alive.size() > 1 && this->world->time() < deadline) this->sleep(1000);
+
+    if(this->alive.size() > 1){
+        fprintf(stderr, "sim: %d task(s) did not unwind and could not be stopped\n", (int)this->alive.size() - 1);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Getter for the task running on the calling thread
+ *
+ * @return  the current task, or null outside of a world
+ */
+Task* Scheduler::current(){
+    return currentTask;
+}
+
+}
@@ -0,0 +1,111 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       screen.cpp                                                */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Software framebuffer standing in for the brain screen     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "screen.h"
+
+namespace sim {
+
+Screen::Screen(){
+    this->clear(0);
+}
+
+/**
+ * Fills the whole screen
+ *
+ * @param   color   0xRRGGBB fill color
+ */
+void Screen::clear(uint32_t color){
+    for(int i = 0; i < width * height; i++) this->pixels[i] = color;
+    this->drawCalls++;
+}
+
+/**
+ * Writes one pixel, clipped to the screen
+ */
+void Screen::pixel(int x, int y, uint32_t color){
+    if(x < 0 || y < 0 || x >= width || y >= height) return;
+    this->pixels[y * width + x] = color;
+    this->pixelsWritten++;
+}
+
+/**
+ * Bresenham line drawn with a square pen of the current width
+ */
+void Screen::line(int x1, int y1, int x2, int y2){
+    this->drawCalls++;
+    int dx = abs(x2 - x1);
+    int dy = -abs(y2 - y1);
+    int sx = x1 < x2 ? 1 : -1;
+    int sy = y1 < y2 ? 1 : -1;
+    int error = dx + dy;
+    int half = this->penWidth / 2;
+
+    while(true){
+        for(int ox = -half; ox <= half; ox++)
+            for(int oy = -half; oy <= half; oy++) this->pixel(x1 + ox, y1 + oy, this->penColor);
+
+        if(x1 == x2 && y1 == y2) break;
+        int doubled = 2 * error;
+        if(doubled >= dy){ error += dy; x1 += sx; }
+        if(doubled <= dx){ error += dx; y1 += sy; }
+    }
+}
+
+/**
+ * Filled rectangle with an outline in the pen color
+ */
+void Screen::rectangle(int x, int y, int w, int h){
+    this->drawCalls++;
+    for(int py = y; py < y + h; py++)
+        for(int px = x; px < x + w; px++) this->pixel(px, py, this->fillColor);
+
+    uint64_t calls = this->drawCalls;
+    this->line(x, y, x + w - 1, y);
+    this->line(x, y + h - 1, x + w - 1, y + h - 1);
+    this->line(x, y, x, y + h - 1);
+    this->line(x + w - 1, y, x + w - 1, y + h - 1);
+    this->drawCalls = calls;
+}
+
+/**
+ * Filled circle with an outline in the pen color
+ */
+void Screen::circle(int x, int y, int radius){
+    this->drawCalls++;
+    for(int py = -radius; py <= radius; py++)
+        for(int px = -radius; px <= radius; px++){
+            int distance = px * px + py * py;
+            if(distance > radius * radius) continue;
+            bool edge = distance > (radius - this->penWidth) * (radius - this->penWidth);
+            this->pixel(x + px, y + py, edge ? this->penColor : this->fillColor);
+        }
+}
+
+/**
+ * Saves the framebuffer as a binary PPM image
+ *
+ * @param   path    the file to write
+ *
+ * @return  true if the file was written
+ */
+bool Screen::writePPM(const char* path){
+    FILE* file = fopen(path, "wb");
+    if(!file) return false;
+
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    for(int i = 0; i < width * height; i++){
+        unsigned char rgb[3] = {(unsigned char)(this->pixels[i] >> 16), (unsigned char)(this->pixels[i] >> 8), (unsigned char)this->pixels[i]};
+        fwrite(rgb, 1, 3, file);
+    }
+    fclose(file);
+    return true;
+}
+
+}
@@ -0,0 +1,109 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       world.cpp                                                 */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Simulated world that owns the robot, clock and devices    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include "world.h"
+
+namespace sim {
+
+thread_local World* currentWorld = 0;
+
+/**
+ * Private function that builds one side of the drive as a vex::motor_group
+ */
+static std::vector<vex::motor> side(Motor* motors, int count){
+    std::vector<vex::motor> group;
+    for(int i = 0; i < count; i++) group.push_back(vex::motor(&motors[i]));
+    return group;
+}
+
+/**
+ * Creates a world and makes it current for the calling thread
+ *
+ * @param   config              the physical description of the robot
+ * @param   stepMicroseconds    length of one physics step
+ */
+World::World(const RobotConfig& config, uint64_t stepMicroseconds) :
+    scheduler(this), robot(config),
+    Left(side(robot.leftMotors, config.motorsPerSide)),
+    Right(side(robot.rightMotors, config.motorsPerSide)),
+    VerticalRotation(&robot.verticalWheel),
+    HorizontalRotation(&robot.horizontalWheel),
+    VerticalEncoder(&robot.verticalEncoder),
+    HorizontalEncoder(&robot.horizontalEncoder),
+    Inertial(&robot.imu),
+    Brain_Screen(&display)
+{
+    this->stepMicroseconds = stepMicroseconds;
+    currentWorld = this;
+}
+
+/**
+ * Unwinds every task still running and releases the world
+ */
+World::~World(){
+    this->scheduler.shutdown(1000000);
+    for(Motor* motor : this->freeMotors) delete motor;
+    currentWorld = 0;
+}
+
+/**
+ * Creates a motor that is not part of the drive, such as an intake
+ * It spins a small inertia load
+ *
+ * @param   port    the smart port, only used for bookkeeping
+ *
+ * @return  the motor
+ */
+vex::motor World::motor(int port){
+    Motor* motor = new Motor();
+    this->freeMotors.push_back(motor);
+    return vex::motor(motor);
+}
+
+/**
+ * Steps the physics up to a time
+ * Called by the scheduler whenever every task is asleep
+ *
+ * @param   time    the new world time, in microseconds
+ */
+void World::advanceTo(uint64_t time){
+    while(this->now < time){
+        uint64_t step = time - this->now < this->stepMicroseconds ? time - this->now : this->stepMicroseconds;
+        float dt = step / 1e6f;
+
+        this->robot.step(dt);
+        for(Motor* motor : this->freeMotors){
+            float freeRpm = motor->cartridgeRpm * motor->voltage() / 12;
+            if(!motor->isShorted()) freeRpm = motor->velocity * 0.9f;
+            motor->velocity += (freeRpm - motor->velocity) * (dt / 0.05f < 1 ? dt / 0.05f : 1);
+            motor->position += motor->velocity * 6 * dt;
+        }
+
+        this->now += step;
+    }
+}
+
+/**
+ * Lets the world run with the calling task asleep
+ *
+ * @param   seconds the amount of virtual time to run for
+ */
+void World::run(float seconds){
+    this->scheduler.sleep((uint64_t)(seconds * 1e6));
+}
+
+/**
+ * Getter for the world of the calling thread
+ *
+ * @return  the current world, or null on a thread outside of any world
+ */
+World* World::current(){
+    return currentWorld;
+}
+
+}
@@ -0,0 +1,127 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       async.cpp                                                 */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Overlaps mechanism actions with async chassis motions     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+
+/**
+ * Usage: async
+ *
+ * Runs a short goal grab on a fresh simulated robot, once with blocking motions
+ * and the mechanisms waited for in between, and once with async motions that
+ * start the mechanisms part way through:
+ *   back 30 inches into a goal, the clamp takes 0.35 s and may close over the last 6 inches
+ *   turn to 90, the intake takes 0.5 s to spin up and may start once past 45 degrees
+ *   drive 24 inches once the intake is up to speed
+ * The mechanisms are only timers, the simulator has no clamp or intake. Prints
+ * when each action started and the total time, then cancels a long drive
+ * half a second in and prints how far the robot went.
+ */
+
+static const float clampTime = 0.35;
+static const float intakeTime = 0.5;
+
+static float now(sim::World& world){
+    return world.time() / 1e6f;
+}
+
+/**
+ * Sleeps until a mechanism started at some time is done
+ */
+static void waitFor(sim::World& world, float start, float duration){
+    float left = start + duration - now(world);
+    if(left > 0) vex::task::sleep((uint32_t)ceilf(left * 1000));
+}
+
+struct Episode{
+    sim::RobotConfig config;
+    sim::World world;
+    SensorHub sensors;
+    odom tracker;
+    chassis robot;
+    vex::thread odomTask;
+
+    Episode()
+        : world(config),
+          sensors(&world.Left, &world.Right, &world.Inertial),
+          tracker(sensors, config.verticalOffset, M_PI * config.trackingWheelDiameter / 360, config.horizontalOffset, M_PI * config.trackingWheelDiameter / 360, 10),
+          robot(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, M_PI * config.trackingWheelDiameter / 360){
+        this->sensors.setVerticalTracking(&this->world.VerticalRotation);
+        this->sensors.setHorizontalTracking(&this->world.HorizontalRotation);
+        this->odomTask = vex::thread([](void* arg){ ((odom*)arg)->start(); return 0; }, &this->tracker);
+        this->robot.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+        this->robot.setTurnConstants(0.3, 1, 0.02, 10, 1, 100, -12, 12);
+        this->world.run(0.05);
+    }
+
+    ~Episode(){
+        this->tracker.stop();
+    }
+};
+
+static void runRoute(bool async){
+    Episode episode;
+    sim::World& world = episode.world;
+    chassis& robot = episode.robot;
+    float start = now(world);
+    float clampStart;
+    float intakeStart;
+
+    if(async){
+        MotionHandle grab = robot.driveForAsync(-30, 3);
+        grab.waitUntilTraveled(24);
+        clampStart = now(world);
+        grab.waitUntilSettled();
+        waitFor(world, clampStart, clampTime);
+
+        MotionHandle turn = robot.turnToAsync(90, 3);
+        turn.waitUntilHeading(45);
+        intakeStart = now(world);
+        turn.waitUntilSettled();
+        waitFor(world, intakeStart, intakeTime);
+
+        robot.driveForAsync(24, 3).waitUntilSettled();
+    }
+    else{
+        robot.driveFor(-30, 3);
+        clampStart = now(world);
+        waitFor(world, clampStart, clampTime);
+
+        robot.turnTo(90, 3);
+        intakeStart = now(world);
+        waitFor(world, intakeStart, intakeTime);
+
+        robot.driveFor(24, 3);
+    }
+
+    printf("%-9s clamp at %5.2f s   intake at %5.2f s   done at %5.2f s   true (%6.2f, %6.2f, %7.2f)\n", async ? "async" : "blocking",
+        clampStart - start, intakeStart - start, now(world) - start, world.robot.x, world.robot.y, world.robot.heading * 180 / M_PI);
+}
+
+static void runCancel(){
+    Episode episode;
+    sim::World& world = episode.world;
+    MotionHandle drive = episode.robot.driveForAsync(48, 5);
+    vex::task::sleep(500);
+    float along = world.robot.y;
+    drive.cancel();
+    float time = drive.waitUntilSettled();
+    world.run(0.5);
+    printf("cancel    48 inch drive cancelled 0.5 s and %5.2f in along, returned after %4.2f s, stopped %5.2f in along\n", along, time,
+        world.robot.y);
+}
+
+int main(){
+    runRoute(false);
+    runRoute(true);
+    runCancel();
+    return 0;
+}
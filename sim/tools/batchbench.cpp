@@ -0,0 +1,161 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       batchbench.cpp                                            */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Checks and times the PID batch kernels against PID        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <random>
+#include "pid.h"
+#include "pidbatch.h"
+
+/**
+ * Usage: batchbench [controllers] [steps]
+ *
+ * Builds controllers (default 1021, so the vector kernels also run their
+ * scalar tail) with different gains and error traces, then for every kernel
+ * this machine supports:
+ *   - advances them next to the same number of PID objects, through the per
+ *     cycle overload, the dt overload and the dt <= 0 fallback, and checks
+ *     every output and settle flag is bit for bit the same
+ *   - times `steps` updates (default 2000) and prints controllers per second
+ */
+
+static int controllers;
+static int steps;
+static std::vector<float> errors;       // steps x controllers
+
+static void setGains(int i, float* constants){
+    constants[0] = 0.2f + 0.01f * (i % 97);
+    constants[1] = (i % 3) * 0.5f;
+    constants[2] = 0.001f * (i % 13);
+    constants[3] = 1 + (i % 5);
+    constants[4] = 0.25f + 0.25f * (i % 4);
+    constants[5] = 50 + 10 * (i % 6);
+    constants[6] = -6 - (i % 7);
+    constants[7] = 6 + (i % 7);
+}
+
+/**
+ * Runs the PID objects and the batch side by side
+ *
+ * @return  the number of outputs or settle flags that differ
+ */
+static long compare(PIDBatch::Kernel kernel, int overload){
+    std::vector<PID> pids;
+    PIDBatch batch(controllers);
+    batch.setKernel(kernel);
+    for(int i = 0; i < controllers; i++){
+        float c[8];
+        setGains(i, c);
+        pids.push_back(PID(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], 10));
+        batch.setConstants(i, c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], 10);
+    }
+
+    std::vector<float> outputs(controllers);
+    long mismatches = 0;
+    for(int t = 0; t < steps; t++){
+        const float* error = &errors[(size_t)t * controllers];
+        bool stop = t % 400 < 300;
+        float dt = 0.01f + 0.0005f * (t % 7);
+        if(overload == 0) batch.getOutputs(error, outputs.data(), stop);
+        if(overload == 1) batch.getOutputsDt(error, dt, outputs.data(), stop);
+        if(overload == 2) batch.getOutputsDt(error, 0.0f, outputs.data(), stop);
+
+        for(int i = 0; i < controllers; i++){
+            float expected = 0;
+            if(overload == 0) expected = pids[i].getOutput(error[i], stop);
+            if(overload == 1) expected = pids[i].getOutputDt(error[i], dt, stop);
+            if(overload == 2) expected = pids[i].getOutputDt(error[i], 0.0f, stop);
+            mismatches += memcmp(&expected, &outputs[i], sizeof(float)) != 0;
+            mismatches += pids[i].isSettled() != batch.isSettled(i);
+        }
+    }
+    return mismatches;
+}
+
+static double timeScalar(){
+    std::vector<PID> pids;
+    for(int i = 0; i < controllers; i++){
+        float c[8];
+        setGains(i, c);
+        pids.push_back(PID(c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], 10));
+    }
+    std::vector<float> outputs(controllers);
+
+    auto start = std::chrono::steady_clock::now();
+    for(int t = 0; t < steps; t++){
+        const float* error = &errors[(size_t)t * controllers];
+        for(int i = 0; i < controllers; i++) outputs[i] = pids[i].getOutputDt(error[i], 0.01f);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if(outputs[0] > 1e30f) printf("unreachable\n");
+    return (double)controllers * steps / seconds;
+}
+
+static double timeBatch(PIDBatch::Kernel kernel){
+    PIDBatch batch(controllers);
+    batch.setKernel(kernel);
+    for(int i = 0; i < controllers; i++){
+        float c[8];
+        setGains(i, c);
+        batch.setConstants(i, c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], 10);
+    }
+    std::vector<float> outputs(controllers);
+
+    auto start = std::chrono::steady_clock::now();
+    for(int t = 0; t < steps; t++) batch.getOutputsDt(&errors[(size_t)t * controllers], 0.01f, outputs.data());
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if(outputs[0] > 1e30f) printf("unreachable\n");
+    return (double)controllers * steps / seconds;
+}
+
+int main(int argc, char** argv){
+    controllers = argc > 1 ? atoi(argv[1]) : 1021;
+    steps = argc > 2 ? atoi(argv[2]) : 2000;
+
+    // decaying errors that jump to a new target every so often, cross zero and hit exact zeros
+    std::mt19937 random(1);
+    std::normal_distribution<float> noise(0, 0.05);
+    errors.resize((size_t)steps * controllers);
+    std::vector<float> error(controllers, 0);
+    for(int t = 0; t < steps; t++){
+        for(int i = 0; i < controllers; i++){
+            if((t + i * 37) % 250 == 0) error[i] = (random() % 4800) / 100.0f - 24;
+            error[i] = error[i] * 0.97f + noise(random);
+            if(t % 500 == 499) error[i] = (i % 2) ? 0.0f : -0.0f;
+            errors[(size_t)t * controllers + i] = error[i];
+        }
+    }
+
+    const PIDBatch::Kernel kernels[4] = {PIDBatch::scalar, PIDBatch::sse, PIDBatch::avx, PIDBatch::neon};
+    const char* overloads[3] = {"getOutput(error)", "getOutputDt(error, dt)", "getOutputDt(error, 0)"};
+    long failures = 0;
+
+    printf("%d controllers, %d steps\n\n", controllers, steps);
+    printf("%-8s %-22s %12s\n", "kernel", "overload", "mismatches");
+    for(PIDBatch::Kernel kernel : kernels){
+        if(!PIDBatch::isSupported(kernel)) continue;
+        for(int overload = 0; overload < 3; overload++){
+            long mismatches = compare(kernel, overload);
+            failures += mismatches;
+            printf("%-8s %-22s %12ld\n", PIDBatch::getKernelName(kernel), overloads[overload], mismatches);
+        }
+    }
+
+    double scalarRate = timeScalar();
+    printf("\n%-24s %16s %8s\n", "loop", "controllers/s", "speedup");
+    printf("%-24s %16.3e %8.2f\n", "PID objects", scalarRate, 1.0);
+    for(PIDBatch::Kernel kernel : kernels){
+        if(!PIDBatch::isSupported(kernel)) continue;
+        double rate = timeBatch(kernel);
+        char name[32];
+        snprintf(name, sizeof(name), "PIDBatch %s", PIDBatch::getKernelName(kernel));
+        printf("%-24s %16.3e %8.2f\n", name, rate, rate / scalarRate);
+    }
+    return failures != 0;
+}
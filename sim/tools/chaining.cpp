@@ -0,0 +1,84 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       chaining.cpp                                              */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Times the standard route with and without chained motions */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+
+/**
+ * Usage: chaining
+ *
+ * Drives the route simulate runs (driveFor 24, turnTo 90, swingFor right 45,
+ * arcFor left 20 90, driveFor -24) on a fresh simulated robot three ways:
+ *   settled     every motion settles and brakes
+ *   continuing  only the turn is chained, into the swing that keeps turning the same way
+ *   chained     every motion but the last is chained into the next
+ * Each runs with the plain PIDs and again with S-curve profiles, where a
+ * chained motion's profile starts from the speed it is handed. Prints the time
+ * of each motion, the total and where the true robot ended. Speed carried into
+ * a motion that turns the other way or backs up is speed it has to undo, so the
+ * fully chained route ends somewhere else.
+ */
+
+enum Ending{ settled, continuing, chained };
+static const char* endingNames[3] = {"settled", "continuing", "chained"};
+
+static void runRoute(bool profiled, Ending ending){
+    sim::RobotConfig config;
+    sim::World world(config);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    vex::thread odomTask([](void* arg){ ((odom*)arg)->start(); return 0; }, &tracker);
+
+    chassis drive(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    drive.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+    drive.setTurnConstants(0.3, 1, 0.02, 10, 1, 100, -12, 12);
+    drive.setSwingConstants(0.5, 1, 0.03, 10, 1, 100, -12, 12);
+    drive.setArcConstants(0.4, 1, 0.03, 10, 1, 100, -12, 12);
+    drive.setChainConstants(1, 5, 3);
+    if(profiled){
+        drive.setDriveProfile(50, 120, 1200, 0, 0.166, 0.030);
+        drive.setTurnProfile(330, 800, 8000, 0, 0.0229, 0.005);
+    }
+    world.run(0.1);
+
+    // only the turn into the swing keeps going the same way, the rest change direction
+    float times[5];
+    if(ending == chained) drive.chain();
+    times[0] = drive.driveFor(24, 3);
+    if(ending != settled) drive.chain();
+    times[1] = drive.turnTo(90, 3);
+    if(ending == chained) drive.chain();
+    times[2] = drive.swingFor(vex::turnType::right, 45, 3);
+    if(ending == chained) drive.chain();
+    times[3] = drive.arcFor(vex::turnType::left, 20, 90, 3);
+    times[4] = drive.driveFor(-24, 3);
+    world.run(0.2);
+
+    float total = 0;
+    printf("%-8s %-10s", profiled ? "s-curve" : "pid", endingNames[ending]);
+    for(float time : times){
+        printf(" %6.2f", time);
+        total += time;
+    }
+    printf("   %6.2f s   true (%7.2f, %7.2f, %7.2f)\n", total, world.robot.x, world.robot.y, world.robot.heading * 180 / M_PI);
+    tracker.stop();
+}
+
+int main(){
+    printf("%-8s %-10s %6s %6s %6s %6s %6s   %8s\n", "motion", "ending", "drive", "turn", "swing", "arc", "back", "total");
+    for(int ending = settled; ending <= chained; ending++) runRoute(false, (Ending)ending);
+    for(int ending = settled; ending <= chained; ending++) runRoute(true, (Ending)ending);
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       ekfbench.cpp                                              */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Accuracy and cost of the odom EKF against dead reckoning  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+
+/**
+ * Usage: ekfbench [repeats]
+ *
+ * Drives the simulated robot while another robot shoves it, with three
+ * estimators fed from the same devices every 10 ms:
+ *   wheels    the tracking wheel dead reckoning odom has always used
+ *   ekf       odom in EKF mode with both tracking wheels
+ *   ekf-drive odom in EKF mode on a sensor hub with no tracking wheels,
+ *             so only the slipping drive encoders and the inertial are left
+ * and prints each one's pose error against the true robot.
+ *
+ * Then replays every recorded frame through odom::update `repeats` times
+ * (default 2000) and prints the cost per update, which has to stay under
+ * the 2 ms budget on the brain.
+ */
+
+static odom* Wheels;
+static odom* Filtered;
+static odom* DriveOnly;
+static SensorHub* Sensors;
+static SensorHub* DriveSensors;
+static std::vector<SensorFrame> frames;
+
+struct Error{
+    const char* name;
+    odom* tracker;
+    float max = 0;
+    float afterContact = 0;
+    float final = 0;
+    float finalHeading = 0;
+};
+static Error errors[3];
+static bool recovering = false;
+
+static float headingError(float a, float b){
+    return fabsf(remainderf(a - b, 360));
+}
+
+static void runEstimators(){
+    sim::World& world = *sim::World::current();
+    LoopTimer loop(10);
+    while(true){
+        SensorFrame frame = Sensors->getFrame();
+        frames.push_back(frame);
+        Wheels->update(frame);
+        Filtered->update(frame);
+        DriveOnly->update(DriveSensors->getFrame());
+
+        for(int i = 0; i < 3; i++){
+            Pose pose = errors[i].tracker->getPose();
+            float error = hypotf(pose.x - world.robot.x, pose.y - world.robot.y);
+            if(error > errors[i].max) errors[i].max = error;
+            if(recovering) errors[i].afterContact = error;
+            errors[i].final = error;
+            errors[i].finalHeading = headingError(pose.heading, world.robot.heading * 180 / M_PI);
+        }
+        loop.wait();
+    }
+}
+
+/**
+ * Another robot pushes ours sideways and twists it over 200 ms
+ */
+static void runContact(){
+    sim::World& world = *sim::World::current();
+    vex::task::sleep(600);
+    for(int i = 0; i < 200; i++){
+        world.robot.push(0.03, -0.01, 0.1);
+        vex::task::sleep(1);
+    }
+    recovering = true;
+    vex::task::sleep(500);
+    recovering = false;
+}
+
+template<typename Update>
+static double nanosecondsPerUpdate(int repeats, Update update){
+    uint64_t span = frames.back().timestamp - frames.front().timestamp + 10000;
+    auto start = std::chrono::steady_clock::now();
+    for(int r = 0; r < repeats; r++){
+        for(size_t i = 0; i < frames.size(); i++){
+            SensorFrame frame = frames[i];
+            frame.timestamp += r * span;
+            update(frame);
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return seconds * 1e9 / (repeats * frames.size());
+}
+
+int main(int argc, char** argv){
+    int repeats = argc > 1 ? atoi(argv[1]) : 2000;
+
+    sim::RobotConfig config;
+    config.gyroDrift = 0.01;
+    sim::World world(config);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    float driveDegreesToInches = M_PI * config.wheelDiameter * config.wheelToMotor / 360;
+
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    SensorHub driveSensors(&world.Left, &world.Right, &world.Inertial);
+    Sensors = &sensors;
+    DriveSensors = &driveSensors;
+
+    odom wheels(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    odom filtered(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    odom driveOnly(driveSensors, 0, 0, 0, 0, 10);
+    filtered.useEKF(driveDegreesToInches, config.trackWidth);
+    driveOnly.useEKF(driveDegreesToInches, config.trackWidth);
+    Wheels = &wheels;
+    Filtered = &filtered;
+    DriveOnly = &driveOnly;
+    errors[0].name = "wheels";
+    errors[0].tracker = &wheels;
+    errors[1].name = "ekf";
+    errors[1].tracker = &filtered;
+    errors[2].name = "ekf-drive";
+    errors[2].tracker = &driveOnly;
+
+    vex::thread estimatorTask(runEstimators);
+
+    chassis drive(&wheels, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    drive.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+    drive.setTurnConstants(0.3, 1, 0.02, 10, 1, 100, -12, 12);
+
+    world.run(0.1);
+    vex::thread contactTask(runContact);
+    drive.driveFor(48, 3);
+    drive.turnTo(90, 3);
+    drive.driveFor(24, 3);
+    world.run(0.2);
+
+    printf("true pose (%.2f, %.2f, %.2f) after %.2f s, contact of 6 in and 20 deg during the first drive\n\n",
+        world.robot.x, world.robot.y, world.robot.heading * 180 / M_PI, world.time() / 1e6);
+    printf("%-10s %14s %20s %14s %16s\n", "estimator", "max error in", "0.5 s after contact", "final error in", "final heading deg");
+    for(int i = 0; i < 3; i++){
+        printf("%-10s %14.3f %20.3f %14.3f %16.3f\n", errors[i].name, errors[i].max, errors[i].afterContact, errors[i].final, errors[i].finalHeading);
+    }
+    printf("\nekf: %u drive encoder readings rejected, position sd %.3f in, heading sd %.3f deg\n", filtered.getEKF()->getRejectedCount(),
+        sqrtf(filtered.getEKF()->getPositionVariance()), sqrtf(filtered.getEKF()->getHeadingVariance()) * 180 / M_PI);
+    printf("ekf-drive: %u drive encoder readings rejected, position sd %.3f in\n\n", driveOnly.getEKF()->getRejectedCount(),
+        sqrtf(driveOnly.getEKF()->getPositionVariance()));
+
+    odom wheelsBench(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    odom filteredBench(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    filteredBench.useEKF(driveDegreesToInches, config.trackWidth);
+    double wheelCost = nanosecondsPerUpdate(repeats, [&](const SensorFrame& frame){ wheelsBench.update(frame); });
+    double filterCost = nanosecondsPerUpdate(repeats, [&](const SensorFrame& frame){ filteredBench.update(frame); });
+    printf("odom::update over %zu frames x %d: wheels %.0f ns, ekf %.0f ns per update\n", frames.size(), repeats, wheelCost, filterCost);
+    printf("ekf uses %.4f%% of the 2 ms brain budget on this host (%.0fx headroom)\n", filterCost / 2e6 * 100, 2e6 / filterCost);
+
+    wheels.stop();
+    return 0;
+}
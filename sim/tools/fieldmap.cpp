@@ -0,0 +1,166 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       fieldmap.cpp                                              */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Live field map drawn while a route runs                   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+#include "fieldmap.h"
+
+/**
+ * Usage: fieldmap [image.ppm]
+ *
+ * Drives a square-ish route on the simulated robot four ways:
+ *   none   nothing drawn
+ *   full   a 20 fps task that draws the field, the whole trail and the marker again each frame
+ *   map    FieldMap::start(20), erasing the old marker and drawing only the new trail lines
+ *   edge   the same with odom started at (60, 60), so the route runs off the field's corner
+ *          and the marker is drawn against the edge
+ * Prints the frames rendered, the draw calls and pixels written per frame, the
+ * odom loop's timing and the final pose, which should match across the two drawing tasks.
+ * For the FieldMap runs also prints the box the marker's pixels span on the last
+ * screen and how many are on or past the outline, a marker that was not erased
+ * leaves pixels behind and makes the box bigger than one marker.
+ * The last map screen is written to the image if one is given.
+ */
+
+enum Mode{ none, full, map, edge };
+static const char* modeNames[4] = {"none", "full", "map", "edge"};
+
+/**
+ * Draws the whole map from scratch every frame, the way a map would be drawn without FieldMap
+ */
+struct FullRedraw{
+    Graph* graph;
+    vex::brain::lcd* screen;
+    odom* tracker;
+    bool running;
+};
+
+static int redrawFull(void* arg){
+    FullRedraw* redraw = (FullRedraw*)arg;
+    Series trail;
+    LoopTimer loop(50);
+    while(redraw->running){
+        Pose pose;
+        redraw->tracker->readPose(pose);
+        if(trail.size() == 0 || hypotf(pose.x - trail.getX(trail.size() - 1), pose.y - trail.getY(trail.size() - 1)) >= 1) trail.push(pose.x, pose.y);
+
+        redraw->graph->drawOutline();
+        redraw->graph->drawData(trail, vex::color::yellow, 1);
+        float radians = pose.heading * M_PI / 180;
+        float forwardX = 6 * sinf(radians);
+        float forwardY = 6 * cosf(radians);
+        float cornersX[3] = {pose.x + forwardX, pose.x - 0.6f * (forwardX + forwardY), pose.x - 0.6f * (forwardX - forwardY)};
+        float cornersY[3] = {pose.y + forwardY, pose.y - 0.6f * (forwardY - forwardX), pose.y - 0.6f * (forwardY + forwardX)};
+        redraw->screen->setPenColor(vex::color::red);
+        redraw->screen->setPenWidth(2);
+        for(int i = 0; i < 3; i++){
+            redraw->screen->drawLine(redraw->graph->toScreenX(cornersX[i]), redraw->graph->toScreenY(cornersY[i]), \
+                redraw->graph->toScreenX(cornersX[(i + 1) % 3]), redraw->graph->toScreenY(cornersY[(i + 1) % 3]));
+        }
+        redraw->screen->render();
+        loop.wait();
+    }
+    return 0;
+}
+
+/**
+ * Finds the marker's pixels on the map, the left 240 by 240 pixels with a 2 pixel outline
+ */
+static void checkMarker(const sim::Screen& display){
+    uint32_t red = vex::color::red.rgb();
+    int left = 240;
+    int top = 240;
+    int right = -1;
+    int bottom = -1;
+    int outside = 0;
+    for(int y = 0; y < 240; y++){
+        for(int x = 0; x < 240; x++){
+            if(display.pixels[y * sim::Screen::width + x] != red) continue;
+            if(x < left) left = x;
+            if(x > right) right = x;
+            if(y < top) top = y;
+            if(y > bottom) bottom = y;
+            if(x < 2 || x > 237 || y < 2 || y > 237) outside++;
+        }
+    }
+    if(right < 0) printf("     no marker on the map\n");
+    else printf("     marker pixels span %d by %d from (%d, %d), %d on or past the outline\n", right - left + 1, bottom - top + 1, left, top, outside);
+}
+
+static void runRoute(Mode mode, const char* image){
+    sim::RobotConfig config;
+    sim::World world(config);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    chassis drive(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    drive.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+    drive.setTurnConstants(0.3, 1, 0.02, 10, 1, 100, -12, 12);
+    vex::thread odomTask([](void* arg){ ((odom*)arg)->start(); return 0; }, &tracker);
+
+    FieldMap fieldMap(&world.Brain_Screen, &tracker);
+    Graph graph(&world.Brain_Screen);
+    graph.setOutline(vex::color::white, 2);
+    graph.setGrid(24, 24, vex::color(110, 110, 110));
+    graph.setGraph(0, 240, 0, 240, vex::color(60, 60, 60));
+    graph.setScale(240 / 144.0f, 240 / 144.0f, -72, -72);
+    FullRedraw redraw = {&graph, &world.Brain_Screen, &tracker, true};
+    vex::thread redrawTask;
+    if(mode == full){
+        redrawTask = vex::thread(redrawFull, &redraw);
+        redrawTask.setPriority(vex::thread::threadPriorityLow);
+    }
+    else if(mode == map) fieldMap.start(20);
+    else if(mode == edge){
+        tracker.setPosition(60, 60, 0);
+        fieldMap.start(20);
+    }
+
+    uint64_t calls = world.display.drawCalls;
+    uint64_t pixels = world.display.pixelsWritten;
+    uint64_t frames = world.display.frames;
+    world.run(0.1);
+    drive.driveFor(36, 3);
+    drive.turnTo(90, 3);
+    drive.driveFor(36, 3);
+    drive.turnTo(180, 3);
+    drive.driveFor(24, 3);
+    drive.turnTo(300, 3);
+    world.run(0.3);
+
+    redraw.running = false;
+    fieldMap.stop();
+    if(mode == full) redrawTask.join();
+    LoopStats stats = tracker.getLoopStats();
+    Pose pose = tracker.getPose();
+    tracker.stop();
+    world.run(0.05);
+
+    frames = world.display.frames - frames;
+    double perFrame = frames > 0 ? frames : 1;
+    printf("%-4s %4llu frames, %5.0f draw calls and %6.0f pixels per frame, odom dt max %.2f ms, %u overruns, pose (%.4f, %.4f, %.3f)\n",
+        modeNames[mode], (unsigned long long)frames, (world.display.drawCalls - calls) / perFrame, (world.display.pixelsWritten - pixels) / perFrame,
+        stats.maxDt * 1000, stats.overruns, pose.x, pose.y, pose.heading);
+    if(mode == map || mode == edge) checkMarker(world.display);
+    if(image && mode == map) world.display.writePPM(image);
+}
+
+int main(int argc, char** argv){
+    const char* image = argc > 1 ? argv[1] : 0;
+    runRoute(none, image);
+    runRoute(full, image);
+    runRoute(map, image);
+    runRoute(edge, image);
+    return 0;
+}
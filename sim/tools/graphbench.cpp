@@ -0,0 +1,272 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       graphbench.cpp                                            */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Redraw cost of Graph against the nested vector version    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <new>
+#include <chrono>
+#include <vector>
+#include "screen.h"
+#include "grapher.h"
+#include "rollingextent.h"
+
+/**
+ * Usage: graphbench [redraws]
+ *
+ * Redraws a PID step response trace (autoScale, drawOutline, drawData) of
+ * 100 to a million points on the simulated screen, with Graph drawing from a
+ * Series and with the old Graph that took std::vector<std::vector<float>> by
+ * value, kept below as it was. Prints the time, heap allocations and draw
+ * calls per redraw and whether both drew the same pixels, then the same for
+ * autoScale alone, which draws nothing and so shows what reaching the points
+ * costs. Traces over 5000 points are redrawn 3 times.
+ *
+ * Then times the min and max of a sliding window kept by RollingExtent
+ * against rescanning the window, and streams a minute of samples into a
+ * Graph with a 5 second window, printing the draw calls per frame. Streams a
+ * slow, smooth wave into a 20 second window too, 2000 samples where a stream
+ * keeps 1024 with climbs long enough that the rolling extent runs out of room,
+ * and checks every kept sample in the window is drawn inside the plot both times.
+ */
+
+static uint64_t allocations = 0;
+
+void* operator new(size_t size){
+    allocations++;
+    void* memory = malloc(size ? size : 1);
+    if(!memory) abort();
+    return memory;
+}
+
+void operator delete(void* memory) noexcept{
+    free(memory);
+}
+
+/**
+ * Graph before it took a Series, the drawing and scaling code unchanged
+ */
+class LegacyGraph{
+public:
+    vex::brain::lcd* Brain_Screen;
+    float xPixelsPerUnit;
+    float yPixelsPerUnit;
+    float minXValue;
+    float minYValue;
+    vex::color backgroundColor;
+    int minXPixel, minYPixel, maxXPixel, maxYPixel;
+
+    LegacyGraph(vex::brain::lcd* Brain_Screen) : Brain_Screen(Brain_Screen){}
+
+    void drawOutline(vex::color color, int thickness){
+        this->Brain_Screen->setPenColor(color);
+        this->Brain_Screen->setFillColor(backgroundColor);
+        this->Brain_Screen->setPenWidth(thickness);
+        this->Brain_Screen->drawRectangle(this->minXPixel, 240-this->maxYPixel, this->maxXPixel-this->minXPixel, this->maxYPixel-this->minYPixel);
+    }
+
+    void drawData(std::vector<std::vector<float>> data, vex::color dataColor, int penThickness){
+        this->Brain_Screen->setPenColor(dataColor);
+
+        if(data.size() == 0) {}
+        else if(data.size() == 1){
+            this->Brain_Screen->drawCircle((data.at(0).at(0) - this->minXValue) * this->xPixelsPerUnit + this->minXPixel, 240 - (this->minYPixel + (data.at(0).at(1) - this->minYValue) * this->yPixelsPerUnit), penThickness);
+        }
+        else{
+            this->Brain_Screen->setPenWidth(penThickness);
+
+            for(size_t i = 0; i < data.size() - 1; i++){
+                this->Brain_Screen->drawLine((data.at(i).at(0) - this->minXValue) * this->xPixelsPerUnit + this->minXPixel, 240 - (this->minYPixel + (data.at(i).at(1) - this->minYValue) * this->yPixelsPerUnit),\
+                                                (data.at(i + 1).at(0) - this->minXValue) * this->xPixelsPerUnit + this->minXPixel, 240 - (this->minYPixel + (data.at(i + 1).at(1) - this->minYValue) * this->yPixelsPerUnit));
+            }
+        }
+    }
+
+    void autoScale(std::vector<std::vector<float>> data){
+        float minX = data.at(0).at(0);
+        float maxX = minX;
+        float minY = data.at(0).at(1);
+        float maxY = minY;
+
+        for (size_t i = 1; i < data.size(); i++){
+            float tempX = data.at(i).at(0);
+            float tempY = data.at(i).at(1);
+
+            if(tempX < minX) minX = tempX;
+            if(tempX > maxX) maxX = tempX;
+            if(tempY < minY) minY = tempY;
+            if(tempY > maxY) maxY = tempY;
+        }
+
+        this->xPixelsPerUnit = (this->maxXPixel - this->minXPixel) / (maxX - minX);
+        this->yPixelsPerUnit = (this->maxYPixel - this->minYPixel) / (maxY - minY);
+        this->minXValue = minX;
+        this->minYValue = minY;
+    }
+};
+
+/**
+ * An underdamped step response with sensor noise, time in seconds against inches
+ */
+static float response(int i, int points){
+    float t = 3.0f * i / points;
+    return 24 * (1 - expf(-2.5f * t) * cosf(9 * t)) + 0.05f * sinf(i * 12.9898f);
+}
+
+struct Timing{
+    double microseconds;
+    double allocations;
+    double drawCalls;
+};
+
+template<class Redraw>
+static Timing timeRedraws(int redraws, const sim::Screen& screen, Redraw redraw){
+    uint64_t startAllocations = allocations;
+    uint64_t startCalls = screen.drawCalls;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int r = 0; r < redraws; r++) redraw();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    Timing timing = {seconds / redraws * 1e6, (double)(allocations - startAllocations) / redraws, (double)(screen.drawCalls - startCalls) / redraws};
+    return timing;
+}
+
+/**
+ * RollingExtent against rescanning the window after every sample
+ */
+static void rollingExtent(int samples, int window){
+    std::vector<float> ys(samples);
+    for(int i = 0; i < samples; i++) ys[i] = (1 + 0.5f * sinf(i * 0.0007f)) * sinf(i * 0.05f) + 0.1f * sinf(i * 12.9898f);
+
+    RollingExtent<4096> extent;
+    double extentSum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int i = 0; i < samples; i++){
+        extent.push(i, ys[i]);
+        extent.evictBefore(i - window + 1);
+        extentSum += extent.getMax() - extent.getMin();
+    }
+    double extentTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / samples;
+
+    double scanSum = 0;
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < samples; i++){
+        float low = ys[i];
+        float high = ys[i];
+        for(int j = i - window + 1 > 0 ? i - window + 1 : 0; j < i; j++){
+            if(ys[j] < low) low = ys[j];
+            if(ys[j] > high) high = ys[j];
+        }
+        scanSum += high - low;
+    }
+    double scanTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / samples;
+
+    printf("extent   %d samples, window of %d: rescan %7.1f ns per sample, rolling %5.1f ns per sample, extents %s\n",
+        samples, window, scanTime, extentTime, extentSum == scanSum ? "match" : "DO NOT MATCH");
+}
+
+/**
+ * A long trace streamed into a window of span seconds, 3 samples a frame
+ * The trace is a wave of frequency radians per second with noise of the given size.
+ */
+static void windowedStream(int samples, float span, float frequency, float noise){
+    std::vector<sim::Screen> screens(1);
+    vex::brain::lcd screen(&screens[0]);
+    PlotStream trace;
+    Graph graph(&screen);
+    graph.setOutline(vex::color::white, 2);
+    graph.setGraph(40, 460, 20, 220, vex::color::black);
+    graph.addStream(&trace, vex::color::green, 1);
+    graph.setWindow(span);
+
+    int frames = 0;
+    uint64_t mostCalls = 0;
+    uint64_t startCalls = screens[0].drawCalls;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int i = 0; i < samples; i++){
+        float t = i * 0.01f;
+        trace.push(t, (1 + 0.5f * sinf(t * 0.07f)) * sinf(t * frequency) + noise * sinf(i * 12.9898f));
+        if(i % 3 != 2) continue;
+
+        uint64_t calls = screens[0].drawCalls;
+        graph.drawStreams();
+        frames++;
+        if(screens[0].drawCalls - calls > mostCalls) mostCalls = screens[0].drawCalls - calls;
+    }
+    double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+
+    // the y axis has to fit every kept sample right of the window's left edge
+    int outside = 0;
+    for(uint32_t sample = PlotStream::getOldest(trace.getHead()); sample < trace.getHead(); sample++){
+        int y = graph.toScreenY(trace.getY(sample));
+        if(graph.toScreenX(trace.getX(sample)) >= 40 && (y < 20 || y > 220)) outside++;
+    }
+    printf("window   %d samples in %d frames, %2.0f s window, %u from scratch, %.1f draw calls per frame and %llu at most, %.1f us per frame, %d kept samples outside the plot\n",
+        samples, frames, span, graph.getRedraws(), (double)(screens[0].drawCalls - startCalls) / frames, (unsigned long long)mostCalls,
+        microseconds, outside);
+}
+
+int main(int argc, char** argv){
+    int redraws = argc > 1 ? atoi(argv[1]) : 200;
+    int sizes[5] = {100, 1000, 5000, 100000, 1000000};
+
+    for(int size : sizes){
+        int count = size > 5000 ? 3 : redraws;
+        std::vector<std::vector<float>> nested;
+        nested.reserve(size);
+        Series series(size);
+        for(int i = 0; i < size; i++){
+            float t = 3.0f * i / size;
+            nested.push_back({t, response(i, size)});
+            series.push(t, response(i, size));
+        }
+
+        // screens are 460 KB each, kept off the stack
+        std::vector<sim::Screen> screens(2);
+        vex::brain::lcd legacyScreen(&screens[0]);
+        vex::brain::lcd seriesScreen(&screens[1]);
+
+        LegacyGraph legacy(&legacyScreen);
+        legacy.minXPixel = 40;
+        legacy.minYPixel = 20;
+        legacy.maxXPixel = 460;
+        legacy.maxYPixel = 220;
+        legacy.backgroundColor = vex::color::black;
+
+        Graph graph(&seriesScreen);
+        graph.setOutline(vex::color::white, 2);
+        graph.setGraph(40, 460, 20, 220, vex::color::black);
+
+        Timing before = timeRedraws(count, screens[0], [&](){
+            legacy.autoScale(nested);
+            legacy.drawOutline(vex::color::white, 2);
+            legacy.drawData(nested, vex::color::green, 1);
+        });
+        Timing after = timeRedraws(count, screens[1], [&](){
+            graph.autoScale(series);
+            graph.drawOutline();
+            graph.drawData(series, vex::color::green, 1);
+        });
+
+        int differing = 0;
+        for(int i = 0; i < sim::Screen::width * sim::Screen::height; i++) differing += screens[0].pixels[i] != screens[1].pixels[i];
+
+        // autoScale draws nothing, so this is the cost of reaching the points alone
+        Timing beforeScale = timeRedraws(count, screens[0], [&](){ legacy.autoScale(nested); });
+        Timing afterScale = timeRedraws(count, screens[1], [&](){ graph.autoScale(series); });
+
+        printf("%7d points  nested %9.1f us %7.0f allocations %7.0f draw calls, series %7.1f us %.0f allocations %4.0f draw calls, %d pixels differ\n",
+            size, before.microseconds, before.allocations, before.drawCalls, after.microseconds, after.allocations, after.drawCalls, differing);
+        printf("               autoScale alone: nested %9.1f us %7.0f allocations, series %7.1f us (%.0fx)\n",
+            beforeScale.microseconds, beforeScale.allocations, afterScale.microseconds, beforeScale.microseconds / afterScale.microseconds);
+    }
+
+    rollingExtent(200000, 500);
+    windowedStream(60000, 5, 5, 0.1f);
+    windowedStream(60000, 20, 0.1f, 0);
+    return 0;
+}
@@ -0,0 +1,213 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       history.cpp                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Checks pose lookups in PoseHistory and odom::poseAt       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+#include "posehistory.h"
+
+/**
+ * Usage: history
+ *
+ * Runs PoseHistory and odom::poseAt through the cases latency compensation
+ * leans on and prints each check:
+ *   interpolation  between two poses, heading the short way across 0, exactly on a pose
+ *   out of range   older than the oldest pose or newer than the newest, clamped and false
+ *   wraparound     a small ring pushed past its capacity keeps only the newest poses
+ *   restarts       same timestamp is pushed after it, an older one starts over, clear empties it
+ *   torn slots     a lookup on another thread while a push is half way through
+ *                  writing the oldest slot waits for the push instead of using it
+ *   odom           poseAt on a simulated drive matches the published poses, and a
+ *                  setPosition forgets the poses from before it
+ * Exits with 1 if any check fails, "make check-history" runs it.
+ */
+
+static int failures = 0;
+
+static void check(const char* name, bool passed){
+    printf("%-62s %s\n", name, passed ? "ok" : "FAIL");
+    if(!passed) failures++;
+}
+
+static bool near(float a, float b, float tolerance = 1e-4f){
+    return fabsf(a - b) <= tolerance;
+}
+
+static Pose makePose(float x, float y, float heading, uint64_t timestamp){
+    Pose pose;
+    pose.x = x;
+    pose.y = y;
+    pose.heading = heading;
+    pose.timestamp = timestamp;
+    return pose;
+}
+
+static void checkInterpolation(){
+    PoseHistory<16> history;
+    Pose pose;
+    check("empty history finds nothing", !history.poseAt(1000, pose));
+
+    history.push(makePose(0, 0, 350, 1000));
+    history.push(makePose(10, -4, 10, 2000));
+    bool found = history.poseAt(1500, pose);
+    check("halfway between two poses is their midpoint", found && near(pose.x, 5) && near(pose.y, -2) && pose.timestamp == 1500);
+    check("heading turns the short way across 0", found && (near(pose.heading, 0) || near(pose.heading, 360)));
+    found = history.poseAt(1250, pose);
+    check("a quarter of the way is a quarter of the change", found && near(pose.x, 2.5f) && near(pose.heading, 355));
+    found = history.poseAt(2000, pose);
+    check("exactly on the newest pose returns it", found && pose.x == 10 && pose.heading == 10);
+    found = history.poseAt(1000, pose);
+    check("exactly on the oldest pose returns it", found && pose.x == 0 && pose.heading == 350);
+}
+
+static void checkOutOfRange(){
+    PoseHistory<16> history;
+    for(int i = 0; i < 5; i++) history.push(makePose(i, 2 * i, 90, 1000 + 10000 * i));
+    Pose pose;
+    bool found = history.poseAt(500, pose);
+    check("older than the history is false, clamped to the oldest", !found && pose.x == 0 && pose.timestamp == 1000);
+    found = history.poseAt(100000, pose);
+    check("newer than the newest is false, clamped to the newest", !found && pose.x == 4 && pose.timestamp == 41000);
+}
+
+static void checkWraparound(){
+    PoseHistory<8> history;
+    for(int i = 0; i < 20; i++) history.push(makePose(i, 0, 0, 1000 * (i + 1)));
+    Pose pose;
+    check("a full ring holds capacity poses", history.size() == 8);
+    bool found = history.poseAt(12000, pose);
+    check("a pose pushed out of the ring is not found", !found && pose.x == 12);
+    found = history.poseAt(13000, pose);
+    check("the oldest pose kept is found", found && pose.x == 12);
+    found = history.poseAt(16500, pose);
+    check("interpolation across the ring's seam", found && near(pose.x, 15.5f));
+    found = history.poseAt(20000, pose);
+    check("the newest pose after wrapping is found", found && pose.x == 19);
+}
+
+static void checkRestarts(){
+    PoseHistory<8> history;
+    history.push(makePose(0, 0, 0, 1000));
+    history.push(makePose(1, 0, 0, 2000));
+    history.push(makePose(5, 0, 0, 2000));
+    Pose pose;
+    check("a pose with the newest timestamp is pushed and wins", history.size() == 3 && history.poseAt(2000, pose) && pose.x == 5);
+    history.push(makePose(9, 0, 0, 3000));
+    check("a lookup on a shared timestamp finds the newer pose", history.poseAt(2000, pose) && pose.x == 5);
+    history.push(makePose(7, 0, 0, 1500));
+    check("an older timestamp starts the history over", history.size() == 1 && !history.poseAt(1200, pose) && pose.x == 7);
+    history.clear();
+    check("clear forgets every pose", history.size() == 0 && !history.poseAt(1500, pose));
+}
+
+/**
+ * A pose slot whose write stops half way, after x and y, to let a lookup run
+ */
+struct WatchedPose{
+    float x = 0;
+    float y = 0;
+    float heading = 0;
+    uint64_t timestamp = 0;
+
+    static void (*halfway)();
+
+    WatchedPose& operator=(const Pose& pose){
+        this->x = pose.x;
+        this->y = pose.y;
+        if(halfway) halfway();
+        this->heading = pose.heading;
+        this->timestamp = pose.timestamp;
+        return *this;
+    }
+
+    operator Pose() const{
+        return makePose(this->x, this->y, this->heading, this->timestamp);
+    }
+};
+
+void (*WatchedPose::halfway)() = 0;
+
+static PoseHistory<8, WatchedPose> watched;
+static std::thread lookup;
+static std::atomic<bool> lookupDone(false);
+static bool lookupFound;
+static Pose lookupPose;
+
+/**
+ * Runs while a push is half way through the oldest slot: looks a pose up from another
+ * thread and gives it 100 ms to finish before the push goes on
+ */
+static void lookupHalfway(){
+    WatchedPose::halfway = 0;
+    lookup = std::thread([](){
+        lookupFound = watched.poseAt(3500, lookupPose);
+        lookupDone.store(true);
+    });
+    for(int i = 0; i < 100 && !lookupDone.load(); i++) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    check("a lookup waits while the slot it needs is half written", !lookupDone.load());
+}
+
+static void checkTornSlot(){
+    // pose i is at x = i, 1000 * (i + 1) microseconds, so a pose torn between two pushes is easy to see
+    for(int i = 0; i < 10; i++) watched.push(makePose(i, 0, 0, 1000 * (i + 1)));
+    WatchedPose::halfway = lookupHalfway;
+    watched.push(makePose(10, 0, 0, 11000));
+    lookup.join();
+    check("a lookup after the push finished is not torn", !lookupFound && lookupPose.x == 3 && lookupPose.timestamp == 4000);
+}
+
+static void checkOdom(){
+    sim::RobotConfig config;
+    sim::World world(config);
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    chassis drive(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    drive.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+    vex::thread odomTask([](void* arg){ ((odom*)arg)->start(); return 0; }, &tracker);
+
+    // remember a published pose part way through the drive
+    world.run(0.1);
+    MotionHandle motion = drive.driveForAsync(24);
+    world.run(0.4);
+    Pose middle = tracker.getPose();
+    motion.waitUntilSettled();
+    Pose end = tracker.getPose();
+
+    Pose pose;
+    bool found = tracker.poseAt(middle.timestamp, pose);
+    check("odom poseAt on a published pose returns it", found && pose.x == middle.x && pose.y == middle.y);
+    found = tracker.poseAt(middle.timestamp + 5000, pose);
+    check("odom poseAt between updates lies between them", found && pose.y > middle.y && pose.y < end.y);
+    found = tracker.poseAt(end.timestamp + 1000000, pose);
+    check("odom poseAt past the newest update is false", !found);
+
+    tracker.setPosition(0, 0, 0);
+    found = tracker.poseAt(middle.timestamp, pose);
+    check("odom poseAt before a setPosition is false", !found && pose.x == 0 && pose.y == 0);
+    tracker.stop();
+    world.run(0.05);
+}
+
+int main(){
+    checkInterpolation();
+    checkOutOfRange();
+    checkWraparound();
+    checkRestarts();
+    checkTornSlot();
+    checkOdom();
+    printf("%d failed\n", failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,189 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       intake.cpp                                                */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Button to motor latency of the intake during color sorts  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include "world.h"
+#include "intake.h"
+#include "looptimer.h"
+
+using namespace vex;
+
+/**
+ * Usage: intake
+ *
+ * Turns the intake on, feeds it one ring and presses L1 to stop it at a range
+ * of times after the ring reaches the optical sensor, each on a fresh simulated
+ * intake. Runs the old blocking intake_Functionality (kept here as it was) and
+ * the Intake state machine through three cases:
+ *   eject      an opponent ring, carried 58 degrees and thrown back 3
+ *   redirect   our own ring with redirect mode on, carried 20 degrees and reversed 370
+ *   jam        an opponent ring with the hook stuck from the moment it is seen
+ * A press is held for 100 ms like a tap. First runs the eject and redirect with
+ * no press to show both intakes sort the ring alike, then prints how many
+ * presses stopped the hook within 2 s and the mean and worst time from press to
+ * stopped hook.
+ */
+
+enum Case{ eject, redirect, jam };
+static const char* caseNames[3] = {"eject", "redirect", "jam"};
+
+static const uint32_t ringTime = 200;   // ms after start the ring reaches the sensor
+static const uint32_t ringLength = 60;  // ms the sensor sees it
+static const uint32_t tapLength = 100;
+static const uint32_t giveUp = 2000;
+
+/**
+ * The driver's buttons and what the optical sensor sees, written by the driver task
+ */
+static IntakeInput input;
+static motor* Hook = 0;
+static motor* Front = 0;
+
+/**
+ * intake_Functionality before the state machine, reading input instead of the controller and sensor
+ */
+static bool toggle;
+static bool L1wasPressing;
+static bool wasYPressing;
+static bool redirectMode;
+static bool isRed = true;
+
+static int legacyIntake(){
+  while(true){
+    if (input.toggle && !L1wasPressing) {
+      toggle = !toggle;
+    }
+    if (input.reverse) {
+      Hook->spin(reverse, 100, percent);
+      Front->spin(reverse, 100, percent);
+    } else if (toggle) {
+      Hook->spin(fwd, 100, percent);
+      Front->spin(fwd, 100, percent);
+    } else {
+      Hook->stop();
+      Front->stop();
+    }
+    if (input.redirect && !wasYPressing) {
+      redirectMode = !redirectMode;
+    }
+    wasYPressing = input.redirect;
+    L1wasPressing = input.toggle;
+
+    if (input.nearObject) {
+      if (input.hue > 180 && input.hue < 240) {
+        float targetPosition = Hook->position(degrees) + 58;
+        float backTargetPosition = targetPosition - 3;
+        if (input.hue > 180 && input.hue < 240 && Hook->position(degrees) < targetPosition){
+          waitUntil(Hook->position(degrees) > targetPosition);
+        }
+        waitUntil(Hook->position(degrees) > targetPosition);
+        Hook->spin(reverse, 100, percent);
+        Front->spin(reverse, 100, percent);
+        waitUntil(Hook->position(degrees) < backTargetPosition);
+      }
+      if(((isRed && input.hue > 0 && input.hue < 30) \
+      || (!isRed && input.hue > 180 && input.hue < 240)) && redirectMode){
+        float targetPosition = Hook->position(degrees) + 20.215;
+        float backTargetPosition = Hook->position(degrees) - 350;
+        waitUntil(Hook->position(degrees) > targetPosition);
+        Hook->spin(reverse, 100, percent);
+        Front->spin(reverse, 100, percent);
+        waitUntil(Hook->position(degrees) < backTargetPosition);
+        redirectMode = false;
+        }
+    }
+    this_thread::sleep_for(10);
+  }
+  return 0;
+}
+
+static Intake* machine = 0;
+
+static int stateMachineIntake(){
+  LoopTimer loop(10);
+  while(true){
+    machine->update(input);
+    loop.wait();
+  }
+  return 0;
+}
+
+/**
+ * Runs one press on a fresh intake, or none with pressAt past the end
+ * Also finds when the hook first reversed after the ring was seen and the furthest it went back.
+ *
+ * @return  ms from the press to the hook stopping, or -1 if it never did
+ */
+static int runPress(bool legacy, Case which, uint32_t pressAt, int* reversedAt = 0, float* lowest = 0){
+    sim::World world;
+    motor hook = world.motor(PORT19);
+    motor front = world.motor(PORT3);
+    Hook = &hook;
+    Front = &front;
+    input = IntakeInput();
+    toggle = L1wasPressing = wasYPressing = redirectMode = false;
+    Intake intake(&hook, &front);
+    machine = &intake;
+    // the task runs until world, and every task in it, ends with runPress
+    thread(legacy ? legacyIntake : stateMachineIntake);
+
+    // on, and redirect armed when it is wanted, both as taps well before the ring
+    float ringPosition = 0;
+    int latency = -1;
+    for(uint32_t t = 0; t < ringTime + (pressAt < giveUp ? pressAt : 0) + giveUp; t++){
+        input.toggle = t >= 20 && t < 20 + tapLength;
+        input.redirect = which == redirect && t >= 20 && t < 20 + tapLength;
+        if(t >= ringTime + pressAt && t < ringTime + pressAt + tapLength) input.toggle = true;
+        input.nearObject = t >= ringTime && t < ringTime + ringLength;
+        input.hue = which == redirect ? 15 : 210;
+
+        if(t == ringTime) ringPosition = hook.position(degrees);
+        if(reversedAt && t >= ringTime && *reversedAt < 0 && hook.voltage() < 0) *reversedAt = t - ringTime;
+        if(lowest && t >= ringTime && hook.position(degrees) - ringPosition < *lowest) *lowest = hook.position(degrees) - ringPosition;
+        if(which == jam && t >= ringTime) hook.setPosition(ringPosition, degrees);
+
+        if(t >= ringTime + pressAt && hook.voltage() == 0){
+            latency = t - (ringTime + pressAt);
+            break;
+        }
+        task::sleep(1);
+    }
+    return latency;
+}
+
+int main(){
+    printf("ring seen at %u ms, L1 pressed 0 to 300 ms later for %u ms, hook stopped within %u ms\n", ringTime, tapLength, giveUp);
+    for(int which = eject; which <= redirect; which++){
+        for(int legacy = 1; legacy >= 0; legacy--){
+            int reversedAt = -1;
+            float lowest = 0;
+            runPress(legacy, (Case)which, 100000, &reversedAt, &lowest);
+            printf("%-8s %-13s no press, hook reversed %3d ms after the ring was seen and went back to %7.1f degrees from there\n",
+                caseNames[which], legacy ? "blocking" : "state machine", reversedAt, lowest);
+        }
+    }
+    for(int which = eject; which <= jam; which++){
+        for(int legacy = 1; legacy >= 0; legacy--){
+            int presses = 0;
+            int stopped = 0;
+            int total = 0;
+            int worst = 0;
+            for(uint32_t pressAt = 0; pressAt <= 300; pressAt += 5){
+                int latency = runPress(legacy, (Case)which, pressAt);
+                presses++;
+                if(latency < 0) continue;
+                stopped++;
+                total += latency;
+                if(latency > worst) worst = latency;
+            }
+            printf("%-8s %-13s %2d of %2d presses stopped the hook, mean %5.1f ms, worst %4d ms\n", caseNames[which],
+                legacy ? "blocking" : "state machine", stopped, presses, stopped ? (float)total / stopped : 0.0f, worst);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,221 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       logdecode.cpp                                             */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Converts telemetry logs to CSV or columns, and benchmarks */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "logformat.h"
+#include "logreader.h"
+
+/**
+ * Usage: logdecode log [prefix] [--columns]
+ *        logdecode --bench [records] [prefix]
+ *
+ * The first form decodes a log written by the brain's Telemetry and writes
+ * prefix_channel.csv for every channel in it (prefix defaults to the log's
+ * name without its extension), or prefix_channel.col with --columns. Prints
+ * the records per channel, what was dropped or damaged, and the decode speed.
+ *
+ * --bench encodes a synthetic match (default 2 million records, odom and
+ * sensors every 10 ms plus a motion and path record) in 128 record blocks the
+ * way Telemetry does, and prints bytes per record, encode and decode speed, CSV
+ * speed, whether every value came back exactly, and what is recovered from the
+ * log cut off part way through a block and with a damaged block.
+ */
+
+typedef std::chrono::steady_clock Clock;
+
+static double secondsSince(Clock::time_point start){
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void printSummary(const LogReader& reader){
+    for(const LogColumns& channel : reader.getChannels()){
+        if(channel.size() == 0) continue;
+        double seconds = (channel.timestamp.back() - channel.timestamp.front()) / 1e6;
+        printf("  %-8s %9zu records over %8.2f s, %zu fields\n", channel.name.c_str(), channel.size(), seconds, channel.fields.size());
+    }
+    const LogStats& stats = reader.getStats();
+    printf("  %u blocks, %u damaged, %u cut off, %llu bytes skipped\n", stats.blocks, stats.badBlocks, stats.truncatedBlocks,
+        (unsigned long long)stats.skippedBytes);
+    printf("  %llu records dropped on the brain, %llu of them seen as sequence gaps\n", (unsigned long long)stats.reportedDrops,
+        (unsigned long long)stats.dropped);
+}
+
+static int decodeFile(const char* path, std::string prefix, bool columns){
+    if(prefix.empty()){
+        prefix = path;
+        size_t dot = prefix.rfind('.');
+        if(dot != std::string::npos && prefix.find('/', dot) == std::string::npos) prefix.erase(dot);
+    }
+
+    FILE* file = fopen(path, "rb");
+    if(!file){
+        printf("cannot open %s\n", path);
+        return 1;
+    }
+    std::vector<uint8_t> data;
+    uint8_t chunk[1 << 16];
+    size_t got;
+    while((got = fread(chunk, 1, sizeof(chunk), file)) > 0) data.insert(data.end(), chunk, chunk + got);
+    fclose(file);
+
+    LogReader reader;
+    std::string error;
+    Clock::time_point start = Clock::now();
+    if(!reader.read(data.data(), data.size(), error)){
+        printf("%s: %s\n", path, error.c_str());
+        return 1;
+    }
+    double decodeTime = secondsSince(start);
+
+    start = Clock::now();
+    uint64_t written = 0;
+    bool ok = columns ? reader.writeColumns(prefix.c_str(), &written) : reader.writeCSV(prefix.c_str(), &written);
+    double writeTime = secondsSince(start);
+    if(!ok){
+        printf("cannot write %s_*\n", prefix.c_str());
+        return 1;
+    }
+
+    printf("%s: version %d, %zu bytes, %llu records, decoded at %.0f MB/s\n", path, reader.getVersion(), data.size(),
+        (unsigned long long)reader.getStats().records, data.size() / decodeTime / 1e6);
+    printSummary(reader);
+    printf("  wrote %s_*.%s, %.1f MB at %.0f MB/s\n", prefix.c_str(), columns ? "col" : "csv", written / 1e6, written / writeTime / 1e6);
+    return 0;
+}
+
+/**
+ * A synthetic match, a robot weaving around the field with its sensors turning along
+ */
+static std::vector<TelemetryRecord> syntheticMatch(long count){
+    std::vector<TelemetryRecord> records;
+    records.reserve(count);
+    uint16_t sequences[2] = {0, 0};
+    for(long tick = 0; (long)records.size() < count; tick++){
+        float t = tick * 0.01f;
+        uint32_t time = 100000 + tick * 10000 + (tick * 7919 % 300);
+        float x = 48 * sinf(t * 0.3f);
+        float y = 48 * sinf(t * 0.17f + 1);
+        float heading = fmodf(t * 40, 360);
+
+        TelemetryRecord odom = {time, 0, (uint8_t)TelemetryChannel::odom, sequences[0]++, {x, y, heading, 0.01f, 0, 0}};
+        TelemetryRecord sensors = {time + 40, 0, (uint8_t)TelemetryChannel::sensors, sequences[0]++,
+            {t * 700, t * 90, t * 650, t * 610, t * 40, 40 + 5 * sinf(t)}};
+        TelemetryRecord motion = {time + 200, 1, (uint8_t)TelemetryChannel::motion, sequences[1]++,
+            {fmodf(t, 3) * 8, fmodf(t, 3) * 7.9f, 24 - fmodf(t, 3) * 8, 12 * cosf(t)}};
+        TelemetryRecord path = {time + 260, 1, (uint8_t)TelemetryChannel::path, sequences[1]++, {x, y, heading, 8 + sinf(t), 8 - sinf(t)}};
+        records.push_back(odom);
+        records.push_back(sensors);
+        records.push_back(motion);
+        records.push_back(path);
+    }
+    records.resize(count);
+    return records;
+}
+
+/**
+ * Whether every decoded value is the original rounded to its field's scale
+ */
+static bool roundTrips(const std::vector<TelemetryRecord>& records, const LogReader& reader){
+    size_t rows[16] = {};
+    for(const TelemetryRecord& record : records){
+        const logformat::Channel* schema = 0;
+        for(int i = 0; i < logformat::channelCount; i++) if(logformat::channels[i].id == record.channel) schema = &logformat::channels[i];
+        const LogColumns* channel = schema ? reader.getChannel(schema->name) : 0;
+        if(!channel) return false;
+
+        size_t row = rows[record.channel]++;
+        if(row >= channel->size() || channel->timestamp[row] != record.timestamp || channel->sequence[row] != record.sequence) return false;
+        for(int j = 0; j < schema->fieldCount; j++){
+            if(channel->fields[j][row] != logformat::quantize(record.values[j], schema->fields[j].scale)) return false;
+        }
+    }
+    return true;
+}
+
+static int bench(long count, const char* prefix){
+    std::vector<TelemetryRecord> records = syntheticMatch(count);
+
+    std::vector<uint8_t> log(4096);
+    log.resize(logformat::writeHeader(log.data(), log.size()));
+    std::vector<uint8_t> block(128 * logformat::maxRecordBytes + logformat::maxBlockOverhead);
+    std::vector<size_t> blockStarts;
+    Clock::time_point start = Clock::now();
+    for(long i = 0; i < count; i += 128){
+        uint32_t n = count - i < 128 ? count - i : 128;
+        uint32_t bytes = logformat::encodeBlock(records.data() + i, n, block.data());
+        blockStarts.push_back(log.size());
+        log.insert(log.end(), block.begin(), block.begin() + bytes);
+    }
+    double encodeTime = secondsSince(start);
+    printf("encode   %ld records in %zu bytes, %.2f bytes per record (%.1fx smaller than the raw records), %.0f ns per record\n",
+        count, log.size(), (double)log.size() / count, 32.0 * count / log.size(), encodeTime / count * 1e9);
+
+    LogReader reader;
+    std::string error;
+    start = Clock::now();
+    if(!reader.read(log.data(), log.size(), error)){
+        printf("decode failed: %s\n", error.c_str());
+        return 1;
+    }
+    double decodeTime = secondsSince(start);
+    printf("decode   %.0f MB/s of log, %.1f M records/s, values %s\n", log.size() / decodeTime / 1e6,
+        count / decodeTime / 1e6, roundTrips(records, reader) ? "match exactly" : "DO NOT MATCH");
+
+    uint64_t written = 0;
+    start = Clock::now();
+    reader.writeCSV(prefix, &written);
+    double csvTime = secondsSince(start);
+    start = Clock::now();
+    uint64_t columnBytes = 0;
+    reader.writeColumns(prefix, &columnBytes);
+    double columnTime = secondsSince(start);
+    printf("csv      %.1f MB at %.0f MB/s, columns %.1f MB at %.0f MB/s\n", written / 1e6, written / csvTime / 1e6,
+        columnBytes / 1e6, columnBytes / columnTime / 1e6);
+
+    // cut part way through a block near the end
+    size_t cut = blockStarts[blockStarts.size() * 3 / 5] + 700;
+    LogReader truncated;
+    truncated.read(log.data(), cut, error);
+    printf("cut off  at byte %zu: %llu records recovered, %u blocks, %u cut off\n", cut,
+        (unsigned long long)truncated.getStats().records, truncated.getStats().blocks, truncated.getStats().truncatedBlocks);
+
+    // flip a byte in the middle of a block
+    std::vector<uint8_t> damaged = log;
+    damaged[blockStarts[10] + 300] ^= 0x40;
+    LogReader repaired;
+    repaired.read(damaged.data(), damaged.size(), error);
+    printf("damaged  one block: %llu of %ld records recovered, %u damaged blocks, %llu bytes skipped\n",
+        (unsigned long long)repaired.getStats().records, count, repaired.getStats().badBlocks,
+        (unsigned long long)repaired.getStats().skippedBytes);
+    return 0;
+}
+
+int main(int argc, char** argv){
+    if(argc < 2){
+        printf("usage: logdecode log [prefix] [--columns]\n       logdecode --bench [records] [prefix]\n");
+        return 1;
+    }
+    if(strcmp(argv[1], "--bench") == 0){
+        long count = argc > 2 ? atol(argv[2]) : 2000000;
+        return bench(count, argc > 3 ? argv[3] : "bench");
+    }
+
+    std::string prefix;
+    bool columns = false;
+    for(int i = 2; i < argc; i++){
+        if(strcmp(argv[i], "--columns") == 0) columns = true;
+        else prefix = argv[i];
+    }
+    return decodeFile(argv[1], prefix, columns);
+}
@@ -0,0 +1,149 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pidbench.cpp                                              */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Cost of PID::getOutput against the old runtime PID class  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <chrono>
+#include <random>
+#include "pid.h"
+
+/**
+ * Usage: pidbench [updates]
+ *
+ * Feeds the same error sequence (default 20 million updates) through the
+ * PID class as it was before the policy template, through the PID alias,
+ * and through a few other policy combinations, checks that the alias gives
+ * exactly the old outputs, and prints nanoseconds per getOutput.
+ */
+
+/**
+ * The runtime PID class this file benchmarks against, kept as it was
+ */
+class LegacyPID{
+    float Kp;
+    float Ki;
+    float Kd;
+    float integralTolerance;
+    float settleTolerance;
+    float settleTime;
+    float minOutput;
+    float maxOutput;
+    int cycleTime;
+
+    float previousError = 0;
+    float integral = 0;
+    float timeSettled = 0;
+
+public:
+    LegacyPID(float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, \
+        float settleTime, float minOutput, float maxOutput, int cycleTime){
+
+        this->Kp = Kp;
+        this->Ki = Ki;
+        this->Kd = Kd;
+        this->integralTolerance = integralTolerance;
+        this->settleTolerance = settleTolerance;
+        this->settleTime = settleTime;
+        this->minOutput = minOutput;
+        this->maxOutput = maxOutput;
+        this->cycleTime = cycleTime;
+    }
+
+    float getOutput(float error, bool stopIOvershoot = true){
+        if((error * this->previousError < 0 && stopIOvershoot) || \
+            fabs(error) > this->integralTolerance) this->integral = 0;
+        else this->integral += error;
+
+        float output = this->Kp * error + this->Ki * this->integral + this->Kd * (error - this->previousError);
+
+        this->previousError = error;
+
+        if(fabs(error) < this->settleTolerance) this->timeSettled += this->cycleTime;
+        else this->timeSettled = 0;
+
+        if(output > this->maxOutput) output = this->maxOutput;
+        if(output < this->minOutput) output = this->minOutput;
+
+        return output;
+    }
+
+    bool isSettled(){
+        return (this->settleTime <= this->timeSettled);
+    }
+};
+
+typedef PIDController<policy::NoIntegral, policy::ErrorDerivative, policy::NoFeedforward, policy::NoSlew, policy::NoSettle> PDOnly;
+typedef PIDController<policy::ToleranceIntegral, policy::FilteredDerivative, policy::VelocityFeedforward, policy::SlewLimit, policy::ToleranceSettle> FullPID;
+
+static std::vector<float> errors;
+
+/**
+ * Runs every error through a controller and times it
+ *
+ * @param   controller  the controller to run
+ * @param   outputs     where to store each output
+ *
+ * @return  nanoseconds per getOutput
+ */
+template<typename Controller>
+static double run(Controller controller, std::vector<float>& outputs){
+    outputs.resize(errors.size());
+    int settled = 0;
+    auto start = std::chrono::steady_clock::now();
+    for(size_t i = 0; i < errors.size(); i++){
+        outputs[i] = controller.getOutput(errors[i]);
+        settled += controller.isSettled();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if(settled < 0) printf("unreachable\n");
+    return seconds * 1e9 / errors.size();
+}
+
+int main(int argc, char** argv){
+    size_t updates = argc > 1 ? atol(argv[1]) : 20000000;
+
+    // a decaying error with noise and a new target every 500 updates, like a chain of drive motions
+    std::mt19937 random(1);
+    std::normal_distribution<float> noise(0, 0.05);
+    errors.resize(updates);
+    float error = 0;
+    for(size_t i = 0; i < updates; i++){
+        if(i % 500 == 0) error = (random() % 4800) / 100.0f - 24;
+        error = error * 0.98f + noise(random);
+        errors[i] = error;
+    }
+
+    std::vector<float> legacyOutputs;
+    std::vector<float> aliasOutputs;
+    std::vector<float> scratch;
+
+    LegacyPID legacy(1.2, 0.02, 6, 3, 0.5, 100, -12, 12, 10);
+    PID alias(1.2, 0.02, 6, 3, 0.5, 100, -12, 12, 10);
+    PDOnly pd(1.2, 0, 6, 0, 0, 0, -12, 12, 10);
+    FullPID full(1.2, 0.02, 6, 3, 0.5, 100, -12, 12, 10);
+    full.setFilter(0.6);
+    full.setFeedforward(0.5, 0.1, 0.01);
+    full.setReference(20, 0);
+    full.setSlew(120);
+
+    double legacyTime = run(legacy, legacyOutputs);
+    double aliasTime = run(alias, aliasOutputs);
+    double pdTime = run(pd, scratch);
+    double fullTime = run(full, scratch);
+
+    size_t mismatches = 0;
+    for(size_t i = 0; i < updates; i++) mismatches += legacyOutputs[i] != aliasOutputs[i];
+
+    printf("%zu updates, PID alias matches the old class on %zu of them\n\n", updates, updates - mismatches);
+    printf("%-44s %8s\n", "controller", "ns/call");
+    printf("%-44s %8.2f\n", "old runtime PID", legacyTime);
+    printf("%-44s %8.2f\n", "PID alias (tolerance I, error D, settle)", aliasTime);
+    printf("%-44s %8.2f\n", "PD only, no settle", pdTime);
+    printf("%-44s %8.2f\n", "filtered D, feedforward, slew, settle", fullTime);
+    printf("sizeof: old %zu, alias %zu, PD %zu, full %zu bytes\n", sizeof(LegacyPID), sizeof(PID), sizeof(PDOnly), sizeof(FullPID));
+    return mismatches != 0;
+}
@@ -0,0 +1,85 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       poses.cpp                                                 */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Compares turn then drive with the move to pose motion     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+
+/**
+ * Usage: poses
+ *
+ * Visits the same waypoints on a fresh simulated robot four ways and prints
+ * the total time and how far the true robot ended from each waypoint:
+ *   turn then drive    turnTo each point, then driveFor the distance, the old driveTo
+ *   driveTo            the continuous point motion
+ *   driveToPose        the boomerang motion, arriving at each heading
+ *   chained            driveToPose with an exit speed on every waypoint but the last
+ */
+
+struct Waypoint{
+    float x;
+    float y;
+    float heading;
+};
+
+static const Waypoint waypoints[4] = {{12, 30, 45}, {36, 36, 90}, {48, 12, 180}, {24, 0, 270}};
+static const int count = 4;
+
+enum Method{ turnThenDrive, point, pose, chained };
+static const char* methodNames[4] = {"turn then drive", "driveTo", "driveToPose", "chained"};
+
+static void runEpisode(Method method){
+    sim::RobotConfig config;
+    sim::World world(config);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    vex::thread odomTask([](void* arg){ ((odom*)arg)->start(); return 0; }, &tracker);
+
+    chassis robot(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    robot.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+    robot.setTurnConstants(0.3, 1, 0.02, 10, 1, 100, -12, 12);
+    robot.setPoseConstants(0.6, 6);
+    world.run(0.05);
+
+    float time = 0;
+    float positionError[count];
+    float headingError[count];
+    for(int i = 0; i < count; i++){
+        const Waypoint& target = waypoints[i];
+        if(method == turnThenDrive){
+            Pose start = tracker.getPose();
+            float heading = atan2f(target.x - start.x, target.y - start.y) * 180 / M_PI;
+            time += robot.turnTo(heading, 3);
+            time += robot.driveFor(hypotf(target.x - start.x, target.y - start.y), 3, heading);
+        }
+        if(method == point) time += robot.driveTo(target.x, target.y, 3, 3);
+        if(method == pose) time += robot.driveToPose(target.x, target.y, target.heading, 5);
+        if(method == chained) time += robot.driveToPose(target.x, target.y, target.heading, 5, 0.6, i + 1 < count ? 6 : 0);
+
+        positionError[i] = hypotf(world.robot.x - target.x, world.robot.y - target.y);
+        headingError[i] = remainderf(world.robot.heading * 180 / M_PI - target.heading, 360);
+    }
+    world.run(0.2);
+
+    printf("%-16s %7.2f s", methodNames[method], time);
+    for(int i = 0; i < count; i++) printf("   %5.2f in %7.2f deg", positionError[i], headingError[i]);
+    printf("\n");
+    tracker.stop();
+}
+
+int main(){
+    printf("%-16s %9s   off each waypoint when its motion ended (position, heading)\n", "method", "time");
+    for(int method = turnThenDrive; method <= chained; method++) runEpisode((Method)method);
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       profiles.cpp                                              */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Compares plain PID, trapezoidal and S-curve motions       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+
+/**
+ * Usage: profiles
+ *
+ * Runs driveFor and turnTo on a fresh simulated robot for a few targets, once
+ * with the plain PID, once following a trapezoidal profile and once following
+ * an S-curve, and prints the settle time, overshoot, final error and the worst
+ * wheel slip of each. The PID constants are the simulator's, the profile
+ * limits and feedforward below are what the simulated robot can follow.
+ */
+
+enum Shape{ none, trapezoidal, sCurve };
+
+static const char* shapeNames[3] = {"pid", "trapezoidal", "s-curve"};
+
+struct Limits{
+    float maxVelocity;
+    float maxAcceleration;
+    float maxJerk;
+    float kS;
+    float kV;
+    float kA;
+};
+
+static const Limits driveLimits = {50, 120, 1200, 0, 0.166, 0.030};
+static const Limits turnLimits = {330, 800, 8000, 0, 0.0229, 0.005};
+
+/**
+ * Watches the true robot while the motion runs
+ */
+struct Monitor{
+    bool turning = false;
+    float startX = 0;
+    float startY = 0;
+    float startHeading = 0;
+    float progress = 0;
+    float most = 0;
+    float least = 0;
+    float slip = 0;
+};
+
+static int runMonitor(void* arg){
+    Monitor* monitor = (Monitor*)arg;
+    sim::Robot& robot = sim::World::current()->robot;
+    while(true){
+        if(monitor->turning) monitor->progress = (robot.heading - monitor->startHeading) * 180 / M_PI;
+        else monitor->progress = (robot.x - monitor->startX) * sinf(monitor->startHeading) + (robot.y - monitor->startY) * cosf(monitor->startHeading);
+        if(monitor->progress > monitor->most) monitor->most = monitor->progress;
+        if(monitor->progress < monitor->least) monitor->least = monitor->progress;
+        monitor->slip = fmaxf(monitor->slip, fmaxf(fabsf(robot.leftSlip), fabsf(robot.rightSlip)));
+        vex::task::sleep(1);
+    }
+    return 0;
+}
+
+static void runEpisode(bool turning, float target, Shape shape){
+    sim::RobotConfig config;
+    sim::World world(config);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    chassis robot(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    robot.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+    robot.setTurnConstants(0.3, 1, 0.02, 10, 1, 100, -12, 12);
+
+    const Limits& limits = turning ? turnLimits : driveLimits;
+    float jerk = shape == sCurve ? limits.maxJerk : 0;
+    if(shape != none && turning) robot.setTurnProfile(limits.maxVelocity, limits.maxAcceleration, jerk, limits.kS, limits.kV, limits.kA);
+    if(shape != none && !turning) robot.setDriveProfile(limits.maxVelocity, limits.maxAcceleration, jerk, limits.kS, limits.kV, limits.kA);
+
+    world.run(0.05);
+    Monitor monitor;
+    monitor.turning = turning;
+    monitor.startX = world.robot.x;
+    monitor.startY = world.robot.y;
+    monitor.startHeading = world.robot.heading;
+    vex::thread monitorTask(runMonitor, &monitor);
+
+    float time = turning ? robot.turnTo(target, 4) : robot.driveFor(target, 4);
+    world.run(0.2);
+
+    float overshoot = fmaxf(monitor.most - target, 0);
+    printf("%-8s %7.1f  %-12s %7.2f s %9.3f %9.3f %9.3f\n", turning ? "turnTo" : "driveFor", target, shapeNames[shape], time,
+        overshoot, fabsf(monitor.progress - target), monitor.slip);
+}
+
+int main(){
+    const float distances[3] = {12, 24, 48};
+    const float angles[3] = {45, 90, 170};
+
+    printf("%-8s %7s  %-12s %9s %9s %9s %9s\n", "motion", "target", "profile", "time", "overshoot", "error", "slip m/s");
+    for(float distance : distances){
+        for(int shape = none; shape <= sCurve; shape++) runEpisode(false, distance, (Shape)shape);
+    }
+    for(float angle : angles){
+        for(int shape = none; shape <= sCurve; shape++) runEpisode(true, angle, (Shape)shape);
+    }
+    return 0;
+}
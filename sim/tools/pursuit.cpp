@@ -0,0 +1,119 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       pursuit.cpp                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Compares followPath with stopping at every waypoint       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+
+/**
+ * Usage: pursuit
+ *
+ * Drives two paths on a fresh simulated robot each time, once with followPath
+ * and once the old way, turning to face each waypoint and driving to it with a
+ * full stop in between. Prints the time each took, the worst distance of the
+ * true robot from the path, and where it ended up.
+ */
+
+struct Waypoint{
+    float x;
+    float y;
+};
+
+/**
+ * Watches the true robot's distance from the path
+ */
+struct Monitor{
+    Path* path;
+    float worst = 0;
+};
+
+static float distanceToPath(Path& path, float x, float y){
+    float best = INFINITY;
+    for(int i = 0; i + 1 < path.size(); i++){
+        PathPoint a = path.getPoint(i);
+        PathPoint b = path.getPoint(i + 1);
+        float dx = b.x - a.x;
+        float dy = b.y - a.y;
+        float t = ((x - a.x) * dx + (y - a.y) * dy) / (dx * dx + dy * dy);
+        t = fminf(fmaxf(t, 0), 1);
+        best = fminf(best, hypotf(a.x + t * dx - x, a.y + t * dy - y));
+    }
+    return best;
+}
+
+static int runMonitor(void* arg){
+    Monitor* monitor = (Monitor*)arg;
+    sim::Robot& robot = sim::World::current()->robot;
+    while(true){
+        monitor->worst = fmaxf(monitor->worst, distanceToPath(*monitor->path, robot.x, robot.y));
+        vex::task::sleep(5);
+    }
+    return 0;
+}
+
+static void runEpisode(const char* name, Path& path, const Waypoint* waypoints, int count, bool pursuit){
+    sim::RobotConfig config;
+    sim::World world(config);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    vex::thread odomTask([](void* arg){ ((odom*)arg)->start(); return 0; }, &tracker);
+
+    chassis robot(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    robot.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+    robot.setTurnConstants(0.3, 1, 0.02, 10, 1, 100, -12, 12);
+    robot.setPathConstants(8, 0.6, 1, 8);
+
+    world.run(0.05);
+    Monitor monitor;
+    monitor.path = &path;
+    vex::thread monitorTask(runMonitor, &monitor);
+
+    float time = 0;
+    if(pursuit) time = robot.followPath(path, 10);
+    else{
+        float x = 0;
+        float y = 0;
+        for(int i = 0; i < count; i++){
+            float heading = atan2f(waypoints[i].x - x, waypoints[i].y - y) * 180 / M_PI;
+            time += robot.turnTo(heading, 3);
+            time += robot.driveFor(hypotf(waypoints[i].x - x, waypoints[i].y - y), 3);
+            x = waypoints[i].x;
+            y = waypoints[i].y;
+        }
+    }
+    world.run(0.2);
+
+    PathPoint end = path.getEnd();
+    printf("%-8s %-16s %7.2f s %10.2f in   true (%6.2f, %6.2f, %7.2f)   %5.2f in from the end\n", name, pursuit ? "followPath" : "turn then drive", time,
+        monitor.worst, world.robot.x, world.robot.y, world.robot.heading * 180 / M_PI, hypotf(world.robot.x - end.x, world.robot.y - end.y));
+    tracker.stop();
+}
+
+int main(){
+    const Waypoint zigzag[3] = {{0, 24}, {24, 48}, {24, 72}};
+    Path zigzagPath(0, 0);
+    for(const Waypoint& waypoint : zigzag) zigzagPath.addPoint(waypoint.x, waypoint.y);
+
+    const Waypoint sCurve[2] = {{36, 48}, {36, 72}};
+    Path sCurvePath(0, 0);
+    sCurvePath.addBezier(0, 24, 36, 24, 36, 48);
+    sCurvePath.addPoint(36, 72);
+
+    printf("%-8s %-16s %9s %13s\n", "path", "method", "time", "off path");
+    runEpisode("zigzag", zigzagPath, zigzag, 3, false);
+    runEpisode("zigzag", zigzagPath, zigzag, 3, true);
+    runEpisode("s-curve", sCurvePath, sCurve, 2, false);
+    runEpisode("s-curve", sCurvePath, sCurve, 2, true);
+    return 0;
+}
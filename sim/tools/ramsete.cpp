@@ -0,0 +1,106 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       ramsete.cpp                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Runs the generated trajectories with followTrajectory     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+#include "trajectories.h"
+
+/**
+ * Usage: ramsete
+ *
+ * Follows each trajectory in trajectories.h on a fresh simulated robot three
+ * ways and prints how far the true robot strayed from the reference over time
+ * and where it ended:
+ *   feedforward only   b = 0 and zeta = 0, the reference speeds with no feedback at all
+ *   heading only       b = 0 and zeta = 0.7, along track and heading error corrected, cross track ignored
+ *   ramsete            b = 2 and zeta = 0.7
+ * One second in the robot is shoved 3.6 inches and 10 degrees, which odom
+ * sees, so the feedback has something to fix. The gain k fades with the
+ * reference speed, so whatever error is left as the trajectory slows to rest
+ * stays; the end error is about an inch for any b from 1 to 8.
+ */
+
+enum Controller{ feedforward, heading, ramsete };
+static const char* controllerNames[3] = {"feedforward only", "heading only", "ramsete"};
+static const float controllerB[3] = {0, 0, 2};
+static const float controllerZeta[3] = {0, 0.7, 0.7};
+
+/**
+ * Compares the true robot with the reference every 10 ms
+ */
+struct Monitor{
+    const Trajectory* trajectory;
+    uint64_t start;
+    bool pushed = false;
+    float worst = 0;
+    float squares = 0;
+    int samples = 0;
+};
+
+static int runMonitor(void* arg){
+    Monitor* monitor = (Monitor*)arg;
+    sim::World& world = *sim::World::current();
+    while(true){
+        float time = (world.time() - monitor->start) / 1e6f;
+        if(time <= monitor->trajectory->getDuration()){
+            TrajectoryState reference = monitor->trajectory->at(time);
+            float error = hypotf(world.robot.x - reference.x, world.robot.y - reference.y);
+            monitor->worst = fmaxf(monitor->worst, error);
+            monitor->squares += error * error;
+            monitor->samples++;
+        }
+        if(!monitor->pushed && time >= 1){
+            world.robot.push(3, -2, 10);
+            monitor->pushed = true;
+        }
+        vex::task::sleep(10);
+    }
+    return 0;
+}
+
+static void runEpisode(const char* name, const Trajectory& trajectory, Controller controller){
+    sim::RobotConfig config;
+    sim::World world(config);
+    TrajectoryState first = trajectory.at(0);
+    world.robot.setPose(first.x, first.y, first.heading);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    tracker.setPosition(first.x, first.y, first.heading);
+    vex::thread odomTask([](void* arg){ ((odom*)arg)->start(); return 0; }, &tracker);
+
+    chassis robot(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    robot.setRamseteConstants(controllerB[controller], controllerZeta[controller], 0, 0.166, 0.030, 0.210, 0.0455);
+    world.run(0.05);
+
+    Monitor monitor;
+    monitor.trajectory = &trajectory;
+    monitor.start = world.time();
+    vex::thread monitorTask(runMonitor, &monitor);
+    float time = robot.followTrajectory(trajectory);
+    world.run(0.2);
+
+    TrajectoryState last = trajectory.at(trajectory.getDuration());
+    printf("%-10s %-16s %6.2f s %8.2f in %8.2f in %8.2f in %8.2f deg\n", name, controllerNames[controller], time, monitor.worst,
+        sqrtf(monitor.squares / monitor.samples), hypotf(world.robot.x - last.x, world.robot.y - last.y),
+        remainderf(world.robot.heading * 180 / M_PI - last.heading, 360));
+    tracker.stop();
+}
+
+int main(){
+    printf("%-10s %-16s %8s %11s %11s %11s %12s\n", "trajectory", "controller", "time", "worst", "rms", "end", "end heading");
+    for(int controller = feedforward; controller <= ramsete; controller++) runEpisode("sweep", trajectories::sweep, (Controller)controller);
+    for(int controller = feedforward; controller <= ramsete; controller++) runEpisode("sweepBack", trajectories::sweepBack, (Controller)controller);
+    return 0;
+}
@@ -0,0 +1,454 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       replay.cpp                                                */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Replays logged sensor readings through odom::update       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <dirent.h>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <memory>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+#include "telemetry.h"
+#include "logreader.h"
+
+/**
+ * Usage: replay [options] log|directory ...
+ *
+ * Feeds the sensor readings recorded in telemetry logs (every .bin in a
+ * directory) through the real odom::update, one log per core, and prints for
+ * each log the frames replayed, the pose it ends at and how far the replayed
+ * trace strays from the pose the brain logged. A setPosition or other setter
+ * on the brain shows up in the odom records, and the replay moves to the
+ * logged pose at the same update. The logged readings are rounded to the log's
+ * scales, so the replay follows the brain closely, not bit for bit.
+ *
+ *   --vertical-offset in       odom constants, the simulated robot's by default
+ *   --vertical-ipd in          (inches per degree of the tracking wheels)
+ *   --horizontal-offset in
+ *   --horizontal-ipd in
+ *   --ekf drive-ipd track      replay through the extended Kalman filter instead
+ *   --jobs n                   threads, one per core by default
+ *   --out dir                  write each pose trace to dir/name.csv
+ *   --update-golden            write each trace to name.golden beside its log
+ *   --check                    replay each log with the constants in its
+ *                              name.golden and fail on any difference
+ *   --tolerance in             difference --check allows, 0 (bit for bit) by default
+ *   --record dir [matches]     drive simulated matches with odom recording and
+ *                              write them to dir/match<n>.bin (default 3)
+ *
+ * "make check-replay" checks the matches in matches/ against their goldens, so
+ * a change to odom that moves any pose by any amount is caught. After a change
+ * that is meant to move them, replay --update-golden matches rewrites them.
+ */
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * The odom setup a log is replayed with
+ */
+struct ReplayConstants{
+    float verticalOffset;
+    float verticalInchesPerDegree;
+    float horizontalOffset;
+    float horizontalInchesPerDegree;
+    bool ekf;
+    float driveInchesPerDegree;
+    float trackWidth;
+};
+
+/**
+ * One log, what it replayed to and how that compares
+ */
+struct Replay{
+    std::string path;
+    std::string name;
+    ReplayConstants constants;
+
+    std::vector<Pose> poses;        // replayed, one per sensor frame
+    uint32_t resets = 0;
+    uint32_t unpaired = 0;          // sensor frames without their odom record, skipped
+    float maxDeviation = 0;         // from the logged pose, inches
+    float finalDeviation = 0;
+
+    bool ok = true;
+    std::string message;
+};
+
+static ReplayConstants defaultConstants(){
+    sim::RobotConfig config;
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    ReplayConstants constants;
+    constants.verticalOffset = config.verticalOffset;
+    constants.verticalInchesPerDegree = trackingDegreesToInches;
+    constants.horizontalOffset = config.horizontalOffset;
+    constants.horizontalInchesPerDegree = trackingDegreesToInches;
+    constants.ekf = false;
+    constants.driveInchesPerDegree = M_PI * config.wheelDiameter * config.wheelToMotor / 360;
+    constants.trackWidth = config.trackWidth;
+    return constants;
+}
+
+/* ---------- Replaying ---------- */
+
+/**
+ * Runs one log's sensor frames through a fresh odom
+ * A sensor record is pushed right after the odom record of the same update, so
+ * the pair shares a source and consecutive sequence numbers. The odom record
+ * gives the frame its heading and tells when a setter moved the pose.
+ */
+static void replayLog(Replay& replay){
+    LogReader reader;
+    std::string error;
+    if(!reader.readFile(replay.path.c_str(), error)){
+        replay.ok = false;
+        replay.message = error;
+        return;
+    }
+    const LogColumns* odomRecords = reader.getChannel("odom");
+    const LogColumns* sensorRecords = reader.getChannel("sensors");
+    if(!odomRecords || !sensorRecords || odomRecords->size() == 0 || sensorRecords->size() == 0){
+        replay.ok = false;
+        replay.message = "no odom and sensor records";
+        return;
+    }
+    bool countsResets = odomRecords->fields.size() > 5;
+
+    // a detached inertial for setPosition to write to, the logged rotation already has the change in it
+    sim::RobotConfig config;
+    sim::Robot robot(config);
+    sim::Inertial imu(&robot);
+    vex::inertial Inertial(&imu);
+    vex::rotation trackingWheel(0);
+    SensorHub sensors(0, 0, &Inertial);
+    sensors.setVerticalTracking(&trackingWheel);
+    sensors.setHorizontalTracking(&trackingWheel);
+
+    const ReplayConstants& constants = replay.constants;
+    odom tracker(sensors, constants.verticalOffset, constants.verticalInchesPerDegree, constants.horizontalOffset,
+        constants.horizontalInchesPerDegree, 10);
+    if(constants.ekf) tracker.useEKF(constants.driveInchesPerDegree, constants.trackWidth);
+
+    replay.poses.reserve(sensorRecords->size());
+    uint8_t source = odomRecords->source[0];
+    int32_t lastResets = -1;
+    size_t row = 0;
+    for(size_t i = 0; i < sensorRecords->size(); i++){
+        if(sensorRecords->source[i] != source) continue;
+        uint16_t sequence = sensorRecords->sequence[i] - 1;
+        while(row < odomRecords->size() && (odomRecords->source[row] != source || (int16_t)(odomRecords->sequence[row] - sequence) < 0)) row++;
+        if(row == odomRecords->size()) break;
+        if(odomRecords->sequence[row] != sequence){
+            replay.unpaired++;
+            continue;
+        }
+
+        SensorFrame frame;
+        frame.timestamp = sensorRecords->timestamp[i];
+        frame.vertical = sensorRecords->value(0, i);
+        frame.horizontal = sensorRecords->value(1, i);
+        frame.left = sensorRecords->value(2, i);
+        frame.right = sensorRecords->value(3, i);
+        frame.rotation = sensorRecords->value(4, i);
+        frame.heading = odomRecords->value(2, row);
+        frame.gyroRate = sensorRecords->value(5, i);
+
+        float loggedX = odomRecords->value(0, row);
+        float loggedY = odomRecords->value(1, row);
+        int32_t resets = countsResets ? odomRecords->fields[5][row] : 0;
+        if(resets != lastResets){
+            tracker.setPosition(loggedX, loggedY, frame.heading);
+            if(lastResets >= 0) replay.resets++;
+            lastResets = resets;
+        }
+
+        tracker.update(frame);
+        Pose pose = tracker.getPose();
+        replay.poses.push_back(pose);
+
+        replay.finalDeviation = hypotf(pose.x - loggedX, pose.y - loggedY);
+        replay.maxDeviation = fmaxf(replay.maxDeviation, replay.finalDeviation);
+    }
+}
+
+/* ---------- Traces and goldens ---------- */
+
+/**
+ * Nine significant digits bring every float back exactly
+ */
+static bool writeTrace(const std::string& path, const Replay& replay, bool golden){
+    FILE* file = fopen(path.c_str(), "w");
+    if(!file) return false;
+    const ReplayConstants& c = replay.constants;
+    if(golden){
+        fprintf(file, "# replay golden 1 %.9g %.9g %.9g %.9g %d %.9g %.9g\n", c.verticalOffset, c.verticalInchesPerDegree,
+            c.horizontalOffset, c.horizontalInchesPerDegree, c.ekf ? 1 : 0, c.driveInchesPerDegree, c.trackWidth);
+    }
+    else fprintf(file, "timestamp,x,y,heading\n");
+    const char* format = golden ? "%llu %.9g %.9g %.9g\n" : "%llu,%.9g,%.9g,%.9g\n";
+    for(const Pose& pose : replay.poses) fprintf(file, format, (unsigned long long)pose.timestamp, pose.x, pose.y, pose.heading);
+    return fclose(file) == 0;
+}
+
+static bool readGolden(const std::string& path, ReplayConstants& constants, std::vector<Pose>& poses){
+    FILE* file = fopen(path.c_str(), "r");
+    if(!file) return false;
+    int ekf = 0;
+    bool ok = fscanf(file, "# replay golden 1 %f %f %f %f %d %f %f", &constants.verticalOffset, &constants.verticalInchesPerDegree,
+        &constants.horizontalOffset, &constants.horizontalInchesPerDegree, &ekf, &constants.driveInchesPerDegree, &constants.trackWidth) == 7;
+    constants.ekf = ekf != 0;
+
+    unsigned long long timestamp;
+    Pose pose;
+    while(ok && fscanf(file, "%llu %f %f %f", &timestamp, &pose.x, &pose.y, &pose.heading) == 4){
+        pose.timestamp = timestamp;
+        poses.push_back(pose);
+    }
+    fclose(file);
+    return ok;
+}
+
+/**
+ * Compares a replay to its golden and says where they first part
+ */
+static void checkGolden(Replay& replay, const std::vector<Pose>& golden, float tolerance){
+    if(replay.poses.size() != golden.size()){
+        replay.ok = false;
+        replay.message = "replayed " + std::to_string(replay.poses.size()) + " poses, golden has " + std::to_string(golden.size());
+        return;
+    }
+    size_t first = golden.size();
+    float most = 0;
+    for(size_t i = 0; i < golden.size(); i++){
+        const Pose& a = replay.poses[i];
+        const Pose& b = golden[i];
+        float difference = fmaxf(hypotf(a.x - b.x, a.y - b.y), fabsf(a.heading - b.heading));
+        bool same = a.timestamp == b.timestamp && (tolerance > 0 ? difference <= tolerance : a.x == b.x && a.y == b.y && a.heading == b.heading);
+        if(!same && first == golden.size()) first = i;
+        most = fmaxf(most, difference);
+    }
+    if(first == golden.size()) return;
+
+    char text[200];
+    const Pose& a = replay.poses[first];
+    const Pose& b = golden[first];
+    snprintf(text, sizeof(text), "differs from pose %zu (t %.3f s): (%.9g, %.9g, %.9g) against (%.9g, %.9g, %.9g), %.3g at most",
+        first, b.timestamp / 1e6, a.x, a.y, a.heading, b.x, b.y, b.heading, most);
+    replay.ok = false;
+    replay.message = text;
+}
+
+/* ---------- Recording ---------- */
+
+/**
+ * One simulated match with odom recording, moved by setPosition like a robot lined up on a wall
+ */
+static void recordMatch(int match, const std::string& path){
+    sim::RobotConfig config;
+    config.seed = match + 1;
+    sim::World world(config);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    chassis drive(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    drive.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+    drive.setTurnConstants(0.3, 1, 0.02, 10, 1, 100, -12, 12);
+
+    vex::brain::sdcard card;
+    Telemetry telemetry(&card, path.c_str());
+    tracker.setTelemetry(telemetry.addProducer());
+    telemetry.start();
+
+    vex::thread odomTask([](void* arg){ ((odom*)arg)->start(); return 0; }, &tracker);
+    world.run(0.1);
+
+    switch(match % 3){
+    case 0:
+        drive.driveFor(24, 3);
+        drive.turnTo(90, 3);
+        drive.driveToPose(24, 48, 0, 4);
+        break;
+    case 1:
+        tracker.setPosition(-36, -60, 0);
+        drive.driveToPose(-12, -24, 45, 4);
+        drive.turnTo(180, 3);
+        drive.driveFor(20, 3);
+        break;
+    case 2:
+        drive.driveFor(30, 3);
+        tracker.setPosition(0, 30, tracker.getHeading());
+        drive.turnFor(135, 3);
+        drive.driveFor(-18, 3);
+        break;
+    }
+
+    tracker.stop();
+    world.run(0.05);
+    telemetry.stop();
+}
+
+/* ---------- Batches ---------- */
+
+/**
+ * Runs job(0) to job(count - 1) spread over threads
+ */
+template<class Job>
+static void parallelFor(size_t count, int threads, Job job){
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> workers;
+    for(int t = 0; t < threads; t++){
+        workers.push_back(std::thread([&](){
+            for(size_t i = next++; i < count; i = next++) job(i);
+        }));
+    }
+    for(std::thread& worker : workers) worker.join();
+}
+
+static bool endsWith(const std::string& text, const char* suffix){
+    size_t length = strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+/**
+ * Every .bin in a directory in name order, or the path itself if it is not a directory
+ */
+static void findLogs(const char* path, std::vector<std::string>& logs){
+    DIR* directory = opendir(path);
+    if(!directory){
+        logs.push_back(path);
+        return;
+    }
+    std::vector<std::string> names;
+    while(dirent* entry = readdir(directory)) if(endsWith(entry->d_name, ".bin")) names.push_back(entry->d_name);
+    closedir(directory);
+    std::sort(names.begin(), names.end());
+    for(const std::string& name : names) logs.push_back(std::string(path) + "/" + name);
+}
+
+static std::string baseName(const std::string& path){
+    size_t slash = path.rfind('/');
+    std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+    if(endsWith(name, ".bin")) name.erase(name.size() - 4);
+    return name;
+}
+
+static std::string goldenPath(const std::string& path){
+    std::string golden = path;
+    if(endsWith(golden, ".bin")) golden.erase(golden.size() - 4);
+    return golden + ".golden";
+}
+
+static int usage(){
+    printf("usage: replay [--vertical-offset in] [--vertical-ipd in] [--horizontal-offset in] [--horizontal-ipd in]\n"
+           "              [--ekf drive-ipd track] [--jobs n] [--out dir] [--update-golden | --check [--tolerance in]]\n"
+           "              log|directory ...\n"
+           "       replay --record dir [matches]\n");
+    return 1;
+}
+
+int main(int argc, char** argv){
+    ReplayConstants constants = defaultConstants();
+    int threads = std::thread::hardware_concurrency();
+    const char* outDirectory = 0;
+    bool updateGolden = false;
+    bool check = false;
+    float tolerance = 0;
+    std::vector<std::string> logs;
+
+    for(int i = 1; i < argc; i++){
+        std::string option = argv[i];
+        bool hasValue = i + 1 < argc;
+        if(option == "--record" && hasValue){
+            std::string directory = argv[++i];
+            int matches = i + 1 < argc ? atoi(argv[i + 1]) : 3;
+            parallelFor(matches, threads < 1 ? 1 : threads, [&](size_t match){
+                recordMatch(match, directory + "/match" + std::to_string(match) + ".bin");
+            });
+            printf("recorded %d matches in %s\n", matches, directory.c_str());
+            return 0;
+        }
+        else if(option == "--vertical-offset" && hasValue) constants.verticalOffset = atof(argv[++i]);
+        else if(option == "--vertical-ipd" && hasValue) constants.verticalInchesPerDegree = atof(argv[++i]);
+        else if(option == "--horizontal-offset" && hasValue) constants.horizontalOffset = atof(argv[++i]);
+        else if(option == "--horizontal-ipd" && hasValue) constants.horizontalInchesPerDegree = atof(argv[++i]);
+        else if(option == "--ekf" && i + 2 < argc){
+            constants.ekf = true;
+            constants.driveInchesPerDegree = atof(argv[++i]);
+            constants.trackWidth = atof(argv[++i]);
+        }
+        else if(option == "--jobs" && hasValue) threads = atoi(argv[++i]);
+        else if(option == "--out" && hasValue) outDirectory = argv[++i];
+        else if(option == "--tolerance" && hasValue) tolerance = atof(argv[++i]);
+        else if(option == "--update-golden") updateGolden = true;
+        else if(option == "--check") check = true;
+        else if(option.compare(0, 2, "--") == 0) return usage();
+        else findLogs(argv[i], logs);
+    }
+    if(logs.empty() || (check && updateGolden)) return usage();
+    if(threads < 1) threads = 1;
+
+    std::vector<Replay> replays(logs.size());
+    std::atomic<uint64_t> frames(0);
+    Clock::time_point start = Clock::now();
+    parallelFor(logs.size(), threads, [&](size_t i){
+        Replay& replay = replays[i];
+        replay.path = logs[i];
+        replay.name = baseName(logs[i]);
+        replay.constants = constants;
+
+        std::vector<Pose> golden;
+        if(check && !readGolden(goldenPath(replay.path), replay.constants, golden)){
+            replay.ok = false;
+            replay.message = "no golden " + goldenPath(replay.path);
+            return;
+        }
+        replayLog(replay);
+        frames += replay.poses.size();
+        if(!replay.ok) return;
+
+        if(check) checkGolden(replay, golden, tolerance);
+        if(updateGolden && !writeTrace(goldenPath(replay.path), replay, true)){
+            replay.ok = false;
+            replay.message = "cannot write " + goldenPath(replay.path);
+        }
+        if(outDirectory && !writeTrace(std::string(outDirectory) + "/" + replay.name + ".csv", replay, false)){
+            replay.ok = false;
+            replay.message = "cannot write " + std::string(outDirectory) + "/" + replay.name + ".csv";
+        }
+    });
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    int failed = 0;
+    for(const Replay& replay : replays){
+        if(replay.poses.empty()){
+            printf("%-12s %s\n", replay.name.c_str(), replay.message.c_str());
+            failed++;
+            continue;
+        }
+        const Pose& last = replay.poses.back();
+        printf("%-12s %6zu frames, %u resets, %u unpaired, ends at (%7.2f, %7.2f, %6.1f), from the log %.3f in at most, %.3f at the end\n",
+            replay.name.c_str(), replay.poses.size(), replay.resets, replay.unpaired, last.x, last.y, last.heading,
+            replay.maxDeviation, replay.finalDeviation);
+        if(check) printf("             golden %s\n", replay.ok ? "matches" : replay.message.c_str());
+        else if(!replay.ok) printf("             %s\n", replay.message.c_str());
+        if(!replay.ok) failed++;
+    }
+    printf("%zu logs, %llu frames in %.3f s on %d threads (%.1f M frames/s)%s\n", replays.size(), (unsigned long long)frames.load(),
+        seconds, threads, frames / seconds / 1e6, updateGolden ? ", goldens written" : "");
+    return failed ? 1 : 0;
+}
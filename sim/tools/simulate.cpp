@@ -0,0 +1,81 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       simulate.cpp                                              */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Runs the chassis motions and odom on the simulated robot  */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <chrono>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+
+/**
+ * Usage: simulate [loopPeriodMilliseconds]
+ *
+ * Drives the simulated robot through one of each chassis motion with odom
+ * running in its own task and the motion loops at the given period
+ * (default 10 ms), then prints how long each motion took, where the
+ * robot really ended up, where odom thinks it is, and how much faster than
+ * real time the whole thing ran.
+ */
+
+static odom* Odom;
+
+static void runOdom(){
+    Odom->start();
+}
+
+static void report(const char* name, float time, sim::World& world, chassis& drive){
+    Pose pose = Odom->getPose();
+    LoopStats stats = drive.getMotionStats();
+    printf("%-24s %7.2f s   true (%7.2f, %7.2f, %7.2f)   odom (%7.2f, %7.2f, %7.2f)   %4u ticks, dt %5.2f ms, jitter %5.3f ms, %u overruns\n", name, time,
+        world.robot.x, world.robot.y, world.robot.heading * 180 / M_PI, pose.x, pose.y, pose.heading,
+        stats.ticks, stats.meanDt * 1000, stats.maxJitter * 1000, stats.overruns);
+}
+
+int main(int argc, char** argv){
+    int loopPeriod = argc > 1 ? atoi(argv[1]) : 10;
+
+    sim::RobotConfig config;
+    sim::World world(config);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    Odom = &tracker;
+    vex::thread odomTask(runOdom);
+
+    chassis drive(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    drive.setLoopPeriod(loopPeriod);
+    drive.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+    drive.setTurnConstants(0.3, 1, 0.02, 10, 1, 100, -12, 12);
+    drive.setSwingConstants(0.5, 1, 0.03, 10, 1, 100, -12, 12);
+    drive.setArcConstants(0.4, 1, 0.03, 10, 1, 100, -12, 12);
+
+    auto wallStart = std::chrono::steady_clock::now();
+    uint64_t simStart = world.time();
+
+    world.run(0.1);
+    report("driveFor(24)", drive.driveFor(24, 3), world, drive);
+    report("turnTo(90)", drive.turnTo(90, 3), world, drive);
+    report("swingFor(right, 45)", drive.swingFor(vex::turnType::right, 45, 3), world, drive);
+    report("arcFor(left, 20, 90)", drive.arcFor(vex::turnType::left, 20, 90, 3), world, drive);
+    report("driveFor(-24)", drive.driveFor(-24, 3), world, drive);
+
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    double simulated = (world.time() - simStart) / 1e6;
+    LoopStats odomStats = Odom->getLoopStats();
+    printf("\nodom loop: %u ticks, dt %.2f ms (max %.2f), jitter %.3f ms (max %.3f), %u overruns\n", odomStats.ticks,
+        odomStats.meanDt * 1000, odomStats.maxDt * 1000, odomStats.meanJitter * 1000, odomStats.maxJitter * 1000, odomStats.overruns);
+    printf("sensor hub: %u frames handed out, devices sampled %u times\n", sensors.getRequestCount(), sensors.getSampleCount());
+    printf("simulated %.2f s in %.3f s of wall time (%.0fx real time)\n", simulated, wall, simulated / wall);
+
+    tracker.stop();
+    return 0;
+}
@@ -0,0 +1,203 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       streamplot.cpp                                            */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Live step response plot, streamed against full redraws    */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+#include "grapher.h"
+
+/**
+ * Usage: streamplot [image.ppm]
+ *
+ * Plots a drive step response live on the simulated screen while the robot
+ * drives forward 24 inches and back 12. A 100 Hz task pushes the distance odom
+ * measured and the target into two PlotStreams. Runs the plot three ways:
+ *   full       a 30 fps task that draws the outline and every sample again each frame
+ *   stream 30  Graph::start(30), drawing only the new segments
+ *   stream 60  Graph::start(60)
+ * Prints the frames rendered, the frames drawn from scratch, the draw calls and
+ * pixels written per frame, and the drive times, which should not change.
+ * Then times one frame of each on the host for longer traces. The last stream
+ * 30 screen is written to the image if one is given.
+ */
+
+enum Mode{ full, stream30, stream60 };
+static const char* modeNames[3] = {"full", "stream 30", "stream 60"};
+
+struct Sampler{
+    odom* tracker;
+    PlotStream* measured;
+    PlotStream* target;
+    float goal;
+    bool running;
+};
+
+static int sample(void* arg){
+    Sampler* sampler = (Sampler*)arg;
+    LoopTimer loop(10);
+    while(sampler->running){
+        float t = vex::timer::systemHighResolution() / 1e6f;
+        sampler->measured->push(t, sampler->tracker->getPose().y);
+        sampler->target->push(t, sampler->goal);
+        loop.wait();
+    }
+    return 0;
+}
+
+/**
+ * Redraws the outline and both traces from scratch every frame, the way a plot was updated before streams
+ */
+struct FullRedraw{
+    Graph* graph;
+    vex::brain::lcd* screen;
+    PlotStream* streams[2];
+    bool running;
+};
+
+static int redrawFull(void* arg){
+    FullRedraw* redraw = (FullRedraw*)arg;
+    Series series[2];
+    LoopTimer loop(33);
+    while(redraw->running){
+        Series all;
+        for(int i = 0; i < 2; i++){
+            series[i].clear();
+            uint32_t head = redraw->streams[i]->getHead();
+            for(uint32_t s = PlotStream::getOldest(head); s < head; s++){
+                series[i].push(redraw->streams[i]->getX(s), redraw->streams[i]->getY(s));
+                all.push(redraw->streams[i]->getX(s), redraw->streams[i]->getY(s));
+            }
+        }
+        if(all.size() > 1){
+            redraw->graph->autoScale(all);
+            redraw->graph->drawOutline();
+            redraw->graph->drawData(series[0], vex::color::green, 2);
+            redraw->graph->drawData(series[1], vex::color::red, 1);
+            redraw->screen->render();
+        }
+        loop.wait();
+    }
+    return 0;
+}
+
+static void runPlot(Mode mode, const char* image){
+    sim::RobotConfig config;
+    sim::World world(config);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    chassis drive(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    drive.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+    vex::thread odomTask([](void* arg){ ((odom*)arg)->start(); return 0; }, &tracker);
+
+    PlotStream measured;
+    PlotStream target;
+    Sampler sampler = {&tracker, &measured, &target, 24, true};
+    vex::thread samplerTask(sample, &sampler);
+
+    Graph graph(&world.Brain_Screen);
+    graph.setOutline(vex::color::white, 2);
+    graph.setGraph(20, 460, 20, 220, vex::color::black);
+    FullRedraw redraw = {&graph, &world.Brain_Screen, {&measured, &target}, true};
+    vex::thread redrawTask;
+    if(mode == full){
+        redrawTask = vex::thread(redrawFull, &redraw);
+        redrawTask.setPriority(vex::thread::threadPriorityLow);
+    }
+    else{
+        graph.addStream(&measured, vex::color::green, 2);
+        graph.addStream(&target, vex::color::red, 1);
+        graph.start(mode == stream30 ? 30 : 60);
+    }
+
+    uint64_t calls = world.display.drawCalls;
+    uint64_t pixels = world.display.pixelsWritten;
+    uint64_t frames = world.display.frames;
+    world.run(0.2);
+    float forward = drive.driveFor(24, 3);
+    sampler.goal = 12;
+    float back = drive.driveFor(-12, 3);
+    world.run(0.3);
+
+    sampler.running = false;
+    redraw.running = false;
+    graph.stop();
+    if(mode == full) redrawTask.join();
+    samplerTask.join();
+    tracker.stop();
+    world.run(0.05);
+
+    frames = world.display.frames - frames;
+    printf("%-10s %4llu frames, %3u from scratch, %7.0f draw calls and %8.0f pixels per frame, drives %.2f s and %.2f s\n",
+        modeNames[mode], (unsigned long long)frames, mode == full ? (uint32_t)frames : graph.getRedraws(),
+        (double)(world.display.drawCalls - calls) / frames, (double)(world.display.pixelsWritten - pixels) / frames, forward, back);
+    if(image && mode == stream30) world.display.writePPM(image);
+}
+
+/**
+ * Host time of one frame once the trace has samples points, adding 3 new ones
+ */
+static void timeFrames(int samples){
+    std::vector<sim::Screen> screens(2);
+    vex::brain::lcd fullScreen(&screens[0]);
+    vex::brain::lcd streamScreen(&screens[1]);
+    PlotStream trace;
+    for(int i = 0; i < samples; i++) trace.push(i * 0.01f, 24 * (1 - expf(-i * 0.02f) * cosf(i * 0.09f)));
+
+    Graph fullGraph(&fullScreen);
+    fullGraph.setOutline(vex::color::white, 2);
+    fullGraph.setGraph(20, 460, 20, 220, vex::color::black);
+    Graph streamGraph(&streamScreen);
+    streamGraph.setOutline(vex::color::white, 2);
+    streamGraph.setGraph(20, 460, 20, 220, vex::color::black);
+    streamGraph.addStream(&trace, vex::color::green, 2);
+    streamGraph.drawStreams();
+
+    const int frames = 200;
+    Series series(PlotStream::capacity);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int f = 0; f < frames; f++){
+        series.clear();
+        for(uint32_t s = PlotStream::getOldest(trace.getHead()); s < trace.getHead(); s++) series.push(trace.getX(s), trace.getY(s));
+        fullGraph.autoScale(series);
+        fullGraph.drawOutline();
+        fullGraph.drawData(series, vex::color::green, 2);
+    }
+    double fullTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+
+    // the new samples stay inside the headroom the rescale left, as they do between rescales
+    float step = samples * 0.01f / (frames * 3 * 4);
+    start = std::chrono::steady_clock::now();
+    for(int f = 0; f < frames; f++){
+        for(int i = 0; i < 3; i++){
+            float x = trace.getX(trace.getHead() - 1) + step;
+            trace.push(x, 12 + 10 * sinf(x * 7));
+        }
+        streamGraph.drawStreams();
+    }
+    double streamTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / frames;
+    printf("%4d samples  full %7.1f us per frame, stream %5.1f us per frame (%.0fx), %u streamed frames from scratch\n", samples, fullTime,
+        streamTime, fullTime / streamTime, streamGraph.getRedraws() - 1);
+}
+
+int main(int argc, char** argv){
+    const char* image = argc > 1 ? argv[1] : 0;
+    runPlot(full, image);
+    runPlot(stream30, image);
+    runPlot(stream60, image);
+    timeFrames(100);
+    timeFrames(1000);
+    return 0;
+}
@@ -0,0 +1,138 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       telemetry.cpp                                             */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Push cost of the telemetry rings and a logged route       */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+#include "telemetry.h"
+#include "logreader.h"
+
+/**
+ * Usage: telemetry [pushes] [file]
+ *
+ * Times TelemetryRing::push (default 10 million pushes, drained every 128)
+ * and a push into a full ring, then drives a short route on a simulated robot
+ * with odom and the chassis recording to telemetry.bin (or the given file).
+ * Reads the log back and prints the records per channel, the number of
+ * appends and bytes, and whether the drops in the log match the rings' counters. Runs the
+ * route again with the telemetry task starved for 3 seconds so the rings fill, and
+ * cut off without stop, the way a match ends, to show how far the file lags the
+ * robot: once as it is and once writing only full buffers, as it did before
+ * setWritePeriod.
+ */
+
+enum Run{ route, starved, cutOff, cutOffFull };
+static const char* runNames[4] = {"route", "starved", "cut off", "full only"};
+
+static double nanosecondsPer(std::chrono::steady_clock::time_point start, long count){
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+}
+
+static void benchmark(long pushes){
+    TelemetryRing ring(0);
+    TelemetryRecord out[128];
+    float sink = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(long i = 0; i < pushes; i++){
+        ring.push(TelemetryChannel::motion, i, 1, 2, 3);
+        if((i & 127) == 127) sink += ring.pop(out, 128);
+    }
+    double pushCost = nanosecondsPer(start, pushes);
+
+    while(ring.push(TelemetryChannel::motion, 0)){}
+    start = std::chrono::steady_clock::now();
+    for(long i = 0; i < pushes; i++) ring.push(TelemetryChannel::motion, i);
+    double dropCost = nanosecondsPer(start, pushes);
+
+    printf("push      %7.1f ns per record (with the drain), %7.1f ns per dropped record, %u dropped (%.0f popped)\n",
+        pushCost, dropCost, ring.getDropped(), sink);
+}
+
+/**
+ * Reads a telemetry log back and checks it against the counters
+ */
+static void summarize(const char* label, const char* file, Telemetry& telemetry){
+    LogReader reader;
+    std::string error;
+    if(!reader.readFile(file, error)){
+        printf("%-9s %s\n", label, error.c_str());
+        return;
+    }
+
+    const LogStats& stats = reader.getStats();
+    printf("%-9s %5llu records (", label, (unsigned long long)stats.records);
+    for(const LogColumns& channel : reader.getChannels()) if(channel.size()) printf("%s %zu ", channel.name.c_str(), channel.size());
+    printf("\b) in %u appends, %u bytes (%.1f per record)\n", telemetry.getWrites(), telemetry.getWrittenBytes(),
+        (float)telemetry.getWrittenBytes() / telemetry.getWritten());
+    printf("          %u dropped, %u lost, %llu in the status records (%s), %llu seen as sequence gaps\n", telemetry.getDropped(),
+        telemetry.getLost(), (unsigned long long)stats.reportedDrops, stats.reportedDrops == telemetry.getDropped() ? "match" : "DO NOT MATCH",
+        (unsigned long long)stats.dropped);
+}
+
+static void runRoute(Run run, const char* file){
+    sim::RobotConfig config;
+    sim::World world(config);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    chassis drive(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+    drive.setDriveConstants(1.2, 2, 0.06, 3, 0.5, 100, -12, 12, 0.2);
+    drive.setTurnConstants(0.3, 1, 0.02, 10, 1, 100, -12, 12);
+
+    vex::brain::sdcard card;
+    Telemetry telemetry(&card, file);
+    tracker.setTelemetry(telemetry.addProducer());
+    drive.setTelemetry(telemetry.addProducer());
+    if(run == starved) telemetry.setFlushPeriod(3000);
+    if(run == cutOffFull) telemetry.setWritePeriod(UINT32_MAX);
+    telemetry.start();
+
+    vex::thread odomTask([](void* arg){ ((odom*)arg)->start(); return 0; }, &tracker);
+    world.run(0.1);
+
+    drive.driveFor(24, 3);
+    drive.turnTo(90, 3);
+    drive.driveToPose(24, 48, 0, 4);
+
+    uint32_t end = (uint32_t)world.time();
+    tracker.stop();
+    world.run(0.05);
+    if(run == cutOff || run == cutOffFull){
+        // the card holds only what the telemetry task appended, the rings and the buffer are gone
+        LogReader reader;
+        std::string error;
+        const LogColumns* odomRecords = reader.readFile(file, error) ? reader.getChannel("odom") : 0;
+        if(!odomRecords || !odomRecords->size()) printf("%-9s no odom records on the card\n", runNames[run]);
+        else printf("%-9s %5llu records on the card, the last odom record is %4.0f ms before the route ended\n", runNames[run],
+            (unsigned long long)reader.getStats().records, (end - odomRecords->timestamp.back()) / 1000.0);
+        telemetry.stop();
+        return;
+    }
+    telemetry.stop();
+    summarize(runNames[run], file, telemetry);
+}
+
+int main(int argc, char** argv){
+    long pushes = argc > 1 ? atol(argv[1]) : 10000000;
+    const char* file = argc > 2 ? argv[2] : "telemetry.bin";
+
+    benchmark(pushes);
+    runRoute(route, file);
+    runRoute(starved, file);
+    runRoute(cutOff, file);
+    runRoute(cutOffFull, file);
+    return 0;
+}
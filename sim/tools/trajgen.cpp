@@ -0,0 +1,295 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       trajgen.cpp                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Generates the constexpr trajectory tables for RAMSETE     */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include "trajectory.h"
+
+/**
+ * Usage: trajgen <definitions> <header>
+ *
+ * Reads trajectory definitions and writes a header of constexpr Trajectory
+ * tables for chassis::followTrajectory. "make trajectories" in sim/ runs it on
+ * sim/trajectories.txt and writes include/trajectories.h.
+ *
+ * Definitions, # starts a comment:
+ *   trajectory <name> <maxVelocity> <maxAcceleration> <maxCentripetal> <trackWidth> [reverse]
+ *       <x> <y> <heading> [tangent]
+ *       ...
+ *   end
+ *
+ * Inches, seconds and degrees clockwise from +y, the same as odom. Headings are
+ * the robot's; with reverse the robot drives backwards along the path. Each
+ * pair of waypoints is joined by a quintic Hermite spline whose end tangents
+ * point along the waypoint headings, tangent times the distance between the
+ * waypoints long (default 1.2), with zero second derivative at every waypoint.
+ *
+ * The path is sampled finely by arc length, then velocity is limited at every
+ * sample so the outer wheel stays under maxVelocity and the centripetal
+ * acceleration under maxCentripetal, and a forward then backward pass limits
+ * acceleration to maxAcceleration, starting and ending at rest. The result is
+ * resampled every 10 ms.
+ */
+
+static const int period = 10;
+
+struct Waypoint{
+    double x;
+    double y;
+    double heading;
+    double tangent;
+};
+
+struct Definition{
+    std::string name;
+    double maxVelocity;
+    double maxAcceleration;
+    double maxCentripetal;
+    double trackWidth;
+    bool reverse;
+    std::vector<Waypoint> waypoints;
+};
+
+/**
+ * A point of the finely sampled path
+ */
+struct Sample{
+    double x;
+    double y;
+    double heading;     // direction of travel, unwrapped degrees
+    double curvature;   // per inch, clockwise positive
+    double distance;
+    double velocity;
+    double time;
+};
+
+static double toRadians(double degrees){
+    return degrees * M_PI / 180;
+}
+
+/**
+ * Samples one quintic Hermite segment
+ */
+static void sampleSegment(const Waypoint& a, const Waypoint& b, bool reverse, std::vector<Sample>& samples){
+    double chord = hypot(b.x - a.x, b.y - a.y);
+    double travelA = toRadians(a.heading + (reverse ? 180 : 0));
+    double travelB = toRadians(b.heading + (reverse ? 180 : 0));
+    double t0x = a.tangent * chord * sin(travelA), t0y = a.tangent * chord * cos(travelA);
+    double t1x = b.tangent * chord * sin(travelB), t1y = b.tangent * chord * cos(travelB);
+
+    int steps = (int)ceil(chord / 0.05) + 20;
+    for(int i = samples.empty() ? 0 : 1; i <= steps; i++){
+        double t = (double)i / steps;
+        double t2 = t * t, t3 = t2 * t, t4 = t3 * t, t5 = t4 * t;
+
+        // second derivatives are zero at the waypoints, so their basis functions drop out
+        double h0 = 1 - 10 * t3 + 15 * t4 - 6 * t5, h1 = t - 6 * t3 + 8 * t4 - 3 * t5;
+        double h4 = -4 * t3 + 7 * t4 - 3 * t5, h5 = 10 * t3 - 15 * t4 + 6 * t5;
+        double d0 = -30 * t2 + 60 * t3 - 30 * t4, d1 = 1 - 18 * t2 + 32 * t3 - 15 * t4;
+        double d4 = -12 * t2 + 28 * t3 - 15 * t4, d5 = 30 * t2 - 60 * t3 + 30 * t4;
+        double s0 = -60 * t + 180 * t2 - 120 * t3, s1 = -36 * t + 96 * t2 - 60 * t3;
+        double s4 = -24 * t + 84 * t2 - 60 * t3, s5 = 60 * t - 180 * t2 + 120 * t3;
+
+        double x = h0 * a.x + h1 * t0x + h4 * t1x + h5 * b.x;
+        double y = h0 * a.y + h1 * t0y + h4 * t1y + h5 * b.y;
+        double dx = d0 * a.x + d1 * t0x + d4 * t1x + d5 * b.x;
+        double dy = d0 * a.y + d1 * t0y + d4 * t1y + d5 * b.y;
+        double ddx = s0 * a.x + s1 * t0x + s4 * t1x + s5 * b.x;
+        double ddy = s0 * a.y + s1 * t0y + s4 * t1y + s5 * b.y;
+
+        Sample sample;
+        sample.x = x;
+        sample.y = y;
+        sample.heading = atan2(dx, dy) * 180 / M_PI;
+        double speed = hypot(dx, dy);
+        sample.curvature = speed > 1e-9 ? -(dx * ddy - dy * ddx) / (speed * speed * speed) : 0;
+        sample.distance = samples.empty() ? 0 : samples.back().distance + hypot(x - samples.back().x, y - samples.back().y);
+        sample.velocity = 0;
+        sample.time = 0;
+        if(!samples.empty()){
+            while(sample.heading - samples.back().heading > 180) sample.heading -= 360;
+            while(sample.heading - samples.back().heading < -180) sample.heading += 360;
+        }
+        samples.push_back(sample);
+    }
+}
+
+/**
+ * Time parameterizes the samples in place
+ *
+ * @return  the total time, in seconds
+ */
+static double parameterize(const Definition& definition, std::vector<Sample>& samples){
+    size_t n = samples.size();
+    std::vector<double> limit(n);
+    for(size_t i = 0; i < n; i++){
+        double k = fabs(samples[i].curvature);
+        double wheel = definition.maxVelocity / (1 + k * definition.trackWidth / 2);
+        double centripetal = k > 1e-9 ? sqrt(definition.maxCentripetal / k) : INFINITY;
+        limit[i] = fmin(wheel, centripetal);
+    }
+    limit[0] = 0;
+    limit[n - 1] = 0;
+
+    for(size_t i = 1; i < n; i++){
+        double ds = samples[i].distance - samples[i - 1].distance;
+        limit[i] = fmin(limit[i], sqrt(limit[i - 1] * limit[i - 1] + 2 * definition.maxAcceleration * ds));
+    }
+    for(size_t i = n - 1; i > 0; i--){
+        double ds = samples[i].distance - samples[i - 1].distance;
+        limit[i - 1] = fmin(limit[i - 1], sqrt(limit[i] * limit[i] + 2 * definition.maxAcceleration * ds));
+    }
+
+    samples[0].time = 0;
+    samples[0].velocity = 0;
+    for(size_t i = 1; i < n; i++){
+        double ds = samples[i].distance - samples[i - 1].distance;
+        double average = (limit[i] + limit[i - 1]) / 2;
+        samples[i].velocity = limit[i];
+        samples[i].time = samples[i - 1].time + (average > 1e-9 ? ds / average : 0);
+    }
+    return samples[n - 1].time;
+}
+
+static int16_t fixed(double value, double scale){
+    double scaled = round(value * scale);
+    if(scaled > 32767 || scaled < -32768){
+        fprintf(stderr, "trajgen: %g does not fit in the table\n", value);
+        exit(1);
+    }
+    return (int16_t)scaled;
+}
+
+/**
+ * Writes one trajectory's table, resampled every period
+ */
+static void writeTrajectory(FILE* out, const Definition& definition, std::vector<Sample>& samples, double duration){
+    int count = (int)ceil(duration * 1000 / period) + 1;
+    fprintf(out, "\n// %s: %zu waypoints, %.2f s, %.1f in%s\n", definition.name.c_str(), definition.waypoints.size(), duration,
+        samples.back().distance, definition.reverse ? ", driven backwards" : "");
+    fprintf(out, "constexpr TrajectoryPoint %sPoints[%d] = {\n", definition.name.c_str(), count);
+
+    size_t j = 0;
+    double direction = definition.reverse ? -1 : 1;
+    for(int i = 0; i < count; i++){
+        double time = fmin(i * period / 1000.0, duration);
+        while(j + 2 < samples.size() && samples[j + 1].time < time) j++;
+        const Sample& a = samples[j];
+        const Sample& b = samples[j + 1];
+        double f = b.time > a.time ? (time - a.time) / (b.time - a.time) : 0;
+        f = fmin(fmax(f, 0), 1);
+
+        double x = a.x + (b.x - a.x) * f;
+        double y = a.y + (b.y - a.y) * f;
+        double heading = a.heading + (b.heading - a.heading) * f + (definition.reverse ? 180 : 0);
+        heading = remainder(heading, 360);
+        double velocity = a.velocity + (b.velocity - a.velocity) * f;
+        double curvature = a.curvature + (b.curvature - a.curvature) * f;
+        if(i == count - 1) velocity = 0;
+
+        fprintf(out, "    {%d, %d, %d, %d, %d},\n", fixed(x, Trajectory::positionScale), fixed(y, Trajectory::positionScale),
+            fixed(heading, Trajectory::headingScale), fixed(direction * velocity, Trajectory::velocityScale),
+            fixed(velocity * curvature * 180 / M_PI, Trajectory::angularVelocityScale));
+    }
+    fprintf(out, "};\nconstexpr Trajectory %s = {%sPoints, %d, %d};\n", definition.name.c_str(), definition.name.c_str(), count, period);
+}
+
+static std::vector<Definition> readDefinitions(const char* path){
+    FILE* in = fopen(path, "r");
+    if(!in){
+        fprintf(stderr, "trajgen: cannot open %s\n", path);
+        exit(1);
+    }
+
+    std::vector<Definition> definitions;
+    Definition* current = NULL;
+    char line[256];
+    int number = 0;
+    while(fgets(line, sizeof(line), in)){
+        number++;
+        char* comment = strchr(line, '#');
+        if(comment) *comment = 0;
+
+        char name[64], flag[16] = "";
+        Definition definition;
+        Waypoint waypoint;
+        waypoint.tangent = 1.2;
+        char word[16];
+        if(sscanf(line, "%15s", word) != 1) continue;
+
+        if(strcmp(word, "trajectory") == 0){
+            int read = sscanf(line, "%*s %63s %lf %lf %lf %lf %15s", name, &definition.maxVelocity, &definition.maxAcceleration,
+                &definition.maxCentripetal, &definition.trackWidth, flag);
+            if(read < 5){
+                fprintf(stderr, "%s:%d: expected trajectory <name> <maxVelocity> <maxAcceleration> <maxCentripetal> <trackWidth> [reverse]\n", path, number);
+                exit(1);
+            }
+            definition.name = name;
+            definition.reverse = strcmp(flag, "reverse") == 0;
+            definitions.push_back(definition);
+            current = &definitions.back();
+        }
+        else if(strcmp(word, "end") == 0){
+            if(!current || current->waypoints.size() < 2){
+                fprintf(stderr, "%s:%d: a trajectory needs at least two waypoints\n", path, number);
+                exit(1);
+            }
+            current = NULL;
+        }
+        else if(current && sscanf(line, "%lf %lf %lf %lf", &waypoint.x, &waypoint.y, &waypoint.heading, &waypoint.tangent) >= 3){
+            current->waypoints.push_back(waypoint);
+        }
+        else{
+            fprintf(stderr, "%s:%d: cannot read \"%s\"\n", path, number, word);
+            exit(1);
+        }
+    }
+    fclose(in);
+    return definitions;
+}
+
+int main(int argc, char** argv){
+    if(argc < 3){
+        fprintf(stderr, "usage: trajgen <definitions> <header>\n");
+        return 1;
+    }
+    std::vector<Definition> definitions = readDefinitions(argv[1]);
+
+    FILE* out = fopen(argv[2], "w");
+    if(!out){
+        fprintf(stderr, "trajgen: cannot write %s\n", argv[2]);
+        return 1;
+    }
+    fprintf(out, "/*----------------------------------------------------------------------------*/\n");
+    fprintf(out, "/*                                                                            */\n");
+    fprintf(out, "/*    Module:       trajectories.h                                            */\n");
+    fprintf(out, "/*    Author:       UNLVEXU                                                   */\n");
+    fprintf(out, "/*    Created:      10/17/2026                                                */\n");
+    fprintf(out, "/*    Description:  Generated by sim/tools/trajgen, do not edit               */\n");
+    fprintf(out, "/*                                                                            */\n");
+    fprintf(out, "/*----------------------------------------------------------------------------*/\n");
+    fprintf(out, "#pragma once\n#include \"trajectory.h\"\n\n// from %s, regenerate with \"make trajectories\" in sim/\nnamespace trajectories{\n", argv[1]);
+
+    for(const Definition& definition : definitions){
+        std::vector<Sample> samples;
+        for(size_t i = 0; i + 1 < definition.waypoints.size(); i++){
+            sampleSegment(definition.waypoints[i], definition.waypoints[i + 1], definition.reverse, samples);
+        }
+        double duration = parameterize(definition, samples);
+        writeTrajectory(out, definition, samples, duration);
+        printf("%-16s %6.1f in %6.2f s\n", definition.name.c_str(), samples.back().distance, duration);
+    }
+
+    fprintf(out, "\n}\n");
+    fclose(out);
+    return 0;
+}
@@ -0,0 +1,366 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       tune.cpp                                                  */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Parallel PID gain search for the chassis motions          */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include "world.h"
+#include "drivetrain.h"
+#include "odom.h"
+
+/**
+ * Usage: tune <drive|turn|swing|arc> [grid|nelder-mead] [threads] [iterations]
+ *
+ * Searches Kp, Ki and Kd (per second units) for one chassis motion by running
+ * simulated episodes, each on a fresh world, spread over all cores. Every gain
+ * set is run through the same handful of motions (the targets below) and
+ * scored on the mean of:
+ *   settle time in seconds
+ *   + 2 * overshoot as a fraction of the target
+ *   + 0.002 * electrical energy in joules
+ *   + 2 + final error as a fraction of the target, if the motion timed out
+ *
+ * grid         log spaced sweep around the simulator's constants
+ * nelder-mead  simplex search in log gain space starting from those constants,
+ *              the four candidate points of each step run as one parallel batch
+ *
+ * Prints the ten best gain sets as set*Constants lines for chassis. Tolerances,
+ * settle time and output limits are the ones the simulator uses and are not searched.
+ */
+
+enum MotionType{ drive, turn, swing, arc };
+
+struct Gains{
+    float Kp;
+    float Ki;
+    float Kd;
+};
+
+struct Evaluation{
+    Gains gains;
+    float score = 0;
+    float time = 0;
+    float overshoot = 0;
+    float energy = 0;
+    int timeouts = 0;
+};
+
+struct Episode{
+    float time = 0;
+    float overshoot = 0;
+    float energy = 0;
+    float error = 0;
+    bool timedOut = false;
+};
+
+/**
+ * Fixed part of each motion's constants, matching simulate
+ */
+struct Motion{
+    const char* name;
+    const char* setter;
+    Gains start;
+    float integralTolerance;
+    float settleTolerance;
+    float settleTime;
+    float targets[4];
+    int targetCount;
+};
+
+static const Motion motions[4] = {
+    {"drive", "setDriveConstants", {1.2, 2, 0.06}, 3, 0.5, 100, {6, 12, 24, 48}, 4},
+    {"turn", "setTurnConstants", {0.3, 1, 0.02}, 10, 1, 100, {15, 45, 90, 170}, 4},
+    {"swing", "setSwingConstants", {0.5, 1, 0.03}, 10, 1, 100, {15, 45, 90, 0}, 3},
+    {"arc", "setArcConstants", {0.4, 1, 0.03}, 10, 1, 100, {30, 60, 90, 0}, 3},
+};
+
+static const float timeout = 3;
+static const float motorResistance = 12 / 2.5;     // ohms, 12 V stall at 2.5 A
+
+static MotionType type = drive;
+static std::atomic<uint64_t> episodes(0);
+static std::vector<Evaluation> history;
+
+/**
+ * Watches the true robot while the motion runs
+ */
+struct Monitor{
+    MotionType type;
+    float startX = 0;
+    float startY = 0;
+    float startHeading = 0;
+    float progress = 0;
+    float most = 0;
+    float least = 0;
+    float energy = 0;
+};
+
+static float progressOf(Monitor* monitor, sim::Robot& robot){
+    if(monitor->type == drive){
+        return (robot.x - monitor->startX) * sinf(monitor->startHeading) + (robot.y - monitor->startY) * cosf(monitor->startHeading);
+    }
+    return (robot.heading - monitor->startHeading) * 180 / M_PI;
+}
+
+static float power(sim::Motor& motor){
+    float volts = motor.voltage();
+    float current = (volts - 12 * motor.velocity / motor.cartridgeRpm) / motorResistance;
+    float watts = volts * current;
+    return watts > 0 ? watts : 0;
+}
+
+static int runMonitor(void* arg){
+    Monitor* monitor = (Monitor*)arg;
+    sim::World& world = *sim::World::current();
+    sim::Robot& robot = world.robot;
+    while(true){
+        monitor->progress = progressOf(monitor, robot);
+        if(monitor->progress > monitor->most) monitor->most = monitor->progress;
+        if(monitor->progress < monitor->least) monitor->least = monitor->progress;
+
+        float watts = 0;
+        for(int i = 0; i < robot.config.motorsPerSide; i++) watts += power(robot.leftMotors[i]) + power(robot.rightMotors[i]);
+        monitor->energy += watts * 0.002f;
+        vex::task::sleep(2);
+    }
+    return 0;
+}
+
+/**
+ * Runs one motion on a fresh world
+ *
+ * @param   gains   the gains to try
+ * @param   target  distance in inches or angle in degrees
+ *
+ * @return  what happened
+ */
+static Episode runEpisode(Gains gains, float target){
+    const Motion& motion = motions[type];
+    sim::RobotConfig config;
+    sim::World world(config);
+
+    float trackingDegreesToInches = M_PI * config.trackingWheelDiameter / 360;
+    SensorHub sensors(&world.Left, &world.Right, &world.Inertial);
+    sensors.setVerticalTracking(&world.VerticalRotation);
+    sensors.setHorizontalTracking(&world.HorizontalRotation);
+    odom tracker(sensors, config.verticalOffset, trackingDegreesToInches, config.horizontalOffset, trackingDegreesToInches, 10);
+    chassis robot(&tracker, &sensors, &world.Left, &world.Right, config.trackWidth, trackingDegreesToInches);
+
+    world.run(0.05);
+    Monitor monitor;
+    monitor.type = type;
+    monitor.startX = world.robot.x;
+    monitor.startY = world.robot.y;
+    monitor.startHeading = world.robot.heading;
+    vex::thread monitorTask(runMonitor, &monitor);
+
+    Episode episode;
+    float I = motion.integralTolerance;
+    float S = motion.settleTolerance;
+    float T = motion.settleTime;
+    if(type == drive) episode.time = robot.driveFor(target, timeout, 0, gains.Kp, gains.Ki, gains.Kd, I, S, T, -12, 12, 0.2);
+    if(type == turn) episode.time = robot.turnFor(target, timeout, gains.Kp, gains.Ki, gains.Kd, I, S, T, -12, 12);
+    if(type == swing) episode.time = robot.swingFor(vex::turnType::right, target, timeout, gains.Kp, gains.Ki, gains.Kd, I, S, T, -12, 12);
+    if(type == arc) episode.time = robot.arcFor(vex::turnType::left, 20, target, timeout, gains.Kp, gains.Ki, gains.Kd, I, S, T, -12, 12);
+    world.run(0.2);
+
+    float direction = monitor.progress >= 0 ? 1 : -1;
+    float farthest = direction > 0 ? monitor.most : -monitor.least;
+    episode.overshoot = farthest > target ? farthest - target : 0;
+    episode.error = fabsf(direction * monitor.progress - target);
+    episode.energy = monitor.energy;
+    episode.timedOut = episode.time >= timeout - 0.01f;
+
+    episodes++;
+    return episode;
+}
+
+/**
+ * Scores gain sets, every gain set and target pair is one job for the worker threads
+ *
+ * @param   sets        the gain sets to score
+ * @param   threads     number of worker threads
+ *
+ * @return  one evaluation per gain set, also added to the history
+ */
+static std::vector<Evaluation> evaluate(const std::vector<Gains>& sets, int threads){
+    const Motion& motion = motions[type];
+    size_t jobs = sets.size() * motion.targetCount;
+    std::vector<Episode> results(jobs);
+    std::atomic<size_t> next(0);
+
+    std::vector<std::thread> workers;
+    for(int t = 0; t < threads; t++){
+        workers.push_back(std::thread([&](){
+            for(size_t job = next++; job < jobs; job = next++){
+                results[job] = runEpisode(sets[job / motion.targetCount], motion.targets[job % motion.targetCount]);
+            }
+        }));
+    }
+    for(std::thread& worker : workers) worker.join();
+
+    std::vector<Evaluation> evaluations(sets.size());
+    for(size_t s = 0; s < sets.size(); s++){
+        Evaluation& evaluation = evaluations[s];
+        evaluation.gains = sets[s];
+        for(int t = 0; t < motion.targetCount; t++){
+            const Episode& episode = results[s * motion.targetCount + t];
+            float target = motion.targets[t];
+            float score = episode.time + 2 * episode.overshoot / target + 0.002f * episode.energy;
+            if(episode.timedOut) score += 2 + episode.error / target;
+
+            evaluation.score += score / motion.targetCount;
+            evaluation.time += episode.time / motion.targetCount;
+            evaluation.overshoot += episode.overshoot / motion.targetCount;
+            evaluation.energy += episode.energy / motion.targetCount;
+            evaluation.timeouts += episode.timedOut;
+        }
+        history.push_back(evaluation);
+    }
+    return evaluations;
+}
+
+static void gridSearch(int threads){
+    const float scales[7] = {0.25, 0.4, 0.63, 1, 1.6, 2.5, 4};
+    const float integralScales[4] = {0, 0.25, 1, 4};
+    Gains start = motions[type].start;
+
+    std::vector<Gains> sets;
+    for(float p : scales){
+        for(float i : integralScales){
+            for(float d : scales) sets.push_back({start.Kp * p, start.Ki * i, start.Kd * d});
+        }
+    }
+    evaluate(sets, threads);
+}
+
+/**
+ * Simplex search over log10 of the gains
+ */
+static void nelderMead(int threads, int iterations){
+    const int n = 3;
+    Gains start = motions[type].start;
+    float origin[n] = {log10f(start.Kp), log10f(start.Ki), log10f(start.Kd)};
+
+    auto toGains = [](const float* x){ Gains gains = {powf(10, x[0]), powf(10, x[1]), powf(10, x[2])}; return gains; };
+
+    float simplex[n + 1][n];
+    std::vector<Gains> sets;
+    for(int v = 0; v <= n; v++){
+        for(int k = 0; k < n; k++) simplex[v][k] = origin[k] + (v == k + 1 ? 0.4f : 0);
+        sets.push_back(toGains(simplex[v]));
+    }
+    std::vector<Evaluation> scored = evaluate(sets, threads);
+    float scores[n + 1];
+    for(int v = 0; v <= n; v++) scores[v] = scored[v].score;
+
+    for(int iteration = 0; iteration < iterations; iteration++){
+        int order[n + 1] = {0, 1, 2, 3};
+        std::sort(order, order + n + 1, [&](int a, int b){ return scores[a] < scores[b]; });
+        int worst = order[n];
+
+        float centroid[n] = {};
+        for(int v = 0; v < n; v++){
+            for(int k = 0; k < n; k++) centroid[k] += simplex[order[v]][k] / n;
+        }
+
+        // reflection, expansion, outside and inside contraction, scored together
+        const float steps[4] = {1, 2, 0.5, -0.5};
+        float candidates[4][n];
+        sets.clear();
+        for(int c = 0; c < 4; c++){
+            for(int k = 0; k < n; k++) candidates[c][k] = centroid[k] + steps[c] * (centroid[k] - simplex[worst][k]);
+            sets.push_back(toGains(candidates[c]));
+        }
+        scored = evaluate(sets, threads);
+
+        float best = scores[order[0]];
+        float secondWorst = scores[order[n - 1]];
+        int chosen = -1;
+        if(scored[0].score < best) chosen = scored[1].score < scored[0].score ? 1 : 0;
+        else if(scored[0].score < secondWorst) chosen = 0;
+        else if(scored[0].score < scores[worst]) chosen = scored[2].score <= scored[0].score ? 2 : -1;
+        else if(scored[3].score < scores[worst]) chosen = 3;
+
+        if(chosen >= 0){
+            for(int k = 0; k < n; k++) simplex[worst][k] = candidates[chosen][k];
+            scores[worst] = scored[chosen].score;
+            continue;
+        }
+
+        // shrink toward the best vertex
+        sets.clear();
+        for(int v = 1; v <= n; v++){
+            for(int k = 0; k < n; k++) simplex[order[v]][k] = simplex[order[0]][k] + 0.5f * (simplex[order[v]][k] - simplex[order[0]][k]);
+            sets.push_back(toGains(simplex[order[v]]));
+        }
+        scored = evaluate(sets, threads);
+        for(int v = 1; v <= n; v++) scores[order[v]] = scored[v - 1].score;
+    }
+}
+
+int main(int argc, char** argv){
+    const char* motionName = argc > 1 ? argv[1] : "drive";
+    const char* method = argc > 2 ? argv[2] : "nelder-mead";
+    int threads = argc > 3 ? atoi(argv[3]) : std::thread::hardware_concurrency();
+    int iterations = argc > 4 ? atoi(argv[4]) : 40;
+    if(threads < 1) threads = 1;
+
+    bool found = false;
+    for(int m = 0; m < 4; m++){
+        if(strcmp(motionName, motions[m].name) == 0){
+            type = (MotionType)m;
+            found = true;
+        }
+    }
+    if(!found || (strcmp(method, "grid") != 0 && strcmp(method, "nelder-mead") != 0)){
+        printf("usage: tune <drive|turn|swing|arc> [grid|nelder-mead] [threads] [iterations]\n");
+        return 1;
+    }
+
+    auto wallStart = std::chrono::steady_clock::now();
+    if(strcmp(method, "grid") == 0) gridSearch(threads);
+    else nelderMead(threads, iterations);
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    std::sort(history.begin(), history.end(), [](const Evaluation& a, const Evaluation& b){ return a.score < b.score; });
+
+    const Motion& motion = motions[type];
+    printf("%s, %s: %zu gain sets, %llu episodes on %d threads in %.2f s (%.0f episodes/s)\n\n", motion.name, method,
+        history.size(), (unsigned long long)episodes.load(), threads, wall, episodes.load() / wall);
+    printf("%4s %8s %8s %10s %9s %8s  %s\n", "rank", "score", "settle s", "overshoot", "energy J", "timeouts", "chassis constants");
+    std::vector<Gains> printed;
+    int rank = 0;
+    for(size_t i = 0; i < history.size() && rank < 10; i++){
+        const Evaluation& evaluation = history[i];
+        bool duplicate = false;
+        for(const Gains& gains : printed){
+            if(fabsf(gains.Kp - evaluation.gains.Kp) < 1e-4f && fabsf(gains.Ki - evaluation.gains.Ki) < 1e-4f && fabsf(gains.Kd - evaluation.gains.Kd) < 1e-5f) duplicate = true;
+        }
+        if(duplicate) continue;
+        printed.push_back(evaluation.gains);
+        rank++;
+
+        char line[160];
+        if(type == drive){
+            snprintf(line, sizeof(line), "%s(%.4g, %.4g, %.4g, %g, %g, %g, -12, 12, 0.2);", motion.setter, evaluation.gains.Kp, evaluation.gains.Ki,
+                evaluation.gains.Kd, motion.integralTolerance, motion.settleTolerance, motion.settleTime);
+        }
+        else{
+            snprintf(line, sizeof(line), "%s(%.4g, %.4g, %.4g, %g, %g, %g, -12, 12);", motion.setter, evaluation.gains.Kp, evaluation.gains.Ki,
+                evaluation.gains.Kd, motion.integralTolerance, motion.settleTolerance, motion.settleTime);
+        }
+        printf("%4d %8.3f %8.3f %10.3f %9.1f %6d/%d  %s\n", rank, evaluation.score, evaluation.time, evaluation.overshoot, evaluation.energy,
+            evaluation.timeouts, motion.targetCount, line);
+    }
+    return 0;
+}
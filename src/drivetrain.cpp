@@ -43,78 +43,313 @@ float chassis::radToDeg(float rad)
 }
 
 /**
- * Constructor method using internal motor encoders
+ * Private function that gives the distance driven according to a sensor frame
  * 
- * @param   getRobotPosition    a function that returns a std::vector<float> representing the robot's position
- * @param   Left                a pointer to the left motor group of the drivetrain
- * @param   Right               a pointer to the right motor group of the drivetrain
- * @param   Inertial            a pointer to the v5 inertial sensor on the drivetrain
- * @param   trackWidth          the trackwidth of the robot's drivetrain
- * @param   degreesToInches     a ratio to convert degrees to inches
+ * @param   frame   the sensor frame
+ * 
+ * @return  the tracked forward distance, in inches
  */
-chassis::chassis(std::function<std::vector<float>()> getRobotPosition, vex::motor_group *Left, vex::motor_group *Right, vex::inertial *Inertial, float trackWidth, float degreesToInches)
+float chassis::trackedDistance(const SensorFrame &frame)
 {
-    this->getRobotPosition = getRobotPosition;
-    this->Left = Left;
-    this->Right = Right;
-    this->Inertial = Inertial;
-    this->trackWidth = trackWidth;
-    this->degreesToInches = degreesToInches;
-    this->trackingType = verticalTracking::motorEncoder;
+    if(this->trackingType == chassis::verticalTracking::trackingWheel) return frame.vertical * this->degreesToInches;
+    return frame.left * this->degreesToInches;
 }
 
 /**
- * Constructor method using a 3-Wire Optical Shaft Encoder
+ * Private function that finds where a circle around the robot leaves a path segment
  * 
- * @param   getRobotPosition    a function that returns a std::vector<float> representing the robot's position
- * @param   Left                a pointer to the left motor group of the drivetrain
- * @param   Right               a pointer to the right motor group of the drivetrain
- * @param   Inertial            a pointer to the v5 inertial sensor on the drivetrain
- * @param   VerticalEncoder     a pointer to the vertical opitcal shaft encoder
- * @param   trackWidth          the trackwidth of the robot's drivetrain
- * @param   degreesToInches     a ratio to convert degrees to inches
+ * @param   start   the start of the segment
+ * @param   end     the end of the segment
+ * @param   x       x coordinate of the circle's center, in inches
+ * @param   y       y coordinate of the circle's center, in inches
+ * @param   radius  the circle's radius, in inches
+ * 
+ * @return  how far along the segment the farther intersection is, from 0 to 1, or -1 if it is not on the segment
  */
-chassis::chassis(std::function<std::vector<float>()> getRobotPosition, vex::motor_group *Left, vex::motor_group *Right, vex::inertial* Inertial, vex::encoder *VerticalEncoder, float trackWidth,float degreesToInches)
+float chassis::circleIntersection(PathPoint start, PathPoint end, float x, float y, float radius)
 {
-    this->getRobotPosition = getRobotPosition;
-    this->Left = Left;
-    this->Right = Right;
-    this->Inertial = Inertial;
-    this->VerticalEncoder = VerticalEncoder;
-    this->trackWidth = trackWidth;
-    this->degreesToInches = degreesToInches;
-    this->trackingType = verticalTracking::encoder;
+    float dx = end.x - start.x;
+    float dy = end.y - start.y;
+    float fx = start.x - x;
+    float fy = start.y - y;
+
+    float a = dx * dx + dy * dy;
+    float b = 2 * (fx * dx + fy * dy);
+    float c = fx * fx + fy * fy - radius * radius;
+    float discriminant = b * b - 4 * a * c;
+    if(discriminant < 0) return -1;
+
+    float fraction = (-b + sqrtf(discriminant)) / (2 * a);
+    if(fraction < 0 || fraction > 1) return -1;
+    return fraction;
+}
+
+/**
+ * Private function that tells a motion loop to stop because its async motion was cancelled
+ * 
+ * @return  true if the async motion running now has been cancelled
+ */
+bool chassis::isCancelled()
+{
+    uint32_t running = this->startedMotion.load();
+    return this->finishedMotion.load() != running && this->cancelledMotion.load() == running;
+}
+
+/**
+ * Private function that runs the queued async motion, the body of the motion task
+ * 
+ * @param   arg the chassis
+ */
+int chassis::runMotion(void* arg)
+{
+    chassis* Chassis = (chassis*)arg;
+    Chassis->motionTime = Chassis->asyncMotion();
+    Chassis->finishedMotion.store(Chassis->startedMotion.load());
+    return 0;
+}
+
+/**
+ * Private function that takes the chain settings set by chain() for the motion starting now
+ * along with what the motion before it left undone, if it was chained
+ * 
+ * @return  the settings, inactive if chain() was not called since the last motion
+ */
+chassis::Chain chassis::takeChain()
+{
+    Chain chain = this->nextChain;
+    this->nextChain = Chain();
+    return chain;
+}
+
+/**
+ * Private function that keeps a chained motion's output at the minimum carried speed
+ * 
+ * @param   output      the controller's output, in volts
+ * @param   direction   1 or -1, the direction the motion moves in
+ * @param   chain       the motion's chain settings
+ * 
+ * @return  the output, raised to minSpeed in the direction of the motion if the motion is chained
+ */
+float chassis::carry(float output, float direction, const Chain &chain)
+{
+    if(chain.active && output * direction < chain.minSpeed) return direction * chain.minSpeed;
+    return output;
+}
+
+/**
+ * Private function that ends a motion
+ * An unchained motion stops and holds. A chained motion leaves the motors running so the
+ * next motion starts from the speed it left, unless it was cancelled.
+ * 
+ * @param   chain   the motion's chain settings
+ * @param   loop    the motion's loop timer
+ */
+void chassis::endMotion(const Chain &chain, LoopTimer &loop)
+{
+    this->carried = chain.active && !this->isCancelled();
+    if(!this->carried) this->stopDrive(vex::brakeType::hold);
+    this->motionStats = loop.getStats();
+}
+
+/**
+ * Private function that measures the forward speed from the tracked distance between frames
+ * Motions call it every tick, so a chained motion can hand its speed to the next one.
+ * 
+ * @param   frame   the newest sensor frame
+ */
+void chassis::trackSpeed(const SensorFrame &frame)
+{
+    if(frame.timestamp <= this->speedFrame.timestamp) return;
+    float dt = (frame.timestamp - this->speedFrame.timestamp) / 1e6f;
+    this->measuredSpeed = dt < 0.1f ? (this->trackedDistance(frame) - this->trackedDistance(this->speedFrame)) / dt : 0;
+    this->speedFrame = frame;
+}
+
+/**
+ * Private function that runs one settle motion, the loop behind every drive, turn, swing and arc
+ * The PID corrects around the profile's setpoints and feedforward, and cannot settle before the
+ * profile ends. A profile with a max velocity of 0 is a step to the target, a plain PID.
+ * 
+ * @tparam  Sensor              motion::TrackingWheel, MotorEncoder, Rotation or Heading, what the motion moves
+ * @tparam  Error               motion::RelativeError or HeadingError, how far the motion is from its target
+ * @tparam  Mixer               motion::DriveMixer or SideMixer, how the output reaches the motors
+ * @param   amount              the distance or rotation to move, or the heading to move to
+ * @param   timeout             the time before the motion gives up, in seconds
+ * @param   constants           the PID's gains and limits
+ * @param   profileConstants    the profile's limits and feedforward
+ * @param   mixer               the output mixer
+ * 
+ * @return  the time it takes for the PID to settle or time out
+ */
+template<class Sensor, class Error, class Mixer>
+float chassis::motionLoop(float amount, float timeout, const PIDConstants &constants, const ProfileConstants &profileConstants, Mixer &mixer)
+{
+    ProfiledPID pid = ProfiledPID(constants.Kp, constants.Ki, constants.Kd, constants.integralTolerance, constants.settleTolerance, constants.settleTime, constants.minOutput, constants.maxOutput, this->loopPeriod);
+    pid.setFeedforward(profileConstants.kS, profileConstants.kV, profileConstants.kA);
+
+    Chain chain = this->takeChain();
+    if(Error::relative) amount += Sensor::angular ? chain.leftoverRotation : chain.leftoverDistance;
+
+    SensorFrame initial = this->Sensors->getFrame();
+    float start = Sensor::read(initial, this->degreesToInches);
+    float distance = Error::distance(amount, start);
+    float direction = distance < 0 ? -1 : 1;
+    float startVelocity = this->carried ? (Sensor::angular ? initial.gyroRate : this->measuredSpeed) : 0;
+    this->profile.generate(distance, profileConstants.maxVelocity, profileConstants.maxAcceleration, profileConstants.maxJerk, this->loopPeriod / 1000.0f, startVelocity);
+
+    mixer.start(this->Left, this->Right);
+    LoopTimer loop(this->loopPeriod);
+    while(!(pid.isSettled() && loop.getElapsed() >= this->profile.getDuration()) && loop.getElapsed() < timeout && !this->isCancelled()){
+        SensorFrame frame = this->Sensors->getFrame();
+        this->trackSpeed(frame);
+        float measured = Sensor::read(frame, this->degreesToInches);
+
+        // a chained motion exits on what is left to the target, wherever the profile is
+        float remaining = Error::error(start, distance, measured);
+        if(chain.active && remaining * direction < (Sensor::angular ? chain.exitAngle : chain.exitDistance)){
+            if(Sensor::angular) this->nextChain.leftoverRotation = remaining;
+            else this->nextChain.leftoverDistance = remaining;
+            break;
+        }
+
+        ProfilePoint setpoint = this->profile.sample(loop.getElapsed());
+        pid.setReference(setpoint.velocity, setpoint.acceleration);
+        float output = this->carry(pid.getOutputDt(Error::error(start, setpoint.position, measured), loop.getDt()), direction, chain);
+        mixer.apply(this->Left, this->Right, output, frame, loop.getDt());
+        if(this->telemetry) this->telemetry->push(TelemetryChannel::motion, setpoint.position, measured - start, remaining, output);
+
+        loop.wait();
+    }
+
+    this->endMotion(chain, loop);
+
+    return loop.getElapsed();
+}
+
+/**
+ * Private function that drives for a distance while holding a heading
+ * The tracking source is picked here, once per drive.
+ * 
+ * @param   distance    the distance to be driven, in inches
+ * @param   timeout     the time before the drive gives up, in seconds
+ * @param   heading     the heading to hold, in degrees
+ * @param   constants   the drive PID's gains and limits
+ * @param   headingKp   the proportional constant for the heading PID
+ * 
+ * @return  the time it takes for the PID to settle or time out
+ */
+float chassis::driveMotion(float distance, float timeout, float heading, const PIDConstants &constants, float headingKp)
+{
+    motion::DriveMixer mixer(heading, headingKp, constants.minOutput, constants.maxOutput, this->loopPeriod);
+    if(this->trackingType == verticalTracking::trackingWheel) return this->motionLoop<motion::TrackingWheel, motion::RelativeError>(distance, timeout, constants, this->driveProfileConstants, mixer);
+    return this->motionLoop<motion::MotorEncoder, motion::RelativeError>(distance, timeout, constants, this->driveProfileConstants, mixer);
+}
+
+/**
+ * Private function that rotates the robot with each side at a fixed multiple of the output
+ * 
+ * @param   mixer               the side gains, clockwise output to each side's voltage
+ * @param   amount              the rotation clockwise in degrees, or the heading to rotate to
+ * @param   absolute            whether amount is a heading
+ * @param   timeout             the time before the motion gives up, in seconds
+ * @param   constants           the PID's gains and limits
+ * @param   profileConstants    the profile's limits and feedforward
+ * 
+ * @return  the time it takes for the PID to settle or time out
+ */
+float chassis::rotateMotion(motion::SideMixer mixer, float amount, bool absolute, float timeout, const PIDConstants &constants, const ProfileConstants &profileConstants)
+{
+    if(absolute) return this->motionLoop<motion::Heading, motion::HeadingError>(amount, timeout, constants, profileConstants, mixer);
+    return this->motionLoop<motion::Rotation, motion::RelativeError>(amount, timeout, constants, profileConstants, mixer);
+}
+
+/**
+ * Private function that turns in place, for a rotation or to a heading
+ * 
+ * @param   amount      the degrees to turn clockwise, or the heading to turn to
+ * @param   absolute    whether amount is a heading
+ * @param   timeout     the time before the PID gives up, in seconds
+ * @param   constants   the turn PID's gains and limits
+ * 
+ * @return  the time it takes for the PID to settle or time out
+ */
+float chassis::turnMotion(float amount, bool absolute, float timeout, const PIDConstants &constants)
+{
+    return this->rotateMotion(motion::SideMixer(1, -1), amount, absolute, timeout, constants, this->turnProfileConstants);
+}
+
+/**
+ * Private function that swings on one side, holding the other, for a rotation or to a heading
+ * 
+ * @param   direction   the direction to swing, right drives the left side
+ * @param   amount      the degrees to swing in that direction, or the heading to swing to
+ * @param   absolute    whether amount is a heading
+ * @param   timeout     the time before the PID gives up, in seconds
+ * @param   constants   the swing PID's gains and limits
+ * 
+ * @return  the time it takes for the PID to settle or time out
+ */
+float chassis::swingMotion(vex::turnType direction, float amount, bool absolute, float timeout, const PIDConstants &constants)
+{
+    bool right = direction == vex::turnType::right;
+    if(!absolute && !right) amount = -amount;
+    return this->rotateMotion(right ? motion::SideMixer(1, 0) : motion::SideMixer(0, -1), amount, absolute, timeout, constants, ProfileConstants());
+}
+
+/**
+ * Private function that arcs around a radius, for a rotation or to a heading
+ * The inner side runs at the outer side's output scaled by the ratio of their radii.
+ * 
+ * @param   direction   the direction to arc
+ * @param   radius      the radius of the arc, to the center of the robot
+ * @param   amount      the degrees to arc in that direction, or the heading to arc to
+ * @param   absolute    whether amount is a heading
+ * @param   timeout     the time before the PID gives up, in seconds
+ * @param   constants   the arc PID's gains and limits
+ * 
+ * @return  the time it takes for the PID to settle or time out
+ */
+float chassis::arcMotion(vex::turnType direction, float radius, float amount, bool absolute, float timeout, const PIDConstants &constants)
+{
+    float multiplier = (radius - this->trackWidth/2) / (radius + this->trackWidth/2);
+    bool right = direction == vex::turnType::right;
+    if(!absolute && !right) amount = -amount;
+    return this->rotateMotion(right ? motion::SideMixer(1, multiplier) : motion::SideMixer(-multiplier, -1), amount, absolute, timeout, constants, ProfileConstants());
 }
 
 /**
- * Constructor method using a v5 rotation sensor
+ * Constructor method
+ * Drive distance is measured with the vertical tracking wheel if the sensor hub has one,
+ * otherwise with the left motor encoders
  * 
- * @param   getRobotPosition    a function that returns a std::vector<float> representing the robot's position
+ * @param   Odom                a pointer to the odom object tracking the robot's position
+ * @param   Sensors             a pointer to the sensor hub shared with odom
  * @param   Left                a pointer to the left motor group of the drivetrain
  * @param   Right               a pointer to the right motor group of the drivetrain
- * @param   Inertial            a pointer to the v5 inertial sensor on the drivetrain
- * @param   VerticalRotation    a pointer to the vertical v5 rotation sensor
  * @param   trackWidth          the trackwidth of the robot's drivetrain
  * @param   degreesToInches     a ratio to convert degrees to inches
  */
-chassis::chassis(std::function<std::vector<float>()> getRobotPosition, vex::motor_group *Left, vex::motor_group *Right, vex::inertial* Inertial, vex::rotation *VerticalRotation, float trackWidth, float degreesToInches)
+chassis::chassis(odom *Odom, SensorHub *Sensors, vex::motor_group *Left, vex::motor_group *Right, float trackWidth, float degreesToInches)
 {
-    this->getRobotPosition = getRobotPosition;
+    this->Odom = Odom;
+    this->Sensors = Sensors;
     this->Left = Left;
     this->Right = Right;
-    this->Inertial = Inertial;
-    this->VerticalRotation = VerticalRotation;
     this->trackWidth = trackWidth;
     this->degreesToInches = degreesToInches;
-    this->trackingType = verticalTracking::rotation;
+    if(Sensors->hasVerticalTracking()) this->trackingType = verticalTracking::trackingWheel;
+    else this->trackingType = verticalTracking::motorEncoder;
+    this->startedMotion = 0;
+    this->finishedMotion = 0;
+    this->cancelledMotion = 0;
 }
 
 /**
  * Tunes the constants of the drive PID
  * 
  * @param   Kd                  proportional constant
- * @param   Ki                  integral constant
- * @param   Kd                  derivative constant
+ * @param   Ki                  integral constant, applied to the error integrated over seconds
+ * @param   Kd                  derivative constant, applied to the change in error per second
  * @param   integralTolerance   integral tolerance
  * @param   settleTolerance     settle tolerance
  * @param   settleTime          required settle time
@@ -139,8 +374,8 @@ void chassis::setDriveConstants(float Kp, float Ki, float Kd, float integralTole
  * Tunes the constants of the turn PID
  * 
  * @param   Kd                  proportional constant
- * @param   Ki                  integral constant
- * @param   Kd                  derivative constant
+ * @param   Ki                  integral constant, applied to the error integrated over seconds
+ * @param   Kd                  derivative constant, applied to the change in error per second
  * @param   integralTolerance   integral tolerance
  * @param   settleTolerance     settle tolerance
  * @param   settleTime          required settle time
@@ -163,8 +398,8 @@ void chassis::setTurnConstants(float Kp, float Ki, float Kd, float integralToler
  * Tunes the constants of the swing PID
  * 
  * @param   Kd                  proportional constant
- * @param   Ki                  integral constant
- * @param   Kd                  derivative constant
+ * @param   Ki                  integral constant, applied to the error integrated over seconds
+ * @param   Kd                  derivative constant, applied to the change in error per second
  * @param   integralTolerance   integral tolerance
  * @param   settleTolerance     settle tolerance
  * @param   settleTime          required settle time
@@ -187,8 +422,8 @@ void chassis::setSwingConstants(float Kp, float Ki, float Kd, float integralTole
  * Tunes the constants of the arc PID
  * 
  * @param   Kd                  proportional constant
- * @param   Ki                  integral constant
- * @param   Kd                  derivative constant
+ * @param   Ki                  integral constant, applied to the error integrated over seconds
+ * @param   Kd                  derivative constant, applied to the change in error per second
  * @param   integralTolerance   integral tolerance
  * @param   settleTolerance     settle tolerance
  * @param   settleTime          required settle time
@@ -207,6 +442,150 @@ void chassis::setArcConstants(float Kp, float Ki, float Kd, float integralTolera
     this->arcConstants.maxOutput = maxOutput;
 }
 
+/**
+ * Tunes the path follower
+ * 
+ * @param   lookahead           how far ahead on the path the robot steers toward, in inches
+ * @param   Kp                  volts per inch left to the end of the path, slows the robot down as it arrives
+ * @param   settleTolerance     how close to the end of the path counts as done, in inches
+ * @param   maxOutput           the fastest either side may be driven, in volts
+ */
+void chassis::setPathConstants(float lookahead, float Kp, float settleTolerance, float maxOutput)
+{
+    this->pathConstants.lookahead = lookahead;
+    this->pathConstants.Kp = Kp;
+    this->pathConstants.settleTolerance = settleTolerance;
+    this->pathConstants.maxOutput = maxOutput;
+}
+
+/**
+ * Tunes the trajectory tracker
+ * b and zeta are in the units RAMSETE is usually given in, meters and radians. The robot
+ * resists turning differently than driving straight, so the wheel speed from each has its
+ * own feedforward.
+ * 
+ * @param   b       how hard position error is corrected, larger is more aggressive, 2 is the usual start
+ * @param   zeta    damping of the correction, from 0 to 1, 0.7 is the usual start
+ * @param   kS      static feedforward, in volts
+ * @param   kV      volts per inch per second driving straight
+ * @param   kA      volts per inch per second squared driving straight
+ * @param   turnKV  volts per inch per second of wheel speed turning in place
+ * @param   turnKA  volts per inch per second squared of wheel acceleration turning in place
+ */
+void chassis::setRamseteConstants(float b, float zeta, float kS, float kV, float kA, float turnKV, float turnKA)
+{
+    this->ramseteConstants.b = b;
+    this->ramseteConstants.zeta = zeta;
+    this->ramseteConstants.kS = kS;
+    this->ramseteConstants.kV = kV;
+    this->ramseteConstants.kA = kA;
+    this->ramseteConstants.turnKV = turnKV;
+    this->ramseteConstants.turnKA = turnKA;
+}
+
+/**
+ * Tunes chained motions, see chain()
+ * 
+ * @param   exitDistance    how far before the target a chained drive ends, in inches
+ * @param   exitAngle       how far before the target a chained turn, swing or arc ends, in degrees
+ * @param   minSpeed        the least output a chained motion slows down to, in volts
+ */
+void chassis::setChainConstants(float exitDistance, float exitAngle, float minSpeed)
+{
+    this->chainConstants.exitDistance = exitDistance;
+    this->chainConstants.exitAngle = exitAngle;
+    this->chainConstants.minSpeed = minSpeed;
+}
+
+/**
+ * Tunes driveToPose and driveTo
+ * They drive with the drive PID and steer with the turn PID
+ * 
+ * @param   lead            how far the carrot point is pulled back from the target, as a fraction of the distance left, from 0 to 1
+ * @param   closeDistance   how close to the target the robot stops aiming at it and only holds heading, in inches
+ */
+void chassis::setPoseConstants(float lead, float closeDistance)
+{
+    this->poseConstants.lead = lead;
+    this->poseConstants.closeDistance = closeDistance;
+}
+
+/**
+ * Sets the motion profile drives follow
+ * Drives track the profile's setpoints with feedforward, the PID only corrects the error.
+ * A max velocity of 0 turns profiling off and drives go straight to the PID.
+ * 
+ * @param   maxVelocity     the velocity limit, in inches per second
+ * @param   maxAcceleration the acceleration limit, in inches per second squared
+ * @param   maxJerk         the jerk limit, in inches per second cubed, 0 for a trapezoidal profile
+ * @param   kS              static feedforward, in volts
+ * @param   kV              velocity feedforward, in volts per inch per second
+ * @param   kA              acceleration feedforward, in volts per inch per second squared
+ */
+void chassis::setDriveProfile(float maxVelocity, float maxAcceleration, float maxJerk, float kS, float kV, float kA)
+{
+    this->driveProfileConstants.maxVelocity = maxVelocity;
+    this->driveProfileConstants.maxAcceleration = maxAcceleration;
+    this->driveProfileConstants.maxJerk = maxJerk;
+    this->driveProfileConstants.kS = kS;
+    this->driveProfileConstants.kV = kV;
+    this->driveProfileConstants.kA = kA;
+}
+
+/**
+ * Sets the motion profile turns follow
+ * Turns track the profile's setpoints with feedforward, the PID only corrects the error.
+ * A max velocity of 0 turns profiling off and turns go straight to the PID.
+ * 
+ * @param   maxVelocity     the angular velocity limit, in degrees per second
+ * @param   maxAcceleration the angular acceleration limit, in degrees per second squared
+ * @param   maxJerk         the angular jerk limit, in degrees per second cubed, 0 for a trapezoidal profile
+ * @param   kS              static feedforward, in volts
+ * @param   kV              velocity feedforward, in volts per degree per second
+ * @param   kA              acceleration feedforward, in volts per degree per second squared
+ */
+void chassis::setTurnProfile(float maxVelocity, float maxAcceleration, float maxJerk, float kS, float kV, float kA)
+{
+    this->turnProfileConstants.maxVelocity = maxVelocity;
+    this->turnProfileConstants.maxAcceleration = maxAcceleration;
+    this->turnProfileConstants.maxJerk = maxJerk;
+    this->turnProfileConstants.kS = kS;
+    this->turnProfileConstants.kV = kV;
+    this->turnProfileConstants.kA = kA;
+}
+
+/**
+ * Sets the period of the motion control loops
+ * 
+ * @param   milliseconds    the time between control loop ticks, in milliseconds
+ */
+void chassis::setLoopPeriod(uint32_t milliseconds)
+{
+    this->loopPeriod = milliseconds;
+}
+
+/**
+ * Getter for the loop timing of the most recent motion
+ * 
+ * @return  tick count, overruns, measured dt and jitter of the last motion's control loop
+ */
+LoopStats chassis::getMotionStats()
+{
+    return this->motionStats;
+}
+
+/**
+ * Records every tick of every motion
+ * Motions run on the calling task or the async motion task, never both at once,
+ * so the ring must belong to the chassis alone.
+ * 
+ * @param   telemetry   a ring only the chassis pushes to, or 0 to stop recording
+ */
+void chassis::setTelemetry(TelemetryRing* telemetry)
+{
+    this->telemetry = telemetry;
+}
+
 /**
  * Drives for a distance using a PID with no timeout
  * 
@@ -216,7 +595,7 @@ void chassis::setArcConstants(float Kp, float Ki, float Kd, float integralTolera
  */
 float chassis::driveFor(float distance)
 {
-    return this->driveFor(distance, INFINITY, 0, this->driveConstants.Kp, this->driveConstants.Ki, this->driveConstants.Kd, this->driveConstants.integralTolerance, this->driveConstants.settleTolerance, this->driveConstants.settleTime, this->driveConstants.minOutput, this->driveConstants.maxOutput, 0);
+    return this->driveMotion(distance, INFINITY, 0, this->driveConstants, 0);
 }
 
 /**
@@ -229,7 +608,7 @@ float chassis::driveFor(float distance)
  */
 float chassis::driveFor(float distance, float timeout)
 {
-    return this->driveFor(distance, timeout, 0, this->driveConstants.Kp, this->driveConstants.Ki, this->driveConstants.Kd, this->driveConstants.integralTolerance, this->driveConstants.settleTolerance, this->driveConstants.settleTime, this->driveConstants.minOutput, this->driveConstants.maxOutput, 0);
+    return this->driveMotion(distance, timeout, 0, this->driveConstants, 0);
 }
 
 /**
@@ -244,7 +623,7 @@ float chassis::driveFor(float distance, float timeout)
  */
 float chassis::driveFor(float distance, float timeout, float heading)
 {
-    return this->driveFor(distance, timeout, heading, this->driveConstants.Kp, this->driveConstants.Ki, this->driveConstants.Kd, this->driveConstants.integralTolerance, this->driveConstants.settleTolerance, this->driveConstants.settleTime, this->driveConstants.minOutput, this->driveConstants.maxOutput, this->driveConstants.headingKp);
+    return this->driveMotion(distance, timeout, heading, this->driveConstants, this->driveConstants.headingKp);
 }
 
 /**
@@ -253,8 +632,8 @@ float chassis::driveFor(float distance, float timeout, float heading)
  * @param   distance            the distance to be driven, in inches
  * @param   timeout             the time before the drive gives up, in seconds
  * @param   Kp                  the proportional constant
- * @param   Ki                  the integral constant
- * @param   Kd                  the derivative constant
+ * @param   Ki                  the integral constant, per second
+ * @param   Kd                  the derivative constant, per second
  * @param   integralTolerance   the tolerance range for the integral to grow, in inches
  * @param   settleTolerance     the tolerance range for the PID to be considered settled, in inches
  * @param   settleTime          the amount of time the error must be within the settleTolerance before it is truly settled, in seconds
@@ -263,19 +642,21 @@ float chassis::driveFor(float distance, float timeout, float heading)
  */
 float chassis::driveFor(float distance, float timeout, float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput)
 {
-    return this->driveFor(distance, timeout, 0, Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput, 0);
+    return this->driveMotion(distance, timeout, 0, PIDConstants(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput), 0);
 }
 
 /**
  * Drives for a distance using a PID with a timeout
  * This will hold a heading as it drives
+ * If a drive profile is set the PID corrects around the profile's setpoints and feedforward,
+ * and the drive cannot settle before the profile ends
  * 
  * @param   distance            the distance to be driven, in inches
  * @param   timeout             the time before the drive gives up, in seconds
  * @param   heading             the desired heading for the robot to hold
  * @param   Kp                  the proportional constant
- * @param   Ki                  the integral constant
- * @param   Kd                  the derivative constant
+ * @param   Ki                  the integral constant, per second
+ * @param   Kd                  the derivative constant, per second
  * @param   integralTolerance   the tolerance range for the integral to grow, in inches
  * @param   settleTolerance     the tolerance range for the PID to be considered settled, in inches
  * @param   settleTime          the amount of time the error must be within the settleTolerance before it is truly settled, in seconds
@@ -285,37 +666,7 @@ float chassis::driveFor(float distance, float timeout, float Kp, float Ki, float
  */
 float chassis::driveFor(float distance, float timeout, float heading, float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput, float headingKp)
 {
-    PID drivePID = PID(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput, 10);
-    PID turnPID = PID(headingKp, 0, 0, 0, 0, 0, minOutput, maxOutput, 10);
-
-    float initialPosition;
-    if(this->trackingType == chassis::verticalTracking::rotation) initialPosition = this->VerticalRotation->position(vex::rotationUnits::deg) * this->degreesToInches;
-    else if(this->trackingType == chassis::verticalTracking::encoder) initialPosition = this->VerticalEncoder->position(vex::rotationUnits::deg) * this->degreesToInches;
-    else initialPosition = this->Left->position(vex::rotationUnits::deg) * this->degreesToInches;
-
-    float t = 0;
-    while(!drivePID.isSettled() && t < timeout){
-        float currentPosition;
-        if(this->trackingType == chassis::verticalTracking::rotation) currentPosition = this->VerticalRotation->position(vex::rotationUnits::deg) * this->degreesToInches;
-        else if(this->trackingType == chassis::verticalTracking::encoder) currentPosition = this->VerticalEncoder->position(vex::rotationUnits::deg) * this->degreesToInches;
-        else currentPosition = this->Left->position(vex::rotationUnits::deg) * this->degreesToInches;
-
-        float driveError = distance - (currentPosition - initialPosition);
-        float headingError = this->restrain(this->Inertial->heading(vex::rotationUnits::deg) - heading, -180, 180);
-
-        float driveOutput = drivePID.getOutput(driveError);
-        float turnOutput = turnPID.getOutput(headingError);
-
-        this->Left->spin(vex::directionType::fwd, this->clamp(driveOutput + turnOutput, minOutput, maxOutput), vex::voltageUnits::volt);
-        this->Right->spin(vex::directionType::fwd, this->clamp(driveOutput - turnOutput, minOutput, maxOutput), vex::voltageUnits::volt);
-
-        vex::task::sleep(10);
-        t += 0.01;
-    }
-
-    this->stopDrive(vex::brakeType::hold);
-
-    return t;
+    return this->driveMotion(distance, timeout, heading, PIDConstants(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput), headingKp);
 }
 
 /**
@@ -354,87 +705,264 @@ void chassis::stopDrive(vex::brakeType stopType)
 }
 
 /**
- * Drives to a position on the field using a turn PID and a drive PID, without timeouts
+ * Drives to a position on the field, turning and driving at the same time, without a timeout
  * Requires odometry to be active
  * 
  * @param   x   the desired x coordinate, in inches
  * @param   y   the desired y coordinate, in inches
  * 
- * @return  the total time it takes to reach (x, y)
+ * @return  the time it takes to reach (x, y)
  */
 float chassis::driveTo(float x, float y)
 {
-    float timeTurning = turnToPosition(x, y);
-
-    std::vector<float> robotPosition;
-    float distance = hypotf(robotPosition.at(0) - x, robotPosition.at(1) - y);
-    float timeDriving = driveFor(distance, INFINITY, this->Inertial->heading(vex::rotationUnits::deg));
-
-    return timeTurning + timeDriving;
+    return this->moveTo(x, y, 0, false, false, INFINITY, 0, 0);
 }
 
 /**
- * Drives to a position on the field using a turn PID and a drive PID, with timeouts
+ * Drives to a position on the field, turning and driving at the same time, with a timeout
  * Requires odometry to be active
+ * The turn and drive are one motion now, so it gives up after both timeouts added together
  * 
  * @param   x               the desired x coordinate, in inches
  * @param   y               the desired y coordinate, in inches
- * @param   driveTimeout    the amount of time before the drive PID gives up, in seconds
- * @param   turnTimeout     the amount of time before the turn PID gives up, in seconds
+ * @param   driveTimeout    the amount of time the drive may take, in seconds
+ * @param   turnTimeout     the amount of time the turn may take, in seconds
  * 
- * @return  the total time it takes to reach (x, y)
+ * @return  the time it takes to reach (x, y) or time out
  */
 float chassis::driveTo(float x, float y, float driveTimeout, float turnTimeout)
 {
-    float timeTurning = turnToPosition(x, y, turnTimeout);
-
-    std::vector<float> robotPosition;
-    float distance = hypotf(robotPosition.at(0) - x, robotPosition.at(1) - y);
-    float timeDriving = driveFor(distance, driveTimeout, this->Inertial->heading(vex::rotationUnits::deg));
-
-    return timeTurning + timeDriving;
+    return this->moveTo(x, y, 0, false, false, driveTimeout + turnTimeout, 0, 0);
 }
 
 /**
- * Drives backwards to a position on the field using a turn PID and a drive PID, without timeouts
+ * Drives backwards to a position on the field, turning and driving at the same time, without a timeout
  * Requires odometry to be active
  * 
  * @param   x   the desired x coordinate, in inches
  * @param   y   the desired y coordinate, in inches
  * 
- * @return  the total time it takes to reach (x, y)
+ * @return  the time it takes to reach (x, y)
  */
 float chassis::driveToReverse(float x, float y)
 {
-    float timeTurning = turnToPositionReverse(x, y);
-
-    std::vector<float> robotPosition;
-    float distance = -hypotf(robotPosition.at(0) - x, robotPosition.at(1) - y);
-    float timeDriving = driveFor(distance, INFINITY, this->Inertial->heading(vex::rotationUnits::deg));
-
-    return timeTurning + timeDriving;
+    return this->moveTo(x, y, 0, false, true, INFINITY, 0, 0);
 }
 
 /**
- * Drives backwards to a position on the field using a turn PID and a drive PID, with timeouts
+ * Drives backwards to a position on the field, turning and driving at the same time, with a timeout
  * Requires odometry to be active
+ * The turn and drive are one motion now, so it gives up after both timeouts added together
  * 
  * @param   x               the desired x coordinate, in inches
  * @param   y               the desired y coordinate, in inches
- * @param   driveTimeout    the amount of time before the drive PID gives up, in seconds
- * @param   turnTimeout     the amount of time before the turn PID gives up, in seconds
+ * @param   driveTimeout    the amount of time the drive may take, in seconds
+ * @param   turnTimeout     the amount of time the turn may take, in seconds
  * 
- * @return  the total time it takes to reach (x, y)
+ * @return  the time it takes to reach (x, y) or time out
  */
 float chassis::driveToReverse(float x, float y, float driveTimeout, float turnTimeout)
 {
-    float timeTurning = turnToPositionReverse(x, y, turnTimeout);
+    return this->moveTo(x, y, 0, false, true, driveTimeout + turnTimeout, 0, 0);
+}
+
+/**
+ * Drives to a pose on the field using the pose constants and no timeout
+ * Requires odometry to be active
+ * 
+ * @param   x       the desired x coordinate, in inches
+ * @param   y       the desired y coordinate, in inches
+ * @param   heading the heading to arrive at, in degrees
+ * 
+ * @return  the time it takes to reach the pose
+ */
+float chassis::driveToPose(float x, float y, float heading)
+{
+    return this->moveTo(x, y, heading, true, false, INFINITY, this->poseConstants.lead, 0);
+}
+
+/**
+ * Drives to a pose on the field using the pose constants and a timeout
+ * Requires odometry to be active
+ * 
+ * @param   x       the desired x coordinate, in inches
+ * @param   y       the desired y coordinate, in inches
+ * @param   heading the heading to arrive at, in degrees
+ * @param   timeout the time before the motion gives up, in seconds
+ * 
+ * @return  the time it takes to reach the pose or time out
+ */
+float chassis::driveToPose(float x, float y, float heading, float timeout)
+{
+    return this->moveTo(x, y, heading, true, false, timeout, this->poseConstants.lead, 0);
+}
+
+/**
+ * Drives to a pose on the field
+ * Requires odometry to be active
+ * 
+ * @param   x           the desired x coordinate, in inches
+ * @param   y           the desired y coordinate, in inches
+ * @param   heading     the heading to arrive at, in degrees
+ * @param   timeout     the time before the motion gives up, in seconds
+ * @param   lead        how far the carrot point is pulled back from the target, as a fraction of the distance left
+ * @param   exitSpeed   0 to stop at the pose, otherwise the least forward output, in volts, and the
+ *                      motion ends without braking as the robot crosses the target
+ * 
+ * @return  the time it takes to reach the pose or time out
+ */
+float chassis::driveToPose(float x, float y, float heading, float timeout, float lead, float exitSpeed)
+{
+    return this->moveTo(x, y, heading, true, false, timeout, lead, exitSpeed);
+}
 
-    std::vector<float> robotPosition;
-    float distance = -hypotf(robotPosition.at(0) - x, robotPosition.at(1) - y);
-    float timeDriving = driveFor(distance, driveTimeout, this->Inertial->heading(vex::rotationUnits::deg));
+/**
+ * Drives backwards to a pose on the field using the pose constants and no timeout
+ * Requires odometry to be active
+ * 
+ * @param   x       the desired x coordinate, in inches
+ * @param   y       the desired y coordinate, in inches
+ * @param   heading the heading to arrive at, in degrees
+ * 
+ * @return  the time it takes to reach the pose
+ */
+float chassis::driveToPoseReverse(float x, float y, float heading)
+{
+    return this->moveTo(x, y, heading, true, true, INFINITY, this->poseConstants.lead, 0);
+}
+
+/**
+ * Drives backwards to a pose on the field using the pose constants and a timeout
+ * Requires odometry to be active
+ * 
+ * @param   x       the desired x coordinate, in inches
+ * @param   y       the desired y coordinate, in inches
+ * @param   heading the heading to arrive at, in degrees
+ * @param   timeout the time before the motion gives up, in seconds
+ * 
+ * @return  the time it takes to reach the pose or time out
+ */
+float chassis::driveToPoseReverse(float x, float y, float heading, float timeout)
+{
+    return this->moveTo(x, y, heading, true, true, timeout, this->poseConstants.lead, 0);
+}
 
-    return timeTurning + timeDriving;
+/**
+ * Drives backwards to a pose on the field
+ * Requires odometry to be active
+ * 
+ * @param   x           the desired x coordinate, in inches
+ * @param   y           the desired y coordinate, in inches
+ * @param   heading     the heading to arrive at, in degrees
+ * @param   timeout     the time before the motion gives up, in seconds
+ * @param   lead        how far the carrot point is pulled back from the target, as a fraction of the distance left
+ * @param   exitSpeed   0 to stop at the pose, otherwise the least backward output, in volts, and the
+ *                      motion ends without braking as the robot crosses the target
+ * 
+ * @return  the time it takes to reach the pose or time out
+ */
+float chassis::driveToPoseReverse(float x, float y, float heading, float timeout, float lead, float exitSpeed)
+{
+    return this->moveTo(x, y, heading, true, true, timeout, lead, exitSpeed);
+}
+
+/**
+ * Private function that drives to a point or a pose, steering and driving at the same time
+ * Every tick it reads odom and aims at a carrot point: the target pulled back along the
+ * target heading by lead times the distance left, so the robot curves in and arrives
+ * facing the heading (boomerang). The drive PID works on the distance to the carrot along
+ * the robot's heading, the turn PID on the angle to it. Within closeDistance of the target
+ * it stops aiming, which would spin the robot around the point, and the turn PID holds the
+ * target heading instead, or nothing for a plain point.
+ * 
+ * @param   x           the desired x coordinate, in inches
+ * @param   y           the desired y coordinate, in inches
+ * @param   heading     the heading to arrive at, in degrees
+ * @param   useHeading  false to drive to the point and arrive at any heading
+ * @param   reverse     true to drive backwards
+ * @param   timeout     the time before the motion gives up, in seconds
+ * @param   lead        the carrot's distance from the target as a fraction of the distance left, from 0 to 1
+ * @param   exitSpeed   0 to settle at the target, otherwise the least drive output, in volts,
+ *                      and the motion ends without braking as the robot crosses the target
+ * 
+ * @return  the time it takes to reach the target or time out
+ */
+float chassis::moveTo(float x, float y, float heading, bool useHeading, bool reverse, float timeout, float lead, float exitSpeed)
+{
+    PID drivePID = PID(this->driveConstants.Kp, this->driveConstants.Ki, this->driveConstants.Kd, this->driveConstants.integralTolerance, this->driveConstants.settleTolerance, this->driveConstants.settleTime, this->driveConstants.minOutput, this->driveConstants.maxOutput, this->loopPeriod);
+    PID turnPID = PID(this->turnConstants.Kp, this->turnConstants.Ki, this->turnConstants.Kd, this->turnConstants.integralTolerance, this->turnConstants.settleTolerance, this->turnConstants.settleTime, this->turnConstants.minOutput, this->turnConstants.maxOutput, this->loopPeriod);
+    float maxOutput = this->driveConstants.maxOutput;
+
+    // an exit speed chains this motion on its own, exiting as the robot crosses the target
+    Chain chain = this->takeChain();
+    if(exitSpeed > 0){
+        chain.active = true;
+        chain.exitDistance = this->driveConstants.settleTolerance;
+        chain.minSpeed = exitSpeed;
+    }
+
+    // the direction the robot travels when it arrives, backwards from its heading in reverse
+    float travel = (useHeading ? heading : 0) + (reverse ? 180 : 0);
+    float travelX = sinf(travel * M_PI / 180);
+    float travelY = cosf(travel * M_PI / 180);
+    if(!useHeading){
+        Pose start = this->Odom->getPose();
+        float angle = atan2f(x - start.x, y - start.y);
+        travelX = sinf(angle);
+        travelY = cosf(angle);
+    }
+
+    bool close = false;
+    LoopTimer loop(this->loopPeriod);
+    while(loop.getElapsed() < timeout && !this->isCancelled()){
+        Pose pose = this->Odom->getPose();
+        this->trackSpeed(this->Sensors->getFrame());
+        float distance = hypotf(x - pose.x, y - pose.y);
+        if(distance < this->poseConstants.closeDistance) close = true;
+
+        // once past the line through the target, square to the travel direction, a chained motion is done
+        float remaining = (x - pose.x) * travelX + (y - pose.y) * travelY;
+        if(chain.active && remaining < chain.exitDistance) break;
+        if(!chain.active && drivePID.isSettled() && (!useHeading || turnPID.isSettled())) break;
+
+        float carrotX = x;
+        float carrotY = y;
+        if(useHeading && !close){
+            carrotX -= lead * distance * travelX;
+            carrotY -= lead * distance * travelY;
+        }
+
+        float facing = pose.heading + (reverse ? 180 : 0);
+        float angleError = 0;
+        if(!close) angleError = this->restrain(this->radToDeg(atan2f(carrotX - pose.x, carrotY - pose.y)) - facing, -180, 180);
+        else if(useHeading) angleError = this->restrain(heading - pose.heading, -180, 180);
+
+        // distance along the way the robot faces, so it slows down while it is pointed away
+        float driveError = hypotf(carrotX - pose.x, carrotY - pose.y);
+        if(close) driveError = (x - pose.x) * sinf(facing * M_PI / 180) + (y - pose.y) * cosf(facing * M_PI / 180);
+        else driveError *= cosf(angleError * M_PI / 180);
+        if(reverse) driveError = -driveError;
+
+        float driveOutput = drivePID.getOutputDt(driveError, loop.getDt());
+        float turnOutput = turnPID.getOutputDt(angleError, loop.getDt());
+
+        driveOutput = this->carry(driveOutput, reverse ? -1 : 1, chain);
+
+        // turning comes first, the drive gets what is left
+        float driveRoom = maxOutput - fabsf(turnOutput);
+        if(driveRoom < 0) driveRoom = 0;
+        driveOutput = this->clamp(driveOutput, -driveRoom, driveRoom);
+
+        this->Left->spin(vex::directionType::fwd, driveOutput + turnOutput, vex::voltageUnits::volt);
+        this->Right->spin(vex::directionType::fwd, driveOutput - turnOutput, vex::voltageUnits::volt);
+        if(this->telemetry) this->telemetry->push(TelemetryChannel::path, pose.x, pose.y, pose.heading, driveOutput + turnOutput, driveOutput - turnOutput);
+
+        loop.wait();
+    }
+
+    this->endMotion(chain, loop);
+
+    return loop.getElapsed();
 }
 
 /**
@@ -446,7 +974,7 @@ float chassis::driveToReverse(float x, float y, float driveTimeout, float turnTi
  */
 float chassis::turnFor(float degrees)
 {
-    return this->turnFor(degrees, INFINITY, this->turnConstants.Kp, this->turnConstants.Ki, this->turnConstants.Kd, this->turnConstants.integralTolerance, this->turnConstants.settleTolerance, this->turnConstants.settleTime, this->turnConstants.minOutput, this->turnConstants.maxOutput);
+    return this->turnMotion(degrees, false, INFINITY, this->turnConstants);
 }
 
 /**
@@ -459,17 +987,19 @@ float chassis::turnFor(float degrees)
  */
 float chassis::turnFor(float degrees, float timeout)
 {
-    return this->turnFor(degrees, timeout, this->turnConstants.Kp, this->turnConstants.Ki, this->turnConstants.Kd, this->turnConstants.integralTolerance, this->turnConstants.settleTolerance, this->turnConstants.settleTime, this->turnConstants.minOutput, this->turnConstants.maxOutput);
+    return this->turnMotion(degrees, false, timeout, this->turnConstants);
 }
 
 /**
  * Turns for a specified number of degrees using a PID with a timeout
+ * If a turn profile is set the PID corrects around the profile's setpoints and feedforward,
+ * and the turn cannot settle before the profile ends
  * 
  * @param   degrees             the number of degrees to be turned
  * @param   timeout             the time before the PID gives up, in seconds
  * @param   Kp                  the proportional constant
- * @param   Ki                  the integral constant
- * @param   Kd                  the derivative constant
+ * @param   Ki                  the integral constant, per second
+ * @param   Kd                  the derivative constant, per second
  * @param   integralTolerance   the tolerance range for the integral to grow, in degrees
  * @param   settleTolerance     the tolerance range for the PID to be considered settled, in degrees
  * @param   settleTime          the amount of time the error must be within the settleTolerance before it is truly settled, in seconds
@@ -480,24 +1010,7 @@ float chassis::turnFor(float degrees, float timeout)
  */
 float chassis::turnFor(float degrees, float timeout, float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput)
 {
-    PID turnPID = PID(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput, 10);
-    float targetRotation = this->Inertial->rotation(vex::rotationUnits::deg) + degrees;
-
-    float t = 0;
-    while(!turnPID.isSettled() && t < timeout){
-        float error = targetRotation - this->Inertial->rotation(vex::rotationUnits::deg);
-        float output = turnPID.getOutput(error);
-
-        this->Left->spin(vex::directionType::fwd, output, vex::voltageUnits::volt);
-        this->Right->spin(vex::directionType::rev, output, vex::voltageUnits::volt);
-
-        vex::task::sleep(10);
-        t += 0.01;
-    }
-
-    this->stopDrive(vex::brakeType::hold);
-
-    return t;
+    return this->turnMotion(degrees, false, timeout, PIDConstants(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput));
 }
 
 /**
@@ -509,7 +1022,7 @@ float chassis::turnFor(float degrees, float timeout, float Kp, float Ki, float K
  */
 float chassis::turnTo(float heading)
 {
-    return turnTo(heading, INFINITY, this->turnConstants.Kp, this->turnConstants.Ki, this->turnConstants.Kd, this->turnConstants.integralTolerance, this->turnConstants.settleTolerance, this->turnConstants.settleTime, this->turnConstants.minOutput, this->turnConstants.maxOutput);
+    return this->turnMotion(heading, true, INFINITY, this->turnConstants);
 }
 
 /**
@@ -522,17 +1035,19 @@ float chassis::turnTo(float heading)
  */
 float chassis::turnTo(float heading, float timeout)
 {
-    return turnTo(heading, timeout, this->turnConstants.Kp, this->turnConstants.Ki, this->turnConstants.Kd, this->turnConstants.integralTolerance, this->turnConstants.settleTolerance, this->turnConstants.settleTime, this->turnConstants.minOutput, this->turnConstants.maxOutput);
+    return this->turnMotion(heading, true, timeout, this->turnConstants);
 }
 
 /**
  * Turns to a specified heading using a PID and a timeout
+ * If a turn profile is set the PID corrects around the profile's setpoints and feedforward,
+ * and the turn cannot settle before the profile ends
  * 
  * @param   heading             the desired heading, in degrees
  * @param   timeout             the time before the PID gives up, in seconds
  * @param   Kp                  the proportional constant
- * @param   Ki                  the integral constant
- * @param   Kd                  the derivative constant
+ * @param   Ki                  the integral constant, per second
+ * @param   Kd                  the derivative constant, per second
  * @param   integralTolerance   the tolerance range for the integral to grow, in degrees
  * @param   settleTolerance     the tolerance range for the PID to be considered settled, in degrees
  * @param   settleTime          the amount of time the error must be within the settleTolerance before it is truly settled, in seconds
@@ -543,23 +1058,7 @@ float chassis::turnTo(float heading, float timeout)
  */
 float chassis::turnTo(float heading, float timeout, float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput)
 {
-    PID turnPID = PID(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput, 10);
-
-    float t = 0;
-    while(!turnPID.isSettled() && t < timeout){
-        float error = this->restrain(heading - this->Inertial->heading(vex::rotationUnits::deg), -180, 180);
-        float output = turnPID.getOutput(error);
-
-        this->Left->spin(vex::directionType::fwd, output, vex::voltageUnits::volt);
-        this->Right->spin(vex::directionType::rev, output, vex::voltageUnits::volt);
-
-        vex::task::sleep(10);
-        t += 0.01;
-    }
-
-    this->stopDrive(vex::brakeType::hold);
-
-    return t;
+    return this->turnMotion(heading, true, timeout, PIDConstants(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput));
 }
 
 /**
@@ -572,10 +1071,10 @@ float chassis::turnTo(float heading, float timeout, float Kp, float Ki, float Kd
  */
 float chassis::turnToPosition(float x, float y)
 {
-    std::vector<float> robotPosition = this->getRobotPosition();
-    float targetHeading = this->radToDeg(atan2f(robotPosition.at(0) - x, robotPosition.at(1) - y));
+    Pose robotPose = this->Odom->getPose();
+    float targetHeading = this->radToDeg(atan2f(x - robotPose.x, y - robotPose.y));
 
-    return turnTo(targetHeading, INFINITY, this->turnConstants.Kp, this->turnConstants.Ki, this->turnConstants.Kd, this->turnConstants.integralTolerance, this->turnConstants.settleTolerance, this->turnConstants.settleTime, this->turnConstants.minOutput, this->turnConstants.maxOutput);
+    return this->turnMotion(targetHeading, true, INFINITY, this->turnConstants);
 }
 
 /**
@@ -589,10 +1088,10 @@ float chassis::turnToPosition(float x, float y)
  */
 float chassis::turnToPosition(float x, float y, float timeout)
 {
-    std::vector<float> robotPosition = this->getRobotPosition();
-    float targetHeading = this->radToDeg(atan2f(robotPosition.at(0) - x, robotPosition.at(1) - y));
+    Pose robotPose = this->Odom->getPose();
+    float targetHeading = this->radToDeg(atan2f(x - robotPose.x, y - robotPose.y));
 
-    return turnTo(targetHeading, timeout, this->turnConstants.Kp, this->turnConstants.Ki, this->turnConstants.Kd, this->turnConstants.integralTolerance, this->turnConstants.settleTolerance, this->turnConstants.settleTime, this->turnConstants.minOutput, this->turnConstants.maxOutput);
+    return this->turnMotion(targetHeading, true, timeout, this->turnConstants);
 }
 
 /**
@@ -602,8 +1101,8 @@ float chassis::turnToPosition(float x, float y, float timeout)
  * @param   y                   the y coordinate, in inches
  * @param   timeout             the time before the PID gives up, in seconds
  * @param   Kp                  the proportional constant
- * @param   Ki                  the integral constant
- * @param   Kd                  the derivative constant
+ * @param   Ki                  the integral constant, per second
+ * @param   Kd                  the derivative constant, per second
  * @param   integralTolerance   the tolerance range for the integral to grow, in degrees
  * @param   settleTolerance     the tolerance range for the PID to be considered settled, in degrees
  * @param   settleTime          the amount of time the error must be within the settleTolerance before it is truly settled, in seconds
@@ -614,8 +1113,8 @@ float chassis::turnToPosition(float x, float y, float timeout)
  */
 float chassis::turnToPosition(float x, float y, float timeout, float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput)
 {
-    std::vector<float> robotPosition = this->getRobotPosition();
-    float targetHeading = this->radToDeg(atan2f(robotPosition.at(0) - x, robotPosition.at(1) - y));
+    Pose robotPose = this->Odom->getPose();
+    float targetHeading = this->radToDeg(atan2f(x - robotPose.x, y - robotPose.y));
 
     return turnTo(targetHeading, timeout, Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput);
 }
@@ -630,10 +1129,10 @@ float chassis::turnToPosition(float x, float y, float timeout, float Kp, float K
  */
 float chassis::turnToPositionReverse(float x, float y)
 {
-    std::vector<float> robotPosition = this->getRobotPosition();
-    float targetHeading = this->radToDeg(atan2f(robotPosition.at(0) - x, robotPosition.at(1) - y)) + 180;
+    Pose robotPose = this->Odom->getPose();
+    float targetHeading = this->radToDeg(atan2f(x - robotPose.x, y - robotPose.y)) + 180;
 
-    return turnTo(targetHeading, INFINITY, this->turnConstants.Kp, this->turnConstants.Ki, this->turnConstants.Kd, this->turnConstants.integralTolerance, this->turnConstants.settleTolerance, this->turnConstants.settleTime, this->turnConstants.minOutput, this->turnConstants.maxOutput);
+    return this->turnMotion(targetHeading, true, INFINITY, this->turnConstants);
 }
 
 /**
@@ -647,10 +1146,10 @@ float chassis::turnToPositionReverse(float x, float y)
  */
 float chassis::turnToPositionReverse(float x, float y, float timeout)
 {
-    std::vector<float> robotPosition = this->getRobotPosition();
-    float targetHeading = this->radToDeg(atan2f(robotPosition.at(0) - x, robotPosition.at(1) - y)) + 180;
+    Pose robotPose = this->Odom->getPose();
+    float targetHeading = this->radToDeg(atan2f(x - robotPose.x, y - robotPose.y)) + 180;
 
-    return turnTo(targetHeading, timeout, this->turnConstants.Kp, this->turnConstants.Ki, this->turnConstants.Kd, this->turnConstants.integralTolerance, this->turnConstants.settleTolerance, this->turnConstants.settleTime, this->turnConstants.minOutput, this->turnConstants.maxOutput);
+    return this->turnMotion(targetHeading, true, timeout, this->turnConstants);
 }
 
 /**
@@ -688,7 +1187,7 @@ void chassis::setTurnSpeed(float speed, vex::voltageUnits unit)
  */
 float chassis::swingFor(vex::turnType direction, float degrees)
 {
-    return this->swingFor(direction, degrees, INFINITY, this->swingConstants.Kp, this->swingConstants.Ki, this->swingConstants.Kd, this->swingConstants.integralTolerance, this->swingConstants.settleTolerance, this->swingConstants.settleTime, this->swingConstants.minOutput, this->swingConstants.maxOutput);
+    return this->swingMotion(direction, degrees, false, INFINITY, this->swingConstants);
 }
 
 /**
@@ -703,7 +1202,7 @@ float chassis::swingFor(vex::turnType direction, float degrees)
  */
 float chassis::swingFor(vex::turnType direction, float degrees, float timeout)
 {
-    return this->swingFor(direction, degrees, timeout, this->swingConstants.Kp, this->swingConstants.Ki, this->swingConstants.Kd, this->swingConstants.integralTolerance, this->swingConstants.settleTolerance, this->swingConstants.settleTime, this->swingConstants.minOutput, this->swingConstants.maxOutput);
+    return this->swingMotion(direction, degrees, false, timeout, this->swingConstants);
 }
 
 /**
@@ -714,8 +1213,8 @@ float chassis::swingFor(vex::turnType direction, float degrees, float timeout)
  * @param   degrees             the desired number of degrees
  * @param   timeout             the time before the PID gives up, in seconds
  * @param   Kp                  the proportional constant
- * @param   Ki                  the integral constant
- * @param   Kd                  the derivative constant
+ * @param   Ki                  the integral constant, per second
+ * @param   Kd                  the derivative constant, per second
  * @param   integralTolerance   the tolerance range for the integral to grow, in degrees
  * @param   settleTolerance     the tolerance range for the PID to be considered settled, in degrees
  * @param   settleTime          the amount of time the error must be within the settleTolerance before it is truly settled, in seconds
@@ -726,41 +1225,7 @@ float chassis::swingFor(vex::turnType direction, float degrees, float timeout)
  */
 float chassis::swingFor(vex::turnType direction, float degrees, float timeout, float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput)
 {
-    PID swingPID = PID(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput, 10);
-
-    float t = 0;
-    if(direction == vex::turnType::right){
-        float targetRotation = this->Inertial->rotation(vex::rotationUnits::deg) + degrees;
-        
-        this->Right->stop(vex::brakeType::hold);
-        while(!swingPID.isSettled() && t < timeout){
-            float error = targetRotation - this->Inertial->rotation(vex::rotationUnits::deg);
-            float output = swingPID.getOutput(error);
-
-            this->Left->spin(vex::directionType::fwd, output, vex::voltageUnits::volt);
-
-            vex::task::sleep(10);
-            t += 0.01;
-        }
-    }
-    else{
-        float targetRotation = this->Inertial->rotation(vex::rotationUnits::deg) - degrees;
-
-        this->Left->stop(vex::brakeType::hold);
-        while(!swingPID.isSettled() && t < timeout){
-            float error = this->Inertial->rotation(vex::rotationUnits::deg) - targetRotation;
-            float output = swingPID.getOutput(error);
-
-            this->Right->spin(vex::directionType::fwd, output, vex::voltageUnits::volt);
-
-            vex::task::sleep(10);
-            t += 0.01;
-        }
-    }
-
-    this->stopDrive(vex::brakeType::hold);
-
-    return t;
+    return this->swingMotion(direction, degrees, false, timeout, PIDConstants(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput));
 }
 
 /**
@@ -774,7 +1239,7 @@ float chassis::swingFor(vex::turnType direction, float degrees, float timeout, f
  */
 float chassis::swingTo(vex::turnType direction, float heading)
 {
-    return this->swingTo(direction, heading, INFINITY, this->swingConstants.Kp, this->swingConstants.Ki, this->swingConstants.Kd, this->swingConstants.integralTolerance, this->swingConstants.settleTolerance, this->swingConstants.settleTime, this->swingConstants.minOutput, this->swingConstants.maxOutput);
+    return this->swingMotion(direction, heading, true, INFINITY, this->swingConstants);
 }
 
 /**
@@ -789,7 +1254,7 @@ float chassis::swingTo(vex::turnType direction, float heading)
  */
 float chassis::swingTo(vex::turnType direction, float heading, float timeout)
 {
-    return this->swingTo(direction, heading, timeout, this->swingConstants.Kp, this->swingConstants.Ki, this->swingConstants.Kd, this->swingConstants.integralTolerance, this->swingConstants.settleTolerance, this->swingConstants.settleTime, this->swingConstants.minOutput, this->swingConstants.maxOutput);
+    return this->swingMotion(direction, heading, true, timeout, this->swingConstants);
 }
 
 /**
@@ -800,8 +1265,8 @@ float chassis::swingTo(vex::turnType direction, float heading, float timeout)
  * @param   heading             the desired heading, in degrees
  * @param   timeout             the time before the PID gives up, in seconds
  * @param   Kp                  the proportional constant
- * @param   Ki                  the integral constant
- * @param   Kd                  the derivative constant
+ * @param   Ki                  the integral constant, per second
+ * @param   Kd                  the derivative constant, per second
  * @param   integralTolerance   the tolerance range for the integral to grow, in degrees
  * @param   settleTolerance     the tolerance range for the PID to be considered settled, in degrees
  * @param   settleTime          the amount of time the error must be within the settleTolerance before it is truly settled, in seconds
@@ -812,37 +1277,7 @@ float chassis::swingTo(vex::turnType direction, float heading, float timeout)
  */
 float chassis::swingTo(vex::turnType direction, float heading, float timeout, float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput)
 {
-    PID swingPID = PID(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput, 10);
-
-    float t = 0;
-    if(direction == vex::turnType::right){        
-        this->Right->stop(vex::brakeType::hold);
-        while(!swingPID.isSettled() && t < timeout){
-            float error = this->restrain(heading - this->Inertial->heading(vex::rotationUnits::deg), -180, 180);
-            float output = swingPID.getOutput(error);
-
-            this->Left->spin(vex::directionType::fwd, output, vex::voltageUnits::volt);
-
-            vex::task::sleep(10);
-            t += 0.01;
-        }
-    }
-    else{
-        this->Left->stop(vex::brakeType::hold);
-        while(!swingPID.isSettled() && t < timeout){
-            float error = this->restrain(this->Inertial->heading(vex::rotationUnits::deg) - heading, -180, 180);
-            float output = swingPID.getOutput(error);
-
-            this->Right->spin(vex::directionType::fwd, output, vex::voltageUnits::volt);
-
-            vex::task::sleep(10);
-            t += 0.01;
-        }
-    }
-
-    this->stopDrive(vex::brakeType::hold);
-
-    return t;
+    return this->swingMotion(direction, heading, true, timeout, PIDConstants(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput));
 }
 
 /**
@@ -894,7 +1329,7 @@ void chassis::setSwingSpeed(vex::turnType direction, float speed, vex::voltageUn
  */
 float chassis::arcFor(vex::turnType direction, float radius, float degrees)
 {
-    return this->arcFor(direction, radius, degrees, INFINITY, this->arcConstants.Kp, this->arcConstants.Ki, this->arcConstants.Kd, this->arcConstants.integralTolerance, this->arcConstants.settleTolerance, this->arcConstants.settleTime, this->arcConstants.minOutput, this->arcConstants.maxOutput);
+    return this->arcMotion(direction, radius, degrees, false, INFINITY, this->arcConstants);
 }
 
 /**
@@ -909,7 +1344,7 @@ float chassis::arcFor(vex::turnType direction, float radius, float degrees)
  */
 float chassis::arcFor(vex::turnType direction, float radius, float degrees, float timeout)
 {
-    return this->arcFor(direction, radius, degrees, timeout, this->arcConstants.Kp, this->arcConstants.Ki, this->arcConstants.Kd, this->arcConstants.integralTolerance, this->arcConstants.settleTolerance, this->arcConstants.settleTime, this->arcConstants.minOutput, this->arcConstants.maxOutput);
+    return this->arcMotion(direction, radius, degrees, false, timeout, this->arcConstants);
 }
 
 /**
@@ -920,8 +1355,8 @@ float chassis::arcFor(vex::turnType direction, float radius, float degrees, floa
  * @param   degrees             the number of degrees
  * @param   timeout             the time before the PID gives up, in seconds
  * @param   Kp                  the proportional constant
- * @param   Ki                  the integral constant
- * @param   Kd                  the derivative constant
+ * @param   Ki                  the integral constant, per second
+ * @param   Kd                  the derivative constant, per second
  * @param   integralTolerance   the tolerance range for the integral to grow, in degrees
  * @param   settleTolerance     the tolerance range for the PID to be considered settled, in degrees
  * @param   settleTime          the amount of time the error must be within the settleTolerance before it is truly settled, in seconds
@@ -932,42 +1367,7 @@ float chassis::arcFor(vex::turnType direction, float radius, float degrees, floa
  */
 float chassis::arcFor(vex::turnType direction, float radius, float degrees, float timeout, float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput)
 {
-    PID arcPID = PID(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput, 10);
-    float multiplier = (radius - trackWidth/2) / (radius + trackWidth/2);
-
-    float t = 0;
-    if(direction == vex::turnType::right){
-        float targetRotation = this->Inertial->rotation(vex::rotationUnits::deg) + degrees;
-
-        while(!arcPID.isSettled() && t < timeout){
-            float error = targetRotation - this->Inertial->rotation(vex::rotationUnits::deg);
-            float output = arcPID.getOutput(error);
-
-            this->Left->spin(vex::directionType::fwd, output, vex::voltageUnits::volt);
-            this->Right->spin(vex::directionType::fwd, multiplier * output, vex::voltageUnits::volt);
-
-            vex::task::sleep(10);
-            t += 0.01;
-        }
-    }
-    else{
-        float targetRotation = this->Inertial->rotation(vex::rotationUnits::deg) - degrees;
-
-        while(!arcPID.isSettled() && t < timeout){
-            float error = this->Inertial->rotation(vex::rotationUnits::deg) - targetRotation;
-            float output = arcPID.getOutput(error);
-
-            this->Left->spin(vex::directionType::fwd, multiplier * output, vex::voltageUnits::volt);
-            this->Right->spin(vex::directionType::fwd, output, vex::voltageUnits::volt);
-
-            vex::task::sleep(10);
-            t += 0.01;
-        }
-    }
-
-    this->stopDrive(vex::brakeType::hold);
-
-    return t;
+    return this->arcMotion(direction, radius, degrees, false, timeout, PIDConstants(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput));
 }
 
 /**
@@ -981,7 +1381,7 @@ float chassis::arcFor(vex::turnType direction, float radius, float degrees, floa
  */
 float chassis::arcTo(vex::turnType direction, float radius, float heading)
 {
-    return this->arcTo(direction, radius, heading, INFINITY, this->arcConstants.Kp, this->arcConstants.Ki, this->arcConstants.Kd, this->arcConstants.integralTolerance, this->arcConstants.settleTolerance, this->arcConstants.settleTime, this->arcConstants.minOutput, this->arcConstants.maxOutput);
+    return this->arcMotion(direction, radius, heading, true, INFINITY, this->arcConstants);
 }
 
 /**
@@ -996,7 +1396,7 @@ float chassis::arcTo(vex::turnType direction, float radius, float heading)
  */
 float chassis::arcTo(vex::turnType direction, float radius, float heading, float timeout)
 {
-    return this->arcTo(direction, radius, heading, timeout, this->arcConstants.Kp, this->arcConstants.Ki, this->arcConstants.Kd, this->arcConstants.integralTolerance, this->arcConstants.settleTolerance, this->arcConstants.settleTime, this->arcConstants.minOutput, this->arcConstants.maxOutput);
+    return this->arcMotion(direction, radius, heading, true, timeout, this->arcConstants);
 }
 
 /**
@@ -1007,8 +1407,8 @@ float chassis::arcTo(vex::turnType direction, float radius, float heading, float
  * @param   heading             the desired heading, in degrees
  * @param   timeout             the time before the PID gives up, in seconds
  * @param   Kp                  the proportional constant
- * @param   Ki                  the integral constant
- * @param   Kd                  the derivative constant
+ * @param   Ki                  the integral constant, per second
+ * @param   Kd                  the derivative constant, per second
  * @param   integralTolerance   the tolerance range for the integral to grow, in degrees
  * @param   settleTolerance     the tolerance range for the PID to be considered settled, in degrees
  * @param   settleTime          the amount of time the error must be within the settleTolerance before it is truly settled, in seconds
@@ -1019,38 +1419,7 @@ float chassis::arcTo(vex::turnType direction, float radius, float heading, float
  */
 float chassis::arcTo(vex::turnType direction, float radius, float heading, float timeout, float Kp, float Ki, float Kd, float integralTolerance, float settleTolerance, float settleTime, float minOutput, float maxOutput)
 {
-    PID arcPID = PID(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput, 10);
-    float multiplier = (radius - trackWidth/2) / (radius + trackWidth/2);
-
-    float t = 0;
-    if(direction == vex::turnType::right){
-        while(!arcPID.isSettled() && t < timeout){
-            float error = this->restrain(heading - this->Inertial->heading(vex::rotationUnits::deg), -180, 180);
-            float output = arcPID.getOutput(error);
-
-            this->Left->spin(vex::directionType::fwd, output, vex::voltageUnits::volt);
-            this->Right->spin(vex::directionType::fwd, multiplier * output, vex::voltageUnits::volt);
-
-            vex::task::sleep(10);
-            t += 0.01;
-        }
-    }
-    else{
-        while(!arcPID.isSettled() && t < timeout){
-            float error = this->restrain(this->Inertial->heading(vex::rotationUnits::deg), -180, 180);
-            float output = arcPID.getOutput(error);
-
-            this->Left->spin(vex::directionType::fwd, multiplier * output, vex::voltageUnits::volt);
-            this->Right->spin(vex::directionType::fwd, output, vex::voltageUnits::volt);
-
-            vex::task::sleep(10);
-            t += 0.01;
-        }
-    }
-
-    this->stopDrive(vex::brakeType::hold);
-
-    return t;
+    return this->arcMotion(direction, radius, heading, true, timeout, PIDConstants(Kp, Ki, Kd, integralTolerance, settleTolerance, settleTime, minOutput, maxOutput));
 }
 
 /**
@@ -1094,3 +1463,449 @@ void chassis::setArcSpeed(vex::turnType direction, float radius, float speed, ve
         this->Right->spin(vex::directionType::fwd, speed, unit);
     }
 }
+
+/**
+ * Follows a path with pure pursuit using the path constants and no timeout
+ * Requires odometry to be active
+ * 
+ * @param   path    the path to follow, starting near the robot
+ * 
+ * @return  the time it takes to reach the end of the path
+ */
+float chassis::followPath(Path &path)
+{
+    return this->followPath(path, INFINITY, false, this->pathConstants.lookahead, this->pathConstants.Kp, this->pathConstants.settleTolerance, this->pathConstants.maxOutput);
+}
+
+/**
+ * Follows a path with pure pursuit using the path constants and a timeout
+ * Requires odometry to be active
+ * 
+ * @param   path    the path to follow, starting near the robot
+ * @param   timeout the time before the robot gives up, in seconds
+ * 
+ * @return  the time it takes to reach the end of the path or time out
+ */
+float chassis::followPath(Path &path, float timeout)
+{
+    return this->followPath(path, timeout, false, this->pathConstants.lookahead, this->pathConstants.Kp, this->pathConstants.settleTolerance, this->pathConstants.maxOutput);
+}
+
+/**
+ * Follows a path with pure pursuit using the path constants and a timeout
+ * Requires odometry to be active
+ * 
+ * @param   path    the path to follow, starting near the robot
+ * @param   timeout the time before the robot gives up, in seconds
+ * @param   reverse true to follow the path driving backwards
+ * 
+ * @return  the time it takes to reach the end of the path or time out
+ */
+float chassis::followPath(Path &path, float timeout, bool reverse)
+{
+    return this->followPath(path, timeout, reverse, this->pathConstants.lookahead, this->pathConstants.Kp, this->pathConstants.settleTolerance, this->pathConstants.maxOutput);
+}
+
+/**
+ * Follows a path with pure pursuit
+ * Requires odometry to be active
+ * Each tick the robot steers along the arc through the lookahead point, the point where a
+ * circle of radius lookahead around the robot leaves the path. The search for it starts at
+ * the segment it was on last tick and looks at most two lookaheads further along the path,
+ * so a tick costs the same on any length of path and the robot never jumps back.
+ * The outer side of the arc runs at maxOutput until the end of the path is inside the
+ * lookahead. From there the lookahead point slides along the last segment past the end,
+ * the robot slows down by Kp per inch left and stops once it is within settleTolerance
+ * of the end or past it.
+ * 
+ * @param   path                the path to follow, starting near the robot
+ * @param   timeout             the time before the robot gives up, in seconds
+ * @param   reverse             true to follow the path driving backwards
+ * @param   lookahead           how far ahead on the path the robot steers toward, in inches
+ * @param   Kp                  volts per inch left to the end of the path
+ * @param   settleTolerance     how close to the end of the path counts as done, in inches
+ * @param   maxOutput           the fastest either side may be driven, in volts
+ * 
+ * @return  the time it takes to reach the end of the path or time out
+ */
+float chassis::followPath(Path &path, float timeout, bool reverse, float lookahead, float Kp, float settleTolerance, float maxOutput)
+{
+    if(path.size() < 2) return 0;
+
+    int segments = path.size() - 1;
+    int segment = 0;
+    float fraction = 0;
+    PathPoint target = path.getPoint(0);
+    PathPoint end = path.getEnd();
+    bool targetingEnd = false;
+
+    // direction the path leaves its end, followed past the end while the robot arrives
+    PathPoint beforeEnd = path.getPoint(segments - 1);
+    float endX = (end.x - beforeEnd.x) / (end.distance - beforeEnd.distance);
+    float endY = (end.y - beforeEnd.y) / (end.distance - beforeEnd.distance);
+
+    Chain chain = this->takeChain();
+    if(chain.active) settleTolerance = chain.exitDistance;
+
+    LoopTimer loop(this->loopPeriod);
+    while(loop.getElapsed() < timeout && !this->isCancelled()){
+        Pose pose = this->Odom->getPose();
+        this->trackSpeed(this->Sensors->getFrame());
+        float heading = pose.heading * M_PI / 180;
+        if(reverse) heading += M_PI;
+
+        if(!targetingEnd && hypotf(end.x - pose.x, end.y - pose.y) < lookahead && path.getLength() - target.distance < 2 * lookahead){
+            targetingEnd = true;
+        }
+
+        // incremental lookahead search, forward from last tick's segment
+        for(int i = segment; i < segments && !targetingEnd; i++){
+            PathPoint start = path.getPoint(i);
+            if(start.distance > target.distance + 2 * lookahead) break;
+
+            PathPoint next = path.getPoint(i + 1);
+            float found = this->circleIntersection(start, next, pose.x, pose.y, lookahead);
+            if(found < 0 || (i == segment && found < fraction)) continue;
+
+            segment = i;
+            fraction = found;
+            target.x = start.x + (next.x - start.x) * found;
+            target.y = start.y + (next.y - start.y) * found;
+            target.distance = start.distance + (next.distance - start.distance) * found;
+            break;
+        }
+
+        float speed = maxOutput;
+        if(targetingEnd){
+            float remaining = (end.x - pose.x) * endX + (end.y - pose.y) * endY;
+            if(remaining < settleTolerance) break;
+            speed = this->clamp(this->carry(Kp * remaining, 1, chain), 0, maxOutput);
+            target.x = end.x + (lookahead - remaining) * endX;
+            target.y = end.y + (lookahead - remaining) * endY;
+        }
+
+        // target in the robot's frame, forward and to the right
+        float dx = target.x - pose.x;
+        float dy = target.y - pose.y;
+        float right = dx * cosf(heading) - dy * sinf(heading);
+        float distanceSquared = dx * dx + dy * dy;
+        float curvature = distanceSquared > 0 ? 2 * right / distanceSquared : 0;
+
+        float leftOutput = speed * (1 + curvature * this->trackWidth / 2);
+        float rightOutput = speed * (1 - curvature * this->trackWidth / 2);
+        float largest = fmaxf(fabsf(leftOutput), fabsf(rightOutput));
+        if(largest > maxOutput){
+            leftOutput *= maxOutput / largest;
+            rightOutput *= maxOutput / largest;
+        }
+
+        if(reverse){
+            this->Left->spin(vex::directionType::fwd, -rightOutput, vex::voltageUnits::volt);
+            this->Right->spin(vex::directionType::fwd, -leftOutput, vex::voltageUnits::volt);
+        }
+        else{
+            this->Left->spin(vex::directionType::fwd, leftOutput, vex::voltageUnits::volt);
+            this->Right->spin(vex::directionType::fwd, rightOutput, vex::voltageUnits::volt);
+        }
+        if(this->telemetry) this->telemetry->push(TelemetryChannel::path, pose.x, pose.y, pose.heading, reverse ? -rightOutput : leftOutput, reverse ? -leftOutput : rightOutput);
+
+        loop.wait();
+    }
+
+    this->endMotion(chain, loop);
+
+    return loop.getElapsed();
+}
+
+/**
+ * Follows a generated trajectory using the RAMSETE constants
+ * Requires odometry to be active
+ * 
+ * @param   trajectory  a table from trajectories.h, starting near the robot
+ * 
+ * @return  the time it takes to follow the trajectory
+ */
+float chassis::followTrajectory(const Trajectory &trajectory)
+{
+    return this->followTrajectory(trajectory, this->ramseteConstants.b, this->ramseteConstants.zeta);
+}
+
+/**
+ * Follows a generated trajectory with a RAMSETE controller
+ * Requires odometry to be active
+ * The spline and time parameterization were done on the host by sim/tools/trajgen, so each
+ * tick only indexes the table, corrects the reference velocities by the odom pose error in
+ * the robot's frame, and turns the forward and turning speeds into volts with the RAMSETE
+ * feedforward. With b and zeta both 0 there is no feedback at all and the reference speeds
+ * are driven as they are, any other b or zeta corrects the pose error.
+ * The motion ends when the trajectory does.
+ * 
+ * @param   trajectory  a table from trajectories.h, starting near the robot
+ * @param   b           how hard position error is corrected, per square meter
+ * @param   zeta        damping of the correction, from 0 to 1
+ * 
+ * @return  the time it takes to follow the trajectory
+ */
+float chassis::followTrajectory(const Trajectory &trajectory, float b, float zeta)
+{
+    const float metersPerInch = 0.0254;
+    float previousVelocity = 0;
+    float previousTurning = 0;
+    Chain chain = this->takeChain();
+
+    LoopTimer loop(this->loopPeriod);
+    while(loop.getElapsed() <= trajectory.getDuration() && !this->isCancelled()){
+        Pose pose = this->Odom->getPose();
+        TrajectoryState reference = trajectory.at(loop.getElapsed());
+
+        // RAMSETE is written counterclockwise from +x and in meters
+        float theta = (90 - pose.heading) * M_PI / 180;
+        float dx = (reference.x - pose.x) * metersPerInch;
+        float dy = (reference.y - pose.y) * metersPerInch;
+        float errorX = cosf(theta) * dx + sinf(theta) * dy;
+        float errorY = -sinf(theta) * dx + cosf(theta) * dy;
+        float errorTheta = remainderf((pose.heading - reference.heading) * M_PI / 180, 2 * M_PI);
+
+        float velocity = reference.velocity * metersPerInch;
+        float angularVelocity = -reference.angularVelocity * M_PI / 180;
+        float commandVelocity = reference.velocity;
+        float commandAngular = angularVelocity;
+        if(b != 0 || zeta != 0){
+            float k = 2 * zeta * sqrtf(angularVelocity * angularVelocity + b * velocity * velocity);
+            float sinc = fabsf(errorTheta) < 1e-4f ? 1 : sinf(errorTheta) / errorTheta;
+            commandVelocity = (velocity * cosf(errorTheta) + k * errorX) / metersPerInch;
+            commandAngular = angularVelocity + k * errorTheta + b * velocity * sinc * errorY;
+        }
+
+        // forward speed and each wheel's speed from turning, in inches per second, clockwise speeds up the left side
+        float halfTrack = this->trackWidth / 2;
+        float turning = -commandAngular * halfTrack;
+        float referenceTurning = reference.angularVelocity * M_PI / 180 * halfTrack;
+        float dt = loop.getDt();
+        float acceleration = dt > 0 ? (reference.velocity - previousVelocity) / dt : 0;
+        float turningAcceleration = dt > 0 ? (referenceTurning - previousTurning) / dt : 0;
+        previousVelocity = reference.velocity;
+        previousTurning = referenceTurning;
+
+        float forwardOutput = this->ramseteConstants.kV * commandVelocity + this->ramseteConstants.kA * acceleration;
+        float turnOutput = this->ramseteConstants.turnKV * turning + this->ramseteConstants.turnKA * turningAcceleration;
+        float leftOutput = forwardOutput + turnOutput;
+        float rightOutput = forwardOutput - turnOutput;
+        if(leftOutput != 0) leftOutput += leftOutput > 0 ? this->ramseteConstants.kS : -this->ramseteConstants.kS;
+        if(rightOutput != 0) rightOutput += rightOutput > 0 ? this->ramseteConstants.kS : -this->ramseteConstants.kS;
+
+        this->Left->spin(vex::directionType::fwd, this->clamp(leftOutput, -12, 12), vex::voltageUnits::volt);
+        this->Right->spin(vex::directionType::fwd, this->clamp(rightOutput, -12, 12), vex::voltageUnits::volt);
+        if(this->telemetry) this->telemetry->push(TelemetryChannel::path, pose.x, pose.y, pose.heading, this->clamp(leftOutput, -12, 12), this->clamp(rightOutput, -12, 12));
+
+        loop.wait();
+    }
+
+    this->endMotion(chain, loop);
+
+    return loop.getElapsed();
+}
+
+/**
+ * Chains the next motion into the one after it using the chain constants
+ * The next motion does not settle or brake. It keeps its output at or above minSpeed and ends
+ * once it is within exitDistance or exitAngle of its target, leaving the motors running, and
+ * the motion after it starts from the speed the robot is carrying. Only the next motion is
+ * chained, so the last motion of a sequence stops as usual.
+ * Usage: drive.chain().driveFor(24);
+ * 
+ * @return  this chassis, to start the motion on
+ */
+chassis& chassis::chain()
+{
+    return this->chain(this->chainConstants.exitDistance, this->chainConstants.exitAngle, this->chainConstants.minSpeed);
+}
+
+/**
+ * Chains the next motion into the one after it
+ * 
+ * @param   exitDistance    how far before the target a drive ends, in inches
+ * @param   exitAngle       how far before the target a turn, swing or arc ends, in degrees
+ * @param   minSpeed        the least output the motion slows down to, in volts
+ * 
+ * @return  this chassis, to start the motion on
+ */
+chassis& chassis::chain(float exitDistance, float exitAngle, float minSpeed)
+{
+    this->nextChain.active = true;
+    this->nextChain.exitDistance = exitDistance;
+    this->nextChain.exitAngle = exitAngle;
+    this->nextChain.minSpeed = minSpeed;
+    return *this;
+}
+
+/**
+ * Runs a motion on a background task and returns right away
+ * Any async motion still running is cancelled and waited for first. Blocking motions
+ * should not be started until the async motion is done.
+ * Usage: drive.async([&]{ return drive.driveToPose(24, 24, 90); });
+ * 
+ * @param   motion  a function that runs one blocking motion and returns its time
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::async(std::function<float()> motion)
+{
+    uint32_t previous = this->startedMotion.load();
+    MotionHandle(this, previous).cancel();
+    if(this->motionTask.joinable()) this->motionTask.join();
+
+    this->asyncMotion = motion;
+    this->motionStartDistance = this->trackedDistance(this->Sensors->getFrame());
+    this->startedMotion.store(previous + 1);
+    this->motionTask = vex::thread(chassis::runMotion, this);
+    return MotionHandle(this, previous + 1);
+}
+
+/**
+ * Starts driveFor on a background task with no timeout
+ * 
+ * @param   distance    the distance to be driven, in inches
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::driveForAsync(float distance)
+{
+    return this->async([this, distance]{ return this->driveFor(distance); });
+}
+
+/**
+ * Starts driveFor on a background task with a timeout
+ * 
+ * @param   distance    the distance to be driven, in inches
+ * @param   timeout     the time before the drive gives up, in seconds
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::driveForAsync(float distance, float timeout)
+{
+    return this->async([this, distance, timeout]{ return this->driveFor(distance, timeout); });
+}
+
+/**
+ * Starts driveFor on a background task with a timeout, holding a heading
+ * 
+ * @param   distance    the distance to be driven, in inches
+ * @param   timeout     the time before the drive gives up, in seconds
+ * @param   heading     the desired heading for the robot to hold
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::driveForAsync(float distance, float timeout, float heading)
+{
+    return this->async([this, distance, timeout, heading]{ return this->driveFor(distance, timeout, heading); });
+}
+
+/**
+ * Starts turnTo on a background task with no timeout
+ * 
+ * @param   heading     the heading to turn to, in degrees
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::turnToAsync(float heading)
+{
+    return this->async([this, heading]{ return this->turnTo(heading); });
+}
+
+/**
+ * Starts turnTo on a background task with a timeout
+ * 
+ * @param   heading     the heading to turn to, in degrees
+ * @param   timeout     the time before the turn gives up, in seconds
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::turnToAsync(float heading, float timeout)
+{
+    return this->async([this, heading, timeout]{ return this->turnTo(heading, timeout); });
+}
+
+/**
+ * Starts swingTo on a background task with no timeout
+ * 
+ * @param   direction   the direction of the swing
+ * @param   heading     the heading to swing to, in degrees
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::swingToAsync(vex::turnType direction, float heading)
+{
+    return this->async([this, direction, heading]{ return this->swingTo(direction, heading); });
+}
+
+/**
+ * Starts swingTo on a background task with a timeout
+ * 
+ * @param   direction   the direction of the swing
+ * @param   heading     the heading to swing to, in degrees
+ * @param   timeout     the time before the swing gives up, in seconds
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::swingToAsync(vex::turnType direction, float heading, float timeout)
+{
+    return this->async([this, direction, heading, timeout]{ return this->swingTo(direction, heading, timeout); });
+}
+
+/**
+ * Starts arcTo on a background task with no timeout
+ * 
+ * @param   direction   the direction of the arc
+ * @param   radius      the radius of the arc, in inches
+ * @param   heading     the heading to arc to, in degrees
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::arcToAsync(vex::turnType direction, float radius, float heading)
+{
+    return this->async([this, direction, radius, heading]{ return this->arcTo(direction, radius, heading); });
+}
+
+/**
+ * Starts arcTo on a background task with a timeout
+ * 
+ * @param   direction   the direction of the arc
+ * @param   radius      the radius of the arc, in inches
+ * @param   heading     the heading to arc to, in degrees
+ * @param   timeout     the time before the arc gives up, in seconds
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::arcToAsync(vex::turnType direction, float radius, float heading, float timeout)
+{
+    return this->async([this, direction, radius, heading, timeout]{ return this->arcTo(direction, radius, heading, timeout); });
+}
+
+/**
+ * Starts driveTo on a background task with no timeout
+ * 
+ * @param   x   x coordinate of the target, in inches
+ * @param   y   y coordinate of the target, in inches
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::driveToAsync(float x, float y)
+{
+    return this->async([this, x, y]{ return this->driveTo(x, y); });
+}
+
+/**
+ * Starts driveTo on a background task with a timeout
+ * 
+ * @param   x               x coordinate of the target, in inches
+ * @param   y               y coordinate of the target, in inches
+ * @param   driveTimeout    time allowed for driving, in seconds
+ * @param   turnTimeout     time allowed for turning, in seconds
+ * 
+ * @return  a handle to wait on or cancel the motion
+ */
+MotionHandle chassis::driveToAsync(float x, float y, float driveTimeout, float turnTimeout)
+{
+    return this->async([this, x, y, driveTimeout, turnTimeout]{ return this->driveTo(x, y, driveTimeout, turnTimeout); });
+}
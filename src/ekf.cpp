@@ -0,0 +1,298 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       ekf.cpp                                                   */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Extended Kalman Filter pose estimator source code         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include "ekf.h"
+
+/**
+ * Constructor method
+ * Starts at the origin facing +y with a tight pose and a loose velocity estimate
+ */
+PoseEKF::PoseEKF(){
+    for(int i = 0; i < N; i++){
+        this->state[i] = 0;
+        for(int j = 0; j < N; j++) this->covariance[i][j] = 0;
+    }
+    this->covariance[X][X] = 0.01;
+    this->covariance[Y][Y] = 0.01;
+    this->covariance[THETA][THETA] = 0.0001;
+    this->covariance[V][V] = 1;
+    this->covariance[U][U] = 1;
+    this->covariance[OMEGA][OMEGA] = 0.01;
+}
+
+/**
+ * Sets the vertical tracking wheel, same geometry as odom
+ *
+ * @param   verticalDistanceFromCenter  distance from the tracking center to the wheel, in inches, positive to the right
+ * @param   verticalInchesPerDegree     inches travelled per degree of the wheel
+ */
+void PoseEKF::setVerticalTracking(float verticalDistanceFromCenter, float verticalInchesPerDegree){
+    this->hasVertical = true;
+    this->verticalDistanceFromCenter = verticalDistanceFromCenter;
+    this->verticalInchesPerDegree = verticalInchesPerDegree;
+}
+
+/**
+ * Sets the horizontal tracking wheel, same geometry as odom
+ *
+ * @param   horizontalDistanceFromCenter    distance from the tracking center to the wheel, in inches, positive behind
+ * @param   horizontalInchesPerDegree       inches travelled per degree of the wheel
+ */
+void PoseEKF::setHorizontalTracking(float horizontalDistanceFromCenter, float horizontalInchesPerDegree){
+    this->hasHorizontal = true;
+    this->horizontalDistanceFromCenter = horizontalDistanceFromCenter;
+    this->horizontalInchesPerDegree = horizontalInchesPerDegree;
+}
+
+/**
+ * Lets the filter use the drive motor encoders
+ *
+ * @param   driveInchesPerDegree    inches the drive wheels travel per degree of motor rotation
+ * @param   trackWidth              distance between the left and right wheels, in inches
+ */
+void PoseEKF::setDrive(float driveInchesPerDegree, float trackWidth){
+    this->hasDrive = true;
+    this->driveInchesPerDegree = driveInchesPerDegree;
+    this->trackWidth = trackWidth;
+}
+
+/**
+ * Setter for the filter tuning
+ *
+ * @param   settings    the noise and gating values
+ */
+void PoseEKF::setSettings(const EKFSettings &settings){
+    this->settings = settings;
+}
+
+/**
+ * Moves the estimate to a known pose
+ * Velocities are kept, the next frame is only used as the new reference
+ *
+ * @param   x       the robot x position in inches
+ * @param   y       the robot y position in inches
+ * @param   heading the robot heading in degrees
+ */
+void PoseEKF::reset(float x, float y, float heading){
+    this->state[X] = x;
+    this->state[Y] = y;
+    this->state[THETA] = heading * (M_PI / 180);
+
+    for(int i = 0; i < N; i++){
+        for(int j = X; j <= THETA; j++){
+            this->covariance[i][j] = 0;
+            this->covariance[j][i] = 0;
+        }
+    }
+    this->covariance[X][X] = 0.01;
+    this->covariance[Y][Y] = 0.01;
+    this->covariance[THETA][THETA] = 0.0001;
+
+    this->initialized = false;
+}
+
+/**
+ * Private function that moves the state forward by dt
+ * The velocities over the interval are the ones integrated into the pose, so
+ * the process noise on them also reaches the pose through the same Jacobian
+ * column, and a velocity correction drags the pose along with it.
+ *
+ * @param   dt  time since the last frame, in seconds
+ */
+void PoseEKF::predict(float dt){
+    float midHeading = this->state[THETA] + this->state[OMEGA] * dt / 2;
+    float sine = sinf(midHeading);
+    float cosine = cosf(midHeading);
+    float changeInX = (this->state[V] * sine + this->state[U] * cosine) * dt;
+    float changeInY = (this->state[V] * cosine - this->state[U] * sine) * dt;
+
+    this->state[X] += changeInX;
+    this->state[Y] += changeInY;
+    this->state[THETA] += this->state[OMEGA] * dt;
+
+    float jacobian[N][N] = {};
+    for(int i = 0; i < N; i++) jacobian[i][i] = 1;
+    jacobian[X][THETA] = changeInY;
+    jacobian[X][V] = sine * dt;
+    jacobian[X][U] = cosine * dt;
+    jacobian[X][OMEGA] = changeInY * dt / 2;
+    jacobian[Y][THETA] = -changeInX;
+    jacobian[Y][V] = cosine * dt;
+    jacobian[Y][U] = -sine * dt;
+    jacobian[Y][OMEGA] = -changeInX * dt / 2;
+    jacobian[THETA][OMEGA] = dt;
+
+    float product[N][N];
+    for(int i = 0; i < N; i++){
+        for(int j = 0; j < N; j++){
+            float sum = 0;
+            for(int k = 0; k < N; k++) sum += jacobian[i][k] * this->covariance[k][j];
+            product[i][j] = sum;
+        }
+    }
+    for(int i = 0; i < N; i++){
+        for(int j = i; j < N; j++){
+            float sum = 0;
+            for(int k = 0; k < N; k++) sum += product[i][k] * jacobian[j][k];
+            this->covariance[i][j] = sum;
+        }
+    }
+
+    const int inputs[3] = {V, U, OMEGA};
+    const float accelerations[3] = {this->settings.acceleration, this->settings.lateralAcceleration, this->settings.angularAcceleration};
+    for(int n = 0; n < 3; n++){
+        float variance = accelerations[n] * dt * accelerations[n] * dt;
+        int column = inputs[n];
+        for(int i = 0; i < N; i++){
+            for(int j = i; j < N; j++) this->covariance[i][j] += variance * jacobian[i][column] * jacobian[j][column];
+        }
+    }
+
+    for(int i = 0; i < N; i++){
+        for(int j = 0; j < i; j++) this->covariance[i][j] = this->covariance[j][i];
+    }
+}
+
+/**
+ * Private function that applies one scalar measurement of the form a * state[i] + b * state[j]
+ *
+ * @param   i           first state index
+ * @param   a           weight of the first state
+ * @param   j           second state index
+ * @param   b           weight of the second state, 0 for a single state measurement
+ * @param   innovation  measured value minus predicted value
+ * @param   variance    measurement variance
+ * @param   gated       whether an improbable innovation is rejected instead of applied
+ *
+ * @return  false if the measurement was rejected
+ */
+bool PoseEKF::correct(int i, float a, int j, float b, float innovation, float variance, bool gated){
+    float crossCovariance[N];
+    for(int k = 0; k < N; k++) crossCovariance[k] = a * this->covariance[k][i] + b * this->covariance[k][j];
+    float innovationVariance = a * crossCovariance[i] + b * crossCovariance[j] + variance;
+
+    if(gated && innovation * innovation > this->settings.gate * this->settings.gate * innovationVariance) return false;
+
+    float gain[N];
+    for(int k = 0; k < N; k++){
+        gain[k] = crossCovariance[k] / innovationVariance;
+        this->state[k] += gain[k] * innovation;
+    }
+    for(int r = 0; r < N; r++){
+        for(int c = r; c < N; c++){
+            this->covariance[r][c] -= gain[r] * crossCovariance[c];
+            this->covariance[c][r] = this->covariance[r][c];
+        }
+    }
+    return true;
+}
+
+/**
+ * Runs one predict and correct cycle with a frame of sensor readings
+ * Tracking wheels, inertial heading and gyro rate are always applied. Drive
+ * encoders are gated since they are the ones that slip when the robot launches
+ * or gets pushed, and are trusted again after relockFrames so the estimate
+ * recovers if it ever walks away from them.
+ *
+ * @param   frame   the sensor readings for this update
+ */
+void PoseEKF::update(const SensorFrame &frame){
+    if(!this->initialized){
+        this->previous = frame;
+        this->initialized = true;
+        return;
+    }
+    if(frame.timestamp <= this->previous.timestamp) return;
+
+    float dt = (frame.timestamp - this->previous.timestamp) / 1e6f;
+    this->predict(dt);
+
+    float headingVariance = this->settings.heading * this->settings.heading;
+    float headingError = remainderf(frame.rotation * (M_PI / 180) - this->state[THETA], 2 * M_PI);
+    this->correct(THETA, 1, THETA, 0, headingError, headingVariance, false);
+
+    float gyroVariance = this->settings.gyroRate * this->settings.gyroRate;
+    float gyroRate = frame.gyroRate * (M_PI / 180);
+    this->correct(OMEGA, 1, OMEGA, 0, gyroRate - this->state[OMEGA], gyroVariance, false);
+
+    float trackingVariance = this->settings.trackingWheel * this->settings.trackingWheel;
+    if(this->hasVertical){
+        float measured = (frame.vertical - this->previous.vertical) * this->verticalInchesPerDegree / dt;
+        float predicted = this->state[V] - this->state[OMEGA] * this->verticalDistanceFromCenter;
+        this->correct(V, 1, OMEGA, -this->verticalDistanceFromCenter, measured - predicted, trackingVariance, false);
+    }
+    if(this->hasHorizontal){
+        float measured = (frame.horizontal - this->previous.horizontal) * this->horizontalInchesPerDegree / dt;
+        float predicted = this->state[U] - this->state[OMEGA] * this->horizontalDistanceFromCenter;
+        this->correct(U, 1, OMEGA, -this->horizontalDistanceFromCenter, measured - predicted, trackingVariance, false);
+    }
+    else{
+        float lateralVariance = this->settings.lateralVelocity * this->settings.lateralVelocity;
+        this->correct(U, 1, U, 0, -this->state[U], lateralVariance, false);
+    }
+
+    if(this->hasDrive){
+        float driveVariance = this->settings.driveEncoder * this->settings.driveEncoder;
+        bool gated = this->rejectedInARow < this->settings.relockFrames;
+        float halfTrack = this->trackWidth / 2;
+
+        float left = (frame.left - this->previous.left) * this->driveInchesPerDegree / dt;
+        bool leftUsed = this->correct(V, 1, OMEGA, halfTrack, left - (this->state[V] + this->state[OMEGA] * halfTrack), driveVariance, gated);
+        float right = (frame.right - this->previous.right) * this->driveInchesPerDegree / dt;
+        bool rightUsed = this->correct(V, 1, OMEGA, -halfTrack, right - (this->state[V] - this->state[OMEGA] * halfTrack), driveVariance, gated);
+
+        this->rejected += !leftUsed + !rightUsed;
+        if(leftUsed && rightUsed) this->rejectedInARow = 0;
+        else this->rejectedInARow++;
+    }
+
+    this->previous = frame;
+}
+
+/**
+ * Getter for the estimated pose
+ *
+ * @return  the pose at the last frame, heading in degrees [0, 360)
+ */
+Pose PoseEKF::getPose(){
+    Pose pose;
+    pose.x = this->state[X];
+    pose.y = this->state[Y];
+    pose.heading = fmodf(this->state[THETA] * (180 / M_PI), 360);
+    if(pose.heading < 0) pose.heading += 360;
+    pose.timestamp = this->previous.timestamp;
+    return pose;
+}
+
+/**
+ * @return  the estimated forward velocity, in inches per second
+ */
+float PoseEKF::getVelocity(){
+    return this->state[V];
+}
+
+/**
+ * @return  the variance of the position estimate summed over x and y, in square inches
+ */
+float PoseEKF::getPositionVariance(){
+    return this->covariance[X][X] + this->covariance[Y][Y];
+}
+
+/**
+ * @return  the variance of the heading estimate, in square radians
+ */
+float PoseEKF::getHeadingVariance(){
+    return this->covariance[THETA][THETA];
+}
+
+/**
+ * @return  the number of drive encoder readings rejected by the gate
+ */
+uint32_t PoseEKF::getRejectedCount(){
+    return this->rejected;
+}
@@ -0,0 +1,183 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       fieldmap.cpp                                              */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Live field map of the odom pose and its trail             */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include "fieldmap.h"
+
+/**
+ * Private function that draws the marker for a pose and remembers the box it covers
+ * A marker reaching past the outline is moved back inside, the box is only erased inside the outline.
+ *
+ * @param   pose    where to draw it, in field inches and degrees clockwise from +y
+ */
+void FieldMap::drawMarker(const Pose& pose){
+    float radians = pose.heading * M_PI / 180;
+    float forwardX = sinf(radians) * this->markerInches;
+    float forwardY = cosf(radians) * this->markerInches;
+
+    // the tip along the heading, the back corners behind the center to either side
+    float cornersX[3] = {pose.x + forwardX, pose.x - 0.6f * (forwardX + forwardY), pose.x - 0.6f * (forwardX - forwardY)};
+    float cornersY[3] = {pose.y + forwardY, pose.y - 0.6f * (forwardY - forwardX), pose.y - 0.6f * (forwardY + forwardX)};
+    int x[3];
+    int y[3];
+    for(int i = 0; i < 3; i++){
+        x[i] = this->graph.toScreenX(cornersX[i]);
+        y[i] = this->graph.toScreenY(cornersY[i]);
+    }
+
+    // the pen reaches a pixel past the corners
+    int* box = this->markerBox;
+    box[0] = box[2] = x[0];
+    box[1] = box[3] = y[0];
+    for(int i = 1; i < 3; i++){
+        if(x[i] < box[0]) box[0] = x[i];
+        if(x[i] > box[2]) box[2] = x[i];
+        if(y[i] < box[1]) box[1] = y[i];
+        if(y[i] > box[3]) box[3] = y[i];
+    }
+    box[0] -= 2;
+    box[1] -= 2;
+    box[2] += 2;
+    box[3] += 2;
+
+    int shiftX = box[0] < this->inside[0] ? this->inside[0] - box[0] : box[2] > this->inside[2] ? this->inside[2] - box[2] : 0;
+    int shiftY = box[1] < this->inside[1] ? this->inside[1] - box[1] : box[3] > this->inside[3] ? this->inside[3] - box[3] : 0;
+    for(int i = 0; i < 3; i++){
+        x[i] += shiftX;
+        y[i] += shiftY;
+    }
+    box[0] += shiftX;
+    box[2] += shiftX;
+    box[1] += shiftY;
+    box[3] += shiftY;
+
+    this->Brain_Screen->setPenColor(this->markerColor);
+    this->Brain_Screen->setPenWidth(2);
+    for(int i = 0; i < 3; i++) this->Brain_Screen->drawLine(x[i], y[i], x[(i + 1) % 3], y[(i + 1) % 3]);
+    this->hasMarker = true;
+}
+
+/**
+ * Sets where on the screen the map goes, the field is stretched to fill it
+ *
+ * @param   minX    the pixel x-location of the left edge
+ * @param   maxX    the pixel x-location of the right edge
+ * @param   minY    the pixel y-location of the bottom edge, counted up from the bottom of the screen
+ * @param   maxY    the pixel y-location of the top edge
+ */
+void FieldMap::setArea(int minX, int maxX, int minY, int maxY){
+    this->graph.setGraph(minX, maxX, minY, maxY, vex::color(60, 60, 60));
+    this->graph.setScale((maxX - minX) / (float)fieldInches, (maxY - minY) / (float)fieldInches, -fieldInches / 2, -fieldInches / 2);
+
+    // the same box Graph::redrawRegion erases, rows counted down from the top of the screen
+    this->inside[0] = minX + this->outlineThickness;
+    this->inside[1] = 240 - maxY + this->outlineThickness;
+    this->inside[2] = maxX - this->outlineThickness;
+    this->inside[3] = 240 - minY - this->outlineThickness;
+}
+
+/**
+ * Sets how far the robot moves before the trail gets another point
+ *
+ * @param   inches  the distance between trail points
+ */
+void FieldMap::setTrailSpacing(float inches){
+    this->trailSpacing = inches;
+}
+
+/**
+ * Draws one frame if the pose moved since the last one
+ * A pose off the field is drawn at its edge, with the marker kept inside the map.
+ *
+ * @return  true if anything was drawn
+ */
+bool FieldMap::update(){
+    Pose pose;
+    uint32_t sequence = this->tracker->readPose(pose);
+    if(this->hasMarker && sequence == this->poseSequence) return false;
+    this->poseSequence = sequence;
+
+    float edge = fieldInches / 2 - 0.5f;
+    pose.x = fminf(fmaxf(pose.x, -edge), edge);
+    pose.y = fminf(fmaxf(pose.y, -edge), edge);
+    if(this->hasMarker && pose.x == this->trailEnd.x && pose.y == this->trailEnd.y && pose.heading == this->trailEnd.heading) return false;
+
+    if(!this->hasTrail || hypotf(pose.x - this->trailEnd.x, pose.y - this->trailEnd.y) >= this->trailSpacing){
+        this->trail.push(pose.x, pose.y);
+        this->hasTrail = true;
+    }
+    this->trailEnd = pose;
+
+    if(this->hasMarker) this->graph.redrawRegion(this->markerBox[0], this->markerBox[1], this->markerBox[2], this->markerBox[3]);
+    this->graph.drawStreams();
+    this->drawMarker(pose);
+    return true;
+}
+
+/**
+ * Private function that runs the map's task, drawing and rendering at most once a frame
+ */
+int FieldMap::run(void* arg){
+    FieldMap* map = (FieldMap*)arg;
+    LoopTimer loop(map->framePeriod);
+    while(map->isRunning.load()){
+        if(map->update()){
+            map->Brain_Screen->render();
+            map->frames++;
+        }
+        loop.wait();
+    }
+    return 0;
+}
+
+/**
+ * Starts drawing the map on a low priority task
+ *
+ * @param   framesPerSecond the most frames rendered each second
+ */
+void FieldMap::start(int framesPerSecond){
+    if(this->isRunning.load()) return;
+    this->framePeriod = framesPerSecond > 0 && framesPerSecond < 1000 ? 1000 / framesPerSecond : 1;
+
+    this->isRunning.store(true);
+    this->task = vex::thread(FieldMap::run, this);
+    this->task.setPriority(vex::thread::threadPriorityLow);
+}
+
+/**
+ * Stops the map's task
+ */
+void FieldMap::stop(){
+    if(!this->isRunning.load()) return;
+    this->isRunning.store(false);
+    this->task.join();
+}
+
+/**
+ * Getter for the number of frames rendered by the map's task
+ */
+uint32_t FieldMap::getFrames(){
+    return this->frames;
+}
+
+/**
+ * Constructor method
+ * The map fills the left 240 by 240 pixels of the screen until setArea moves it
+ *
+ * @param   Brain_Screen    a pointer to the brain's lcd screen
+ * @param   tracker         the odometry whose pose is drawn
+ */
+FieldMap::FieldMap(vex::brain::lcd* Brain_Screen, odom* tracker) : graph(Brain_Screen), isRunning(false){
+    this->Brain_Screen = Brain_Screen;
+    this->tracker = tracker;
+    this->markerColor = vex::color::red;
+
+    this->graph.setOutline(vex::color::white, this->outlineThickness);
+    this->graph.setGrid(24, 24, vex::color(110, 110, 110));
+    this->graph.addStream(&this->trail, vex::color::yellow, 1);
+    this->setArea(0, 240, 0, 240);
+}
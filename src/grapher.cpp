@@ -60,30 +60,136 @@ void Graph::setScale(float xPixelsPerUnit, float yPixelsPerUnit, float minXValue
     this->yPixelsPerUnit = yPixelsPerUnit;
     this->minXValue = minXValue;
     this->minYValue = minYValue;
+    this->hasScale = true;
+}
+
+/**
+ * Public function to set the grid drawn with the outline
+ * 
+ * @param   xSpacing    the units between vertical grid lines, 0 for none
+ * @param   ySpacing    the units between horizontal grid lines, 0 for none
+ * @param   gridColor   the color of the grid lines
+ */
+void Graph::setGrid(float xSpacing, float ySpacing, vex::color gridColor){
+    this->gridXSpacing = xSpacing;
+    this->gridYSpacing = ySpacing;
+    this->gridColor = gridColor;
+}
+
+/**
+ * Private function that works out the pixel transform for the current scale
+ * 
+ * @return  the scale and offset taking a value to its pixel on each axis
+ */
+Graph::Transform Graph::getTransform(){
+    Transform transform;
+    transform.xScale = this->xPixelsPerUnit;
+    transform.xOffset = this->outline.minXPixel - this->minXValue * this->xPixelsPerUnit;
+    transform.yScale = this->yPixelsPerUnit;
+    transform.yOffset = 240 - this->outline.minYPixel + this->minYValue * this->yPixelsPerUnit;
+    return transform;
+}
+
+/**
+ * The pixels of a SeriesView's points in order
+ */
+struct Graph::SeriesPixels{
+    const SeriesView& data;
+    Transform transform;
+    uint32_t point;
+
+    SeriesPixels(const SeriesView& data, Transform transform) : data(data), transform(transform), point(0){}
+
+    bool next(int& x, int& y){
+        if(this->point == this->data.size()) return false;
+        x = this->transform.toX(this->data.getX(this->point));
+        y = this->transform.toY(this->data.getY(this->point));
+        this->point++;
+        return true;
+    }
+};
+
+/**
+ * The pixels of a PlotStream's samples from one sample up to a head
+ */
+struct Graph::StreamPixels{
+    const PlotStream* samples;
+    Transform transform;
+    uint32_t sample;
+    uint32_t head;
+
+    StreamPixels(const PlotStream* samples, Transform transform, uint32_t sample, uint32_t head) : \
+        samples(samples), transform(transform), sample(sample), head(head){}
+
+    bool next(int& x, int& y){
+        if(this->sample == this->head) return false;
+        x = this->transform.toX(this->samples->getX(this->sample));
+        y = this->transform.toY(this->samples->getY(this->sample));
+        this->sample++;
+        return true;
+    }
+};
+
+/**
+ * Private function that draws lines through at least two pixels, one pixel column at a time
+ * The lines between points in the same column are all vertical and cover the column
+ * from its lowest to its highest point, so they are drawn as that one line. The
+ * lines between columns are drawn as they are. This draws the same pixels as a
+ * line per point, with at most two lines per column of the screen however many
+ * points there are.
+ * 
+ * @param   pixels  gives the next point's pixel with next(x, y), false once there are none
+ */
+template<class Pixels>
+void Graph::drawColumns(Pixels& pixels){
+    int column;
+    int lastY;
+    if(!pixels.next(column, lastY)) return;
+    int lowest = lastY;
+    int highest = lastY;
+    int points = 1;
+
+    int x;
+    int y;
+    while(pixels.next(x, y)){
+        if(x == column){
+            if(y < lowest) lowest = y;
+            if(y > highest) highest = y;
+            lastY = y;
+            points++;
+            continue;
+        }
+        if(points > 1) this->Brain_Screen->drawLine(column, lowest, column, highest);
+        this->Brain_Screen->drawLine(column, lastY, x, y);
+        column = x;
+        lastY = lowest = highest = y;
+        points = 1;
+    }
+    if(points > 1) this->Brain_Screen->drawLine(column, lowest, column, highest);
 }
 
 /**
  * Public function to draw the data
  * will only draw if there is at least one point
+ * Each point is transformed once, and points sharing a pixel column share one line,
+ * so a long log costs at most two lines per column of the screen
  * 
- * @param   data            a std::vector<std::vector<float>> representing a series of points
+ * @param   data            the points to draw, a Series or a SeriesView of someone else's arrays
  * @param   dataColor       the color the data should be
  * @param   penThickness    the thickness, in pixels, the data should be
  */
-void Graph::drawData(std::vector<std::vector<float>> data, vex::color dataColor, int penThickness){
+void Graph::drawData(const SeriesView& data, vex::color dataColor, int penThickness){
     this->Brain_Screen->setPenColor(dataColor);
+    Transform transform = this->getTransform();
 
     if(data.size() == 0) {}
     else if(data.size() == 1){
-        this->Brain_Screen->drawCircle((data.at(0).at(0) - this->minXValue) * this->xPixelsPerUnit + this->outline.minXPixel, 240 - (this->outline.minYPixel + (data.at(0).at(1) - this->minYValue) * this->yPixelsPerUnit), penThickness);
+        this->Brain_Screen->drawCircle(transform.toX(data.getX(0)), transform.toY(data.getY(0)), penThickness);
     }
     else{
         this->Brain_Screen->setPenWidth(penThickness);
-
-        for(int i = 0; i < data.size() - 1; i++){
-            this->Brain_Screen->drawLine((data.at(i).at(0) - this->minXValue) * this->xPixelsPerUnit + this->outline.minXPixel, 240 - (this->outline.minYPixel + (data.at(i).at(1) - this->minYValue) * this->yPixelsPerUnit),\
-                                            (data.at(i + 1).at(0) - this->minXValue) * this->xPixelsPerUnit + this->outline.minXPixel, 240 - (this->outline.minYPixel + (data.at(i + 1).at(1) - this->minYValue) * this->yPixelsPerUnit));
-        }
+        SeriesPixels pixels(data, transform);
+        this->drawColumns(pixels);
     }
 }
 
@@ -96,23 +202,130 @@ void Graph::drawOutline(){
     this->Brain_Screen->setFillColor(backgroundColor);
     this->Brain_Screen->setPenWidth(this->outline.thickness);
     this->Brain_Screen->drawRectangle(this->outline.minXPixel, 240-this->outline.maxYPixel, this->outline.maxXPixel-this->outline.minXPixel, this->outline.maxYPixel-this->outline.minYPixel);
+    this->drawGrid(this->outline.minXPixel + this->outline.thickness, 240 - this->outline.maxYPixel + this->outline.thickness, \
+        this->outline.maxXPixel - this->outline.thickness, 240 - this->outline.minYPixel - this->outline.thickness);
+}
+
+
+/**
+ * Private function that draws the grid lines that cross a box of the screen, cut to the box
+ * 
+ * @param   left    the box's left pixel column
+ * @param   top     the box's top pixel row
+ * @param   right   the box's right pixel column
+ * @param   bottom  the box's bottom pixel row
+ */
+void Graph::drawGrid(int left, int top, int right, int bottom){
+    if(!this->hasScale) return;
+    Transform transform = this->getTransform();
+    this->Brain_Screen->setPenColor(this->gridColor);
+    this->Brain_Screen->setPenWidth(1);
+
+    int width = this->outline.maxXPixel - this->outline.minXPixel;
+    int height = this->outline.maxYPixel - this->outline.minYPixel;
+    if(this->gridXSpacing * this->xPixelsPerUnit >= 2){
+        float first = ceilf(this->minXValue / this->gridXSpacing) * this->gridXSpacing;
+        for(int line = 0; line * this->gridXSpacing * this->xPixelsPerUnit <= width; line++){
+            int x = transform.toX(first + line * this->gridXSpacing);
+            if(x >= left && x <= right) this->Brain_Screen->drawLine(x, top, x, bottom);
+        }
+    }
+    if(this->gridYSpacing * this->yPixelsPerUnit >= 2){
+        float first = ceilf(this->minYValue / this->gridYSpacing) * this->gridYSpacing;
+        for(int line = 0; line * this->gridYSpacing * this->yPixelsPerUnit <= height; line++){
+            int y = transform.toY(first + line * this->gridYSpacing);
+            if(y >= top && y <= bottom) this->Brain_Screen->drawLine(left, y, right, y);
+        }
+    }
+}
+
+
+/**
+ * Public function that draws a box inside the outline again, for erasing something drawn over the graph
+ * Fills the box with the background, then draws the grid lines crossing it and
+ * every stream line touching it. The box is cut to the inside of the outline.
+ * 
+ * @param   left    the box's left pixel column
+ * @param   top     the box's top pixel row
+ * @param   right   the box's right pixel column
+ * @param   bottom  the box's bottom pixel row
+ */
+void Graph::redrawRegion(int left, int top, int right, int bottom){
+    int thickness = this->outline.thickness;
+    if(left < this->outline.minXPixel + thickness) left = this->outline.minXPixel + thickness;
+    if(right > this->outline.maxXPixel - thickness) right = this->outline.maxXPixel - thickness;
+    if(top < 240 - this->outline.maxYPixel + thickness) top = 240 - this->outline.maxYPixel + thickness;
+    if(bottom > 240 - this->outline.minYPixel - thickness) bottom = 240 - this->outline.minYPixel - thickness;
+    if(left > right || top > bottom) return;
+
+    this->Brain_Screen->setPenColor(this->backgroundColor);
+    this->Brain_Screen->setFillColor(this->backgroundColor);
+    this->Brain_Screen->setPenWidth(0);
+    this->Brain_Screen->drawRectangle(left, top, right - left + 1, bottom - top + 1);
+    this->drawGrid(left, top, right, bottom);
+
+    Transform transform = this->getTransform();
+    for(int i = 0; i < this->streamCount; i++){
+        Stream& stream = this->streams[i];
+        uint32_t first = this->firstShown(stream, stream.drawn);
+        if(first >= stream.drawn) continue;
+
+        // a line reaches half the pen past its ends
+        int reach = stream.thickness / 2 + 1;
+        this->Brain_Screen->setPenColor(stream.color);
+        this->Brain_Screen->setPenWidth(stream.thickness);
+        int previousX = transform.toX(stream.samples->getX(first));
+        int previousY = transform.toY(stream.samples->getY(first));
+        if(stream.drawn - first == 1 && previousX + stream.thickness >= left && previousX - stream.thickness <= right \
+            && previousY + stream.thickness >= top && previousY - stream.thickness <= bottom){
+            this->Brain_Screen->drawCircle(previousX, previousY, stream.thickness);
+        }
+        for(uint32_t sample = first + 1; sample < stream.drawn; sample++){
+            int x = transform.toX(stream.samples->getX(sample));
+            int y = transform.toY(stream.samples->getY(sample));
+            bool touches = (x > previousX ? x : previousX) + reach >= left && (x < previousX ? x : previousX) - reach <= right \
+                && (y > previousY ? y : previousY) + reach >= top && (y < previousY ? y : previousY) - reach <= bottom;
+            if(touches) this->Brain_Screen->drawLine(previousX, previousY, x, y);
+            previousX = x;
+            previousY = y;
+        }
+    }
+}
+
+
+/**
+ * Public function that converts an x value to its screen column at the current scale
+ */
+int Graph::toScreenX(float x){
+    return this->getTransform().toX(x);
+}
+
+
+/**
+ * Public function that converts a y value to its screen row at the current scale
+ */
+int Graph::toScreenY(float y){
+    return this->getTransform().toY(y);
 }
 
 
 /**
  * Public function that will automatically set the scale of the graph
+ * will do nothing if there are no points
  * 
- * @param   data    a std::vector<std::vector<float>> representing a series of points
+ * @param   data    the points the graph should fit
  */
-void Graph::autoScale(std::vector<std::vector<float>> data){
-    float minX = data.at(0).at(0);
+void Graph::autoScale(const SeriesView& data){
+    if(data.size() == 0) return;
+
+    float minX = data.getX(0);
     float maxX = minX;
-    float minY = data.at(0).at(1);
+    float minY = data.getY(0);
     float maxY = minY;
 
-    for (int i = 1; i < data.size(); i++){
-        float tempX = data.at(i).at(0);
-        float tempY = data.at(i).at(1);
+    for(uint32_t i = 1; i < data.size(); i++){
+        float tempX = data.getX(i);
+        float tempY = data.getY(i);
 
         if(tempX < minX) minX = tempX;
         if(tempX > maxX) maxX = tempX;
@@ -124,6 +337,310 @@ void Graph::autoScale(std::vector<std::vector<float>> data){
     this->yPixelsPerUnit = (this->outline.maxYPixel - this->outline.minYPixel) / (maxY - minY);
     this->minXValue = minX;
     this->minYValue = minY;
+    this->hasScale = true;
+}
+
+
+/**
+ * Private function that checks whether a value lands inside the plot at the current scale
+ * Nothing does before a scale is set
+ */
+bool Graph::contains(float x, float y){
+    if(!this->hasScale) return false;
+    float xPixels = (x - this->minXValue) * this->xPixelsPerUnit;
+    float yPixels = (y - this->minYValue) * this->yPixelsPerUnit;
+    return xPixels >= 0 && xPixels <= this->outline.maxXPixel - this->outline.minXPixel \
+        && yPixels >= 0 && yPixels <= this->outline.maxYPixel - this->outline.minYPixel;
+}
+
+
+/**
+ * Private function that finds a stream's first sample to draw
+ * That is the oldest sample kept, or with a window the first one inside it,
+ * found by bisection since x only grows.
+ * 
+ * @param   stream  the stream
+ * @param   head    the stream's head when this frame started
+ */
+uint32_t Graph::firstShown(const Stream& stream, uint32_t head){
+    uint32_t first = PlotStream::getOldest(head);
+    if(this->window <= 0) return first;
+
+    uint32_t last = head;
+    while(first < last){
+        uint32_t middle = first + (last - first) / 2;
+        if(stream.samples->getX(middle) < this->windowLeft) first = middle + 1;
+        else last = middle;
+    }
+    return first;
+}
+
+
+/**
+ * Private function that draws a stream's samples from the last one drawn up to head
+ * The first new line starts at the last sample already drawn, so the trace stays joined
+ * 
+ * @param   stream  the stream to draw
+ * @param   head    the stream's head when this frame started
+ */
+void Graph::drawSamples(Stream& stream, uint32_t head){
+    uint32_t first = this->firstShown(stream, head);
+    if(stream.drawn < first) stream.drawn = first;
+    if(stream.drawn == head) return;
+
+    this->Brain_Screen->setPenColor(stream.color);
+    StreamPixels pixels(stream.samples, this->getTransform(), stream.drawn > first ? stream.drawn - 1 : stream.drawn, head);
+    if(head - pixels.sample == 1){
+        int x;
+        int y;
+        if(pixels.next(x, y)) this->Brain_Screen->drawCircle(x, y, stream.thickness);
+    }
+    else{
+        this->Brain_Screen->setPenWidth(stream.thickness);
+        this->drawColumns(pixels);
+    }
+    stream.drawn = head;
+}
+
+
+/**
+ * Private function that fits the scale to every kept sample with room to grow
+ * The x axis gets half again its span to the right, the y axis a tenth above and below,
+ * so a trace growing over time rescales a handful of times rather than every frame
+ * 
+ * @param   heads   each stream's head when this frame started
+ */
+void Graph::rescaleStreams(const uint32_t* heads){
+    bool found = false;
+    float minX = 0;
+    float maxX = 0;
+    float minY = 0;
+    float maxY = 0;
+    for(int i = 0; i < this->streamCount; i++){
+        const PlotStream* samples = this->streams[i].samples;
+        for(uint32_t sample = PlotStream::getOldest(heads[i]); sample < heads[i]; sample++){
+            float x = samples->getX(sample);
+            float y = samples->getY(sample);
+            if(!found){
+                minX = maxX = x;
+                minY = maxY = y;
+                found = true;
+            }
+            if(x < minX) minX = x;
+            if(x > maxX) maxX = x;
+            if(y < minY) minY = y;
+            if(y > maxY) maxY = y;
+        }
+    }
+    if(!found) return;
+
+    float xSpan = maxX > minX ? maxX - minX : 1;
+    float ySpan = maxY > minY ? maxY - minY : 1;
+    this->setScale((this->outline.maxXPixel - this->outline.minXPixel) / (1.5f * xSpan), \
+        (this->outline.maxYPixel - this->outline.minYPixel) / (1.2f * ySpan), minX, minY - 0.1f * ySpan);
+}
+
+
+/**
+ * Private function that fits the scale to the window
+ * A sample past the right edge jumps the window forward by at least half its span,
+ * so the plot is drawn from scratch once per half window instead of scrolling every
+ * frame. The y axis fits the samples still inside, read off each stream's rolling
+ * extent without looking at the samples, with a tenth of room above and below.
+ * An extent that ran out of room is filled again from the stream's kept samples.
+ */
+void Graph::fitWindow(){
+    if(!this->hasScale) this->windowLeft = this->newestX;
+    else if(this->newestX > this->windowLeft + this->window) this->windowLeft = this->newestX - this->window / 2;
+
+    bool found = false;
+    float minY = 0;
+    float maxY = 0;
+    for(int i = 0; i < this->streamCount; i++){
+        Stream& stream = this->streams[i];
+        RollingExtent<PlotStream::capacity>& extent = *stream.extent;
+        extent.evictBefore(this->windowLeft);
+        if(!extent.isComplete()){
+            // it forgot a point to make room, so it starts over from the samples still kept inside the window
+            extent.clear();
+            for(uint32_t sample = this->firstShown(stream, stream.fed); sample < stream.fed; sample++){
+                extent.push(stream.samples->getX(sample), stream.samples->getY(sample));
+            }
+        }
+        if(extent.isEmpty()) continue;
+        if(!found || extent.getMin() < minY) minY = extent.getMin();
+        if(!found || extent.getMax() > maxY) maxY = extent.getMax();
+        found = true;
+    }
+    if(!found) return;
+
+    float ySpan = maxY > minY ? maxY - minY : 1;
+    this->setScale((this->outline.maxXPixel - this->outline.minXPixel) / this->window, \
+        (this->outline.maxYPixel - this->outline.minYPixel) / (1.2f * ySpan), this->windowLeft, minY - 0.1f * ySpan);
+}
+
+
+/**
+ * Public function that adds a PlotStream for drawStreams and the graph's task to draw
+ * 
+ * @param   samples     the stream, pushed to by another task
+ * @param   color       the color of its trace
+ * @param   thickness   the thickness, in pixels, of its trace
+ * 
+ * @return  false if the graph already has maxStreams streams
+ */
+bool Graph::addStream(PlotStream* samples, vex::color color, int thickness){
+    if(this->streamCount == maxStreams) return false;
+    Stream& stream = this->streams[this->streamCount++];
+    stream.samples = samples;
+    stream.color = color;
+    stream.thickness = thickness;
+    stream.drawn = 0;
+    stream.fed = 0;
+    stream.extent = this->window > 0 ? new RollingExtent<PlotStream::capacity>() : 0;
+    this->needsRedraw = true;
+    return true;
+}
+
+
+/**
+ * Public function that makes the streams scroll, showing only their newest samples
+ * The y axis then follows what is inside the window instead of everything ever drawn.
+ * Samples must be pushed with x growing, like time. Set it before start.
+ * Each stream gets its rolling extent here, about 16 KB, and gives it back with a span of 0.
+ * 
+ * @param   span    the x span shown, in units, or 0 to fit every sample kept
+ */
+void Graph::setWindow(float span){
+    this->window = span > 0 ? span : 0;
+    for(int i = 0; i < this->streamCount; i++){
+        Stream& stream = this->streams[i];
+        stream.fed = 0;
+        if(this->window > 0 && !stream.extent) stream.extent = new RollingExtent<PlotStream::capacity>();
+        else if(this->window == 0){
+            delete stream.extent;
+            stream.extent = 0;
+        }
+        if(stream.extent) stream.extent->clear();
+    }
+    this->hasScale = false;
+    this->needsRedraw = true;
+}
+
+
+/**
+ * Public function that draws what the streams gained since the last call
+ * Only the new line segments are drawn. A sample outside the plot rescales it, or
+ * with a window moves the window, and then only the graph's own rectangle is cleared
+ * and drawn again.
+ * 
+ * @return  true if anything was drawn
+ */
+bool Graph::drawStreams(){
+    uint32_t heads[maxStreams];
+    bool changed = false;
+    bool outside = false;
+    for(int i = 0; i < this->streamCount; i++){
+        Stream& stream = this->streams[i];
+        heads[i] = stream.samples->getHead();
+        uint32_t oldest = PlotStream::getOldest(heads[i]);
+        if(stream.drawn < oldest) this->needsRedraw = true;
+
+        if(this->window > 0){
+            for(uint32_t sample = stream.fed > oldest ? stream.fed : oldest; sample < heads[i]; sample++){
+                float x = stream.samples->getX(sample);
+                stream.extent->push(x, stream.samples->getY(sample));
+                if(x > this->newestX || !this->hasScale) this->newestX = x;
+            }
+            stream.fed = heads[i];
+        }
+
+        for(uint32_t sample = stream.drawn > oldest ? stream.drawn : oldest; sample < heads[i] && !outside; sample++){
+            outside = !this->contains(stream.samples->getX(sample), stream.samples->getY(sample));
+        }
+        changed = changed || heads[i] != stream.drawn;
+    }
+
+    if(outside){
+        if(this->window > 0) this->fitWindow();
+        else this->rescaleStreams(heads);
+        this->needsRedraw = true;
+    }
+    if(this->needsRedraw){
+        this->drawOutline();
+        for(int i = 0; i < this->streamCount; i++){
+            this->streams[i].drawn = 0;
+            this->drawSamples(this->streams[i], heads[i]);
+        }
+        this->needsRedraw = false;
+        this->redraws++;
+        return true;
+    }
+
+    for(int i = 0; i < this->streamCount; i++) this->drawSamples(this->streams[i], heads[i]);
+    return changed;
+}
+
+
+/**
+ * Private function that runs the graph's task, drawing the streams and rendering at most once a frame
+ */
+int Graph::run(void* arg){
+    Graph* graph = (Graph*)arg;
+    LoopTimer loop(graph->framePeriod);
+    while(graph->isRunning.load()){
+        if(graph->drawStreams()){
+            graph->Brain_Screen->render();
+            graph->frames++;
+        }
+        loop.wait();
+    }
+    return 0;
+}
+
+
+/**
+ * Public function that draws the outline and starts drawing the streams on a low priority task
+ * The first render switches the screen to double buffering, after that nothing drawn
+ * shows until the graph renders a frame. A frame is only rendered when a stream grew.
+ * 
+ * @param   framesPerSecond the most frames rendered each second
+ */
+void Graph::start(int framesPerSecond){
+    if(this->isRunning.load()) return;
+    this->framePeriod = framesPerSecond > 0 && framesPerSecond < 1000 ? 1000 / framesPerSecond : 1;
+    this->drawOutline();
+    this->needsRedraw = true;
+
+    this->isRunning.store(true);
+    this->task = vex::thread(Graph::run, this);
+    this->task.setPriority(vex::thread::threadPriorityLow);
+}
+
+
+/**
+ * Public function that stops the graph's task
+ */
+void Graph::stop(){
+    if(!this->isRunning.load()) return;
+    this->isRunning.store(false);
+    this->task.join();
+}
+
+
+/**
+ * Getter for the number of frames rendered by the graph's task
+ */
+uint32_t Graph::getFrames(){
+    return this->frames;
+}
+
+
+/**
+ * Getter for the number of times the streams were drawn from scratch
+ */
+uint32_t Graph::getRedraws(){
+    return this->redraws;
 }
 
 
@@ -132,6 +649,15 @@ void Graph::autoScale(std::vector<std::vector<float>> data){
  * 
  * @param   Brain_Screen    a pointer to the brain's lcd screen
  */
-Graph::Graph(vex::brain::lcd* Brain_Screen){
+Graph::Graph(vex::brain::lcd* Brain_Screen) : isRunning(false){
     this->Brain_Screen = Brain_Screen;
+}
+
+
+/**
+ * Destructor method, stops the graph's task and gives back the streams' rolling extents
+ */
+Graph::~Graph(){
+    this->stop();
+    for(int i = 0; i < this->streamCount; i++) delete this->streams[i].extent;
 }
\ No newline at end of file
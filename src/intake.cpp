@@ -0,0 +1,189 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       intake.cpp                                                */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Intake and color sort state machine source code           */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include "intake.h"
+
+/**
+ * Private function that moves to a state and starts its timeout
+ */
+void Intake::enter(IntakeState state, uint32_t now){
+    this->state = state;
+    this->stateStart = now;
+}
+
+/**
+ * Private function that checks whether a hue is one a sort acts on
+ */
+bool Intake::matches(const Sort& sort, float hue){
+    return hue > sort.minHue && hue < sort.maxHue;
+}
+
+/**
+ * Sets the rings thrown off the back of the hook, the opponent's
+ *
+ * @param   minHue          the lowest hue sorted, not included
+ * @param   maxHue          the highest hue sorted, not included
+ * @param   forwardDegrees  how far the hook carries the ring before reversing
+ * @param   returnDegrees   where the hook reverses back to, from where the ring was seen
+ */
+void Intake::setEject(float minHue, float maxHue, float forwardDegrees, float returnDegrees){
+    this->eject.minHue = minHue;
+    this->eject.maxHue = maxHue;
+    this->eject.forwardDegrees = forwardDegrees;
+    this->eject.returnDegrees = returnDegrees;
+}
+
+/**
+ * Sets the rings redirected once Y arms it, our own
+ * Redirect mode turns itself off after one ring.
+ *
+ * @param   minHue          the lowest hue redirected, not included
+ * @param   maxHue          the highest hue redirected, not included
+ * @param   forwardDegrees  how far the hook carries the ring before reversing
+ * @param   returnDegrees   where the hook reverses back to, from where the ring was seen
+ */
+void Intake::setRedirect(float minHue, float maxHue, float forwardDegrees, float returnDegrees){
+    this->redirect.minHue = minHue;
+    this->redirect.maxHue = maxHue;
+    this->redirect.forwardDegrees = forwardDegrees;
+    this->redirect.returnDegrees = returnDegrees;
+}
+
+/**
+ * Sets how long each state may wait on the hook
+ *
+ * @param   armMilliseconds     the most time to carry a ring forward
+ * @param   ejectMilliseconds   the most time to reverse
+ * @param   recoverMilliseconds the most time to ignore a ring still at the sensor after a sort
+ */
+void Intake::setTimeouts(uint32_t armMilliseconds, uint32_t ejectMilliseconds, uint32_t recoverMilliseconds){
+    this->armTimeout = armMilliseconds;
+    this->ejectTimeout = ejectMilliseconds;
+    this->recoverTime = recoverMilliseconds;
+}
+
+/**
+ * Runs one tick, call it every loop
+ * Handles the buttons, advances at most one state and sets both motors.
+ *
+ * @param   input   the buttons and the optical sensor read this tick
+ */
+void Intake::update(const IntakeInput& input){
+    uint32_t now = vex::timer::system();
+    if(input.toggle && !this->wasToggle) this->isOn = !this->isOn;
+    if(input.redirect && !this->wasRedirect) this->redirectMode = !this->redirectMode;
+    this->wasToggle = input.toggle;
+    this->wasRedirect = input.redirect;
+
+    bool sorting = this->state == IntakeState::armingEject || this->state == IntakeState::ejecting;
+    if(sorting && (input.reverse || !this->isOn)) this->enter(IntakeState::recovering, now);
+
+    float position = this->Hook->position(vex::degrees);
+    switch(this->state){
+        case IntakeState::idle:
+        case IntakeState::intaking:
+            if(!this->isOn){
+                if(this->state != IntakeState::idle) this->enter(IntakeState::idle, now);
+                break;
+            }
+            if(this->state != IntakeState::intaking) this->enter(IntakeState::intaking, now);
+            if(input.reverse || !input.nearObject) break;
+
+            if(matches(this->eject, input.hue)) this->sort = &this->eject;
+            else if(this->redirectMode && matches(this->redirect, input.hue)) this->sort = &this->redirect;
+            else break;
+            this->sortStart = position;
+            this->enter(IntakeState::armingEject, now);
+            break;
+
+        case IntakeState::armingEject:
+            if(position > this->sortStart + this->sort->forwardDegrees) this->enter(IntakeState::ejecting, now);
+            else if(now - this->stateStart >= this->armTimeout){
+                this->timeouts++;
+                this->enter(IntakeState::recovering, now);
+            }
+            break;
+
+        case IntakeState::ejecting:
+            if(position < this->sortStart + this->sort->returnDegrees){
+                if(this->sort == &this->redirect) this->redirectMode = false;
+                this->enter(IntakeState::recovering, now);
+            }
+            else if(now - this->stateStart >= this->ejectTimeout){
+                this->timeouts++;
+                this->enter(IntakeState::recovering, now);
+            }
+            break;
+
+        case IntakeState::recovering:
+            if(!input.nearObject || now - this->stateStart >= this->recoverTime){
+                this->enter(this->isOn ? IntakeState::intaking : IntakeState::idle, now);
+            }
+            break;
+    }
+
+    if(this->state == IntakeState::ejecting){
+        this->Hook->spin(vex::reverse, 100, vex::percent);
+        this->Front->spin(vex::reverse, 100, vex::percent);
+    }
+    else if(this->state == IntakeState::armingEject){
+        this->Hook->spin(vex::fwd, 100, vex::percent);
+        this->Front->spin(vex::fwd, 100, vex::percent);
+    }
+    else if(input.reverse){
+        this->Hook->spin(vex::reverse, 100, vex::percent);
+        this->Front->spin(vex::reverse, 100, vex::percent);
+    }
+    else if(this->isOn){
+        this->Hook->spin(vex::fwd, 100, vex::percent);
+        this->Front->spin(vex::fwd, 100, vex::percent);
+    }
+    else{
+        this->Hook->stop();
+        this->Front->stop();
+    }
+}
+
+/**
+ * Getter for the state the last tick left the intake in
+ */
+IntakeState Intake::getState(){
+    return this->state;
+}
+
+/**
+ * Getter for whether L1 has the intake running
+ */
+bool Intake::getIsOn(){
+    return this->isOn;
+}
+
+/**
+ * Getter for whether the next own ring will be redirected
+ */
+bool Intake::getRedirectMode(){
+    return this->redirectMode;
+}
+
+/**
+ * Getter for the number of sorts that gave up on a jammed hook
+ */
+uint32_t Intake::getTimeouts(){
+    return this->timeouts;
+}
+
+/**
+ * Constructor method
+ *
+ * @param   Hook    the hook motor, its position tracks the ring being sorted
+ * @param   Front   the front intake motor, run with the hook
+ */
+Intake::Intake(vex::motor* Hook, vex::motor* Front){
+    this->Hook = Hook;
+    this->Front = Front;
+}
@@ -0,0 +1,120 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       logformat.cpp                                             */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Binary telemetry log writer source code                   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include "logformat.h"
+
+namespace logformat{
+
+/**
+ * Private function that writes a length prefixed name
+ */
+static uint32_t putName(uint8_t* out, const char* name){
+    uint32_t length = strlen(name);
+    if(length > 255) length = 255;
+    out[0] = (uint8_t)length;
+    memcpy(out + 1, name, length);
+    return length + 1;
+}
+
+/**
+ * Writes the file header with the schema in channels
+ *
+ * @param   out         where to write
+ * @param   capacity    the room at out, in bytes
+ *
+ * @return  the header's length, or 0 if it does not fit
+ */
+uint32_t writeHeader(uint8_t* out, uint32_t capacity){
+    uint32_t needed = 6;
+    for(int i = 0; i < channelCount; i++){
+        needed += 3 + strlen(channels[i].name);
+        for(int j = 0; j < channels[i].fieldCount; j++) needed += 5 + strlen(channels[i].fields[j].name);
+    }
+    if(needed > capacity) return 0;
+
+    uint32_t length = 0;
+    memcpy(out, magic, 4);
+    out[4] = version;
+    out[5] = (uint8_t)channelCount;
+    length = 6;
+    for(int i = 0; i < channelCount; i++){
+        out[length++] = channels[i].id;
+        out[length++] = channels[i].fieldCount;
+        length += putName(out + length, channels[i].name);
+        for(int j = 0; j < channels[i].fieldCount; j++){
+            length += putName(out + length, channels[i].fields[j].name);
+            memcpy(out + length, &channels[i].fields[j].scale, 4);
+            length += 4;
+        }
+    }
+    return length;
+}
+
+/**
+ * Encodes records as one block
+ * Records on a channel the schema does not have, or from a source past 15, are left out.
+ *
+ * @param   records the records, in the order they are to be read back
+ * @param   count   the number of records
+ * @param   out     where to write, room for count * maxRecordBytes + maxBlockOverhead bytes
+ *
+ * @return  the block's length, in bytes
+ */
+uint32_t encodeBlock(const TelemetryRecord* records, uint32_t count, uint8_t* out){
+    const Channel* schema[maxChannels] = {};
+    for(int i = 0; i < channelCount; i++) schema[channels[i].id % maxChannels] = &channels[i];
+
+    int32_t previous[maxChannels][maxFields] = {};
+    int32_t sequences[maxSources];
+    for(int i = 0; i < maxSources; i++) sequences[i] = -1;
+
+    // the payload goes after the largest possible block header, and moves down once the header is known
+    uint8_t* payload = out + maxBlockOverhead - 2;
+    uint8_t* cursor = payload;
+    uint32_t base = count > 0 ? records[0].timestamp : 0;
+    uint32_t time = base;
+    uint32_t encoded = 0;
+    for(uint32_t i = 0; i < count; i++){
+        const TelemetryRecord& record = records[i];
+        const Channel* channel = record.channel < maxChannels ? schema[record.channel] : 0;
+        if(!channel || record.source >= maxSources) continue;
+
+        *cursor++ = (uint8_t)(record.source << 4 | record.channel);
+        int32_t& sequence = sequences[record.source];
+        cursor += putVarint(cursor, sequence < 0 ? record.sequence : (uint16_t)(record.sequence - sequence - 1));
+        sequence = record.sequence;
+        cursor += putVarint(cursor, zigzag((int32_t)(record.timestamp - time)));
+        time = record.timestamp;
+
+        int32_t* last = previous[record.channel];
+        for(int j = 0; j < channel->fieldCount; j++){
+            int32_t value = quantize(record.values[j], channel->fields[j].scale);
+            cursor += putVarint(cursor, zigzag((int32_t)((uint32_t)value - (uint32_t)last[j])));
+            last[j] = value;
+        }
+        encoded++;
+    }
+    uint32_t payloadLength = cursor - payload;
+
+    uint8_t header[maxBlockOverhead];
+    uint32_t headerLength = 4;
+    memcpy(header, syncMarker, 4);
+    headerLength += putVarint(header + headerLength, payloadLength);
+    headerLength += putVarint(header + headerLength, encoded);
+    headerLength += putVarint(header + headerLength, base);
+
+    memmove(out + headerLength, payload, payloadLength);
+    memcpy(out, header, headerLength);
+    // the header's lengths and timestamp are covered too, a damaged count or base timestamp fails the block
+    uint16_t sum = checksum(out + 4, headerLength - 4 + payloadLength);
+    out[headerLength + payloadLength] = (uint8_t)sum;
+    out[headerLength + payloadLength + 1] = (uint8_t)(sum >> 8);
+    return headerLength + payloadLength + 2;
+}
+
+}
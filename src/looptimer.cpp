@@ -0,0 +1,98 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       looptimer.cpp                                             */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Fixed rate loop timer source code                         */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include "looptimer.h"
+
+/**
+ * Constructor method
+ * Starts timing immediately
+ *
+ * @param   periodMilliseconds  the desired time between ticks, in milliseconds
+ */
+LoopTimer::LoopTimer(uint32_t periodMilliseconds){
+    this->periodMilliseconds = periodMilliseconds;
+    this->start();
+}
+
+/**
+ * Restarts the timer and clears the statistics
+ * The first deadline is one period from now
+ */
+void LoopTimer::start(){
+    this->startTime = vex::timer::systemHighResolution();
+    this->previousTick = this->startTime;
+    this->nextDeadline = this->startTime / 1000 + this->periodMilliseconds;
+    this->dt = this->periodMilliseconds / 1000.0f;
+    this->jitterSum = 0;
+    this->stats = LoopStats();
+}
+
+/**
+ * Sleeps until the next tick
+ * Deadlines are absolute, so time spent in the loop body does not stretch the period.
+ * If the body ran past the deadline the tick is an overrun, the loop runs again
+ * immediately and the missed deadlines are skipped rather than made up in a burst.
+ *
+ * @return  the measured time since the previous tick, in seconds
+ */
+float LoopTimer::wait(){
+    uint32_t now = vex::timer::system();
+    if((int32_t)(this->nextDeadline - now) > 0){
+        vex::this_thread::sleep_for(this->nextDeadline - now);
+    }
+    else{
+        this->stats.overruns++;
+        while((int32_t)(this->nextDeadline - now) <= 0) this->nextDeadline += this->periodMilliseconds;
+        this->nextDeadline -= this->periodMilliseconds;
+    }
+
+    uint64_t tick = vex::timer::systemHighResolution();
+    float jitter = (float)((int64_t)tick - (int64_t)this->nextDeadline * 1000) / 1e6f;
+    if(jitter < 0) jitter = -jitter;
+    this->nextDeadline += this->periodMilliseconds;
+
+    this->dt = (tick - this->previousTick) / 1e6f;
+    this->previousTick = tick;
+
+    this->stats.ticks++;
+    this->stats.elapsed = (tick - this->startTime) / 1e6f;
+    this->stats.meanDt = this->stats.elapsed / this->stats.ticks;
+    if(this->dt > this->stats.maxDt) this->stats.maxDt = this->dt;
+    this->jitterSum += jitter;
+    this->stats.meanJitter = this->jitterSum / this->stats.ticks;
+    if(jitter > this->stats.maxJitter) this->stats.maxJitter = jitter;
+
+    return this->dt;
+}
+
+/**
+ * Getter for the length of the last tick
+ *
+ * @return  the measured time between the last two ticks, in seconds
+ */
+float LoopTimer::getDt(){
+    return this->dt;
+}
+
+/**
+ * Getter for the time since the timer started
+ *
+ * @return  the time from start() to the last tick, in seconds
+ */
+float LoopTimer::getElapsed(){
+    return this->stats.elapsed;
+}
+
+/**
+ * Getter for the timing statistics
+ *
+ * @return  tick count, overruns, dt and jitter since start()
+ */
+LoopStats LoopTimer::getStats(){
+    return this->stats;
+}
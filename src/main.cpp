@@ -10,6 +10,8 @@
 #include "vex.h"
 #include "odom.h"
 #include "drivetrain.h"
+#include "telemetry.h"
+#include "intake.h"
 
 using namespace vex;
 
@@ -49,13 +51,13 @@ brain Brain;
 led ClampMotor = led(Brain.ThreeWirePort.A);
 led RatchetMotor = led(Brain.ThreeWirePort.B);
 
+// Telemetry, drained to the SD card by a low priority task and written at least every 250 ms
+Telemetry telemetry(&Brain.SDcard, "telemetry.bin");
+TelemetryRing* intakeTelemetry = 0;
+
 // Control Variables
-bool toggle = false;
 bool wasPressing = false;
-bool L1wasPressing = false;
 bool XwasPressing = false;
-bool wasYPressing = false; 
-bool redirectMode = false;
 
 
 //Limit swtich 
@@ -71,78 +73,35 @@ bool isRed = true;
 vex::thread redirectThread;
 
 
-void intake_Functionality() {
-  while(true){
-
-    // Toggle Intake Motors on Button Up Press
-    if (Controller.ButtonL1.pressing() && !L1wasPressing) {
-      toggle = !toggle;
-    }
-
-    // Hold-to-Reverse functionality for Intake Motors (Button Down)
-    if (Controller.ButtonL2.pressing()) {
-      HookIntake.spin(reverse, 100, percent);
-      FrontIntake.spin(reverse, 100, percent);
-    } else if (toggle) {
-      // Run Intake Motors Forward if toggled
-      HookIntake.spin(fwd, 100, percent);
-      FrontIntake.spin(fwd, 100, percent);
-    } else {
-      // Stop Intake Motors if not toggled and Button Down not pressed
-      HookIntake.stop();
-      FrontIntake.stop();
-    }
-
-    // Check for Y button press to toggle redirect mode
-
-    if (Controller.ButtonY.pressing() && !wasYPressing) {
-      redirectMode = !redirectMode; // Toggle redirect mode on button press
-    }
-    wasYPressing = Controller.ButtonY.pressing(); // Update previous state of Y button
-    L1wasPressing = Controller.ButtonL1.pressing();
+// Intake and color sort, advanced once a tick by intake_Functionality
+Intake intake(&HookIntake, &FrontIntake);
 
 
-    // If in redirect mode and the obtical senses color 
-    if (Optical17.isNearObject()) {
+void intake_Functionality() {
+  LoopTimer loop(10);
+  while(true){
+    // Read the driver and the optical sensor once, the intake never blocks so every press is seen next tick
+    IntakeInput input;
+    input.toggle = Controller.ButtonL1.pressing();
+    input.reverse = Controller.ButtonL2.pressing();
+    input.redirect = Controller.ButtonY.pressing();
+    input.nearObject = Optical17.isNearObject();
+    input.hue = Optical17.hue();
+    intake.update(input);
+
+    if (input.nearObject) {
       Optical17.setLightPower(100);
       Optical17.setLight(ledState::on);
-      
-      if (Optical17.hue() > 180 && Optical17.hue() < 240) {
-        float targetPosition = HookIntake.position(degrees) + 58; // Fine-tune this value
-        float backTargetPosition = targetPosition - 3;
-
-        // Wait until the intake reaches the desired position, then reverse to eject
-        if (Optical17.hue() > 180 && Optical17.hue() < 240 && HookIntake.position(degrees) < targetPosition){
-          waitUntil(HookIntake.position(degrees) > targetPosition);
-        }
-        waitUntil(HookIntake.position(degrees) > targetPosition);
-        HookIntake.spin(reverse, 100, percent);
-        FrontIntake.spin(reverse, 100, percent);
-
-        // Wait until the intake returns to the starting position
-        waitUntil(HookIntake.position(degrees) < backTargetPosition);
-      }
-
-
-
-
-      
-      if(((isRed && Optical17.hue() > 0 && Optical17.hue() < 30) \
-      || (!isRed && Optical17.hue() > 180 && Optical17.hue() < 240)) && redirectMode){
-        float targetPosition = HookIntake.position(degrees) + 20.215; //tuneable
-        float backTargetPosition = HookIntake.position(degrees) - 350;
-        waitUntil(HookIntake.position(degrees) > targetPosition);
-        HookIntake.spin(reverse, 100, percent); // Spin the hook intake
-        FrontIntake.spin(reverse, 100, percent); // Spin the front intake
-        waitUntil(HookIntake.position(degrees) < backTargetPosition);
-        redirectMode = false; // Optionally reset redirect mode after action
-        }
     }
     else{
       Optical17.setLight(ledState::off);
     }
-    
-    vex::this_thread::sleep_for(10);  // Small delay 
+
+    if (intakeTelemetry) {
+      intakeTelemetry->push(TelemetryChannel::intake, intake.getIsOn(), intake.getRedirectMode(), input.hue, HookIntake.position(degrees));
+    }
+
+    loop.wait();
   }
 }
 
@@ -206,6 +165,18 @@ void pre_auton(void) {
   // Example: clearing encoders, setting servo positions, ...
 
   Optical17.setLightPower(100, percent);
+
+  // Throw the opponent's rings off the hook, redirect our own once Y arms it
+  if (isRed) {
+    intake.setEject(180, 240, 58, 55);
+    intake.setRedirect(0, 30, 20.215, -350);
+  } else {
+    intake.setEject(0, 30, 58, 55);
+    intake.setRedirect(180, 240, 20.215, -350);
+  }
+
+  intakeTelemetry = telemetry.addProducer();
+  telemetry.start();
 }
 
 //------------------------------------------------------------------------------
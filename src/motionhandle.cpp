@@ -0,0 +1,88 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       motionhandle.cpp                                          */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Background chassis motion handle source code              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <math.h>
+#include "motionhandle.h"
+#include "drivetrain.h"
+
+/**
+ * Constructor method for a handle to no motion, every wait returns right away
+ */
+MotionHandle::MotionHandle(){
+    this->Chassis = 0;
+    this->id = 0;
+}
+
+/**
+ * Constructor method
+ *
+ * @param   Chassis the chassis running the motion
+ * @param   id      the motion's number, counted up by every async motion on the chassis
+ */
+MotionHandle::MotionHandle(chassis* Chassis, uint32_t id){
+    this->Chassis = Chassis;
+    this->id = id;
+}
+
+/**
+ * Whether the motion is still driving the robot
+ */
+bool MotionHandle::isRunning(){
+    if(!this->Chassis) return false;
+    return this->Chassis->finishedMotion.load() < this->id;
+}
+
+/**
+ * Blocks until the motion settles, times out or is cancelled
+ *
+ * @return  the time the motion took, or 0 if another motion has finished since
+ */
+float MotionHandle::waitUntilSettled(){
+    while(this->isRunning()) vex::task::sleep(5);
+    if(!this->Chassis || this->Chassis->finishedMotion.load() != this->id) return 0;
+    return this->Chassis->motionTime;
+}
+
+/**
+ * Blocks until the robot has driven a distance since the motion started, or the motion ends
+ * Distance is measured the way driveFor measures it, forward or backward both count.
+ *
+ * @param   inches  the distance to wait for, in inches
+ */
+void MotionHandle::waitUntilTraveled(float inches){
+    while(this->isRunning()){
+        float traveled = this->Chassis->trackedDistance(this->Chassis->Sensors->getFrame()) - this->Chassis->motionStartDistance;
+        if(fabsf(traveled) >= inches) return;
+        vex::task::sleep(5);
+    }
+}
+
+/**
+ * Blocks until the robot reaches or turns past a heading, or the motion ends
+ * Passing counts so a fast turn cannot step over the heading between checks.
+ *
+ * @param   heading the heading to wait for, in degrees
+ */
+void MotionHandle::waitUntilHeading(float heading){
+    if(!this->isRunning()) return;
+    float startError = this->Chassis->restrain(heading - this->Chassis->Sensors->getFrame().heading, -180, 180);
+    while(this->isRunning()){
+        float error = this->Chassis->restrain(heading - this->Chassis->Sensors->getFrame().heading, -180, 180);
+        if(fabsf(error) < 1) return;
+        // a sign change far from the heading is the error wrapping around behind the robot
+        if((error > 0) != (startError > 0) && fabsf(error) < 90) return;
+        vex::task::sleep(5);
+    }
+}
+
+/**
+ * Stops the motion at its next tick, the chassis stops the way the motion would when it settles
+ */
+void MotionHandle::cancel(){
+    if(this->isRunning()) this->Chassis->cancelledMotion.store(this->id);
+}
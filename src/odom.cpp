@@ -21,95 +21,157 @@ float odom::degToRad(float deg){
 }
 
 /**
- * Starts and contains the odometry loop
- * Updates at a constant rate defined by user
+ * Private function that makes the next update measure change from this frame
+ * 
+ * @param   frame   the sensor readings to measure from
+ */
+void odom::resetTracking(const SensorFrame &frame){
+    this->previousVertical = frame.vertical * this->verticalInchesPerDegree;
+    this->previousHorizontal = frame.horizontal * this->horizontalInhcesPerDegree;
+    this->previousHeading = odom::degToRad(frame.rotation);
+    this->rebase = false;
+}
+
+/**
+ * Advances the robot position by one frame of sensor readings and publishes it
  * Based on the 5225 Pilons odometry: http://thepilons.ca/wp-content/uploads/2018/10/Tracking.pdf
+ * 
+ * @param   frame   the sensor readings for this update
  */
-void odom::start(){
-    this->isRunning = true;
+void odom::update(const SensorFrame &frame){
+    if(this->usesEKF){
+        this->filter.update(frame);
+        this->pose = this->filter.getPose();
+        this->publishedPose.write(this->pose);
+        this->history.push(this->pose);
+        return;
+    }
+
+    if(this->rebase) this->resetTracking(frame);
+
+    float verticalPosition = frame.vertical * this->verticalInchesPerDegree;
+    float horizontalPosition = frame.horizontal * this->horizontalInhcesPerDegree;
+    float heading = odom::degToRad(frame.rotation);
+    this->pose.heading = frame.heading;
+    this->pose.timestamp = frame.timestamp;
 
-    float previousVertical;
-    float previousHorizontal;
-    if(this->usesRotation){
-        previousVertical = this->verticalRotation->position(vex::rotationUnits::deg) \
-            * this->verticalInchesPerDegree;
-        previousHorizontal = this->horizontalRotation->position(vex::rotationUnits::deg) \
-            * this->horizontalInhcesPerDegree;
+    float changeInVertical = verticalPosition - this->previousVertical;
+    float changeInHorizontal = horizontalPosition - this->previousHorizontal;
+    float changeInHeading = heading - this->previousHeading;
+
+    float localX;
+    float localY;
+    if(changeInHeading == 0){
+        localX = changeInHorizontal;
+        localY = changeInVertical;
     }
     else{
-        previousVertical = this->verticalEncoder->position(vex::rotationUnits::deg) \
-            * this->verticalInchesPerDegree;
-        previousHorizontal = this->horizontalEncoder->position(vex::rotationUnits::deg) \
-            * this->horizontalInhcesPerDegree;
+        localX = (2 * sinf(changeInHeading / 2)) \
+            * ((changeInHorizontal / changeInHeading) + horizontalDistanceFromCenter);
+        localY = (2 * sinf(changeInHeading / 2)) \
+            * ((changeInVertical / changeInHeading) + verticalDistanceFromCenter);
     }
-    float previousHeading = odom::degToRad(this->Inertial->rotation(vex::rotationUnits::deg));
 
-    while(isRunning){
-        auto cycleStart = std::chrono::system_clock::now();
-
-        float verticalPosition;
-        float horizontalPosition;
-        if(this->usesRotation){
-            verticalPosition = this->verticalRotation->position(vex::rotationUnits::deg) \
-                * this->verticalInchesPerDegree;
-            horizontalPosition = this->horizontalRotation->position(vex::rotationUnits::deg) \
-                * this->horizontalInhcesPerDegree;
-        }
-        else{
-            verticalPosition = this->verticalEncoder->position(vex::rotationUnits::deg) \
-                * this->verticalInchesPerDegree;
-            horizontalPosition = this->horizontalEncoder->position(vex::rotationUnits::deg) \
-                * this->horizontalInhcesPerDegree;
-        }
-        float heading = odom::degToRad(this->Inertial->rotation(vex::rotationUnits::deg));
-        this->robotPosition.at(2) = this->Inertial->heading(vex::rotationUnits::deg);
-
-        float changeInVertical = verticalPosition - previousVertical;
-        float changeInHorizontal = horizontalPosition - previousHorizontal;
-        float changeInHeading = heading - previousHeading;
-
-        float localX;
-        float localY;
-        if(changeInHeading == 0){
-            localX = changeInHorizontal;
-            localY = changeInVertical;
-        }
-        else{
-            localX = (2 * sinf(changeInHeading / 2)) \
-                * ((changeInHorizontal / changeInHeading) + horizontalDistanceFromCenter);
-            localY = (2 * sinf(changeInHeading / 2)) \
-                * ((changeInVertical / changeInHeading) + verticalDistanceFromCenter);
-        }
+    float localPolarAngle;
+    float polarRadius;
+    if(localX == 0 && localY == 0){
+        localPolarAngle = 0;
+        polarRadius = 0;
+    }
+    else{
+        localPolarAngle = atan2f(localY, localX);
+        polarRadius = sqrtf(powf(localX, 2) + powf(localY, 2));
+    }
 
-        float localPolarAngle;
-        float polarRadius;
-        if(localX == 0 && localY == 0){
-            localPolarAngle = 0;
-            polarRadius = 0;
-        }
-        else{
-            localPolarAngle = atan2f(localY, localX);
-            polarRadius = sqrtf(powf(localX, 2) + powf(localY, 2));
-        }
+    float globalPolarAngle = localPolarAngle - this->previousHeading - (changeInHeading / 2);
 
-        float globalPolarAngle = localPolarAngle - previousHeading - (changeInHeading / 2);
+    this->previousVertical = verticalPosition;
+    this->previousHorizontal = horizontalPosition;
+    this->previousHeading = heading;
 
-        previousVertical = verticalPosition;
-        previousHorizontal = horizontalPosition;
-        previousHeading = heading;
+    float changeinX = polarRadius * cosf(globalPolarAngle);
+    float changeinY = polarRadius * sinf(globalPolarAngle);
 
-        float changeinX = polarRadius * cosf(globalPolarAngle);
-        float changeinY = polarRadius * sinf(globalPolarAngle);
+    this->pose.x += changeinX;
+    this->pose.y += changeinY;
+    this->publishedPose.write(this->pose);
+    this->history.push(this->pose);
+}
 
-        this->robotPosition.at(0) += changeinX;
-        this->robotPosition.at(1) += changeinY;
+/**
+ * Starts and contains the odometry loop
+ * Updates at a constant rate defined by user, using the frame shared through the sensor hub
+ */
+void odom::start(){
+    this->isRunning = true;
+    this->resetTracking(this->Sensors->getFrame());
 
-        auto timeElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - cycleStart).count();
+    LoopTimer loop(this->updateRateMilliseconds);
+    while(isRunning){
+        // a setter's change goes in before the frame is read, so the frame already has the new heading
+        if(this->resetState.load(std::memory_order_acquire) == resetPosted){
+            this->applyReset();
+            this->resetState.store(resetIdle, std::memory_order_release);
+        }
+        SensorFrame frame = this->Sensors->getFrame();
+        this->update(frame);
+        if(this->telemetry){
+            this->telemetry->push(TelemetryChannel::odom, this->pose.x, this->pose.y, this->pose.heading, loop.getDt(), this->loopStats.overruns,
+                this->resets.load(std::memory_order_relaxed));
+            this->telemetry->push(TelemetryChannel::sensors, frame.vertical, frame.horizontal, frame.left, frame.right, frame.rotation, frame.gyroRate);
+        }
 
-        vex::this_thread::sleep_for(this->updateRateMilliseconds - timeElapsed);
+        loop.wait();
+        this->loopStats = loop.getStats();
     }
 }
 
+/**
+ * Getter for the timing of the odometry loop
+ * 
+ * @return  tick count, overruns, measured dt and jitter since the loop started
+ */
+LoopStats odom::getLoopStats(){
+    return this->loopStats;
+}
+
+/**
+ * Records the pose, loop timing and sensor readings every update
+ * 
+ * @param   telemetry   a ring only the odometry task pushes to, or 0 to stop recording
+ */
+void odom::setTelemetry(TelemetryRing* telemetry){
+    this->telemetry = telemetry;
+}
+
+/**
+ * Switches the odometry loop from tracking wheel dead reckoning to the extended Kalman filter
+ * The filter fuses the tracking wheels, drive motor encoders, inertial heading and yaw rate,
+ * and keeps its estimate when the drive wheels slip or the robot is pushed
+ * 
+ * @param   driveInchesPerDegree    The number of inches the drive wheels travel per degree of motor rotation
+ * @param   trackWidth              The distance between the left and right drive wheels, in inches
+ * @param   settings                The noise and gating values of the filter
+ */
+void odom::useEKF(float driveInchesPerDegree, float trackWidth, EKFSettings settings){
+    this->filter = PoseEKF();
+    this->filter.setSettings(settings);
+    this->filter.setDrive(driveInchesPerDegree, trackWidth);
+    if(this->Sensors->hasVerticalTracking()) this->filter.setVerticalTracking(this->verticalDistanceFromCenter, this->verticalInchesPerDegree);
+    if(this->Sensors->hasHorizontalTracking()) this->filter.setHorizontalTracking(this->horizontalDistanceFromCenter, this->horizontalInhcesPerDegree);
+    this->filter.reset(this->pose.x, this->pose.y, this->pose.heading);
+    this->usesEKF = true;
+}
+
+/**
+ * Getter for the extended Kalman filter, for its covariance and rejection count
+ * 
+ * @return  the filter, only updated after useEKF
+ */
+PoseEKF* odom::getEKF(){
+    return &this->filter;
+}
+
 /**
  * Stops the odometry loop
  */
@@ -118,65 +180,68 @@ void odom::stop(){
 }
 
 /**
- * Constructor method using the vex V5 Rotation Sensors
- * Creates an odom object
+ * Constructor method
+ * Creates an odom object that reads its tracking wheels and inertial sensor through a sensor hub
  * 
- * @param   verticaRotation                 The V5 Rotation Sensor that is on the vertical tracking wheel
- * @param   horizontalRotation              The V5 Rotation Sensor that is on the horizontal tracking wheel
- * @param   Inertial                        The V5 Inertial sensor that is on the robot
+ * @param   Sensors                         The sensor hub with both tracking wheels configured
  * @param   verticalDistanceFromCenter      The physical distance from the tracking center to the vertical tracking wheel, in inches
  * @param   verticalIncherPerDegree         The number of inches per degree of rotation of the vertical tracking wheel
  * @param   horizontalDistanceFromCenter    The physical distance from the tracking center to the horizontal tracking wheel, in inches
  * @param   horizontalInchesPerDegree       The number of inches per degree of rotation of the horizontal tracking wheel
  * @param   updateRateMilliseconds          The desired time between cycles of the odometry loop, in milliseconds, generally 5 or 10
  */
-odom::odom(vex::rotation &verticalRotation, vex::rotation &horizontalRotation, vex::inertial &Inertial, \
-    float verticalDistanceFromCenter, float verticalInchesPerDegree, float horizontalDistanceFromCenter, \
-        float horizontalInchesPerDegree, int updateRateMilliseconds){
+odom::odom(SensorHub &Sensors, float verticalDistanceFromCenter, float verticalInchesPerDegree, \
+    float horizontalDistanceFromCenter, float horizontalInchesPerDegree, int updateRateMilliseconds) : isRunning(false), resets(0), resetState(resetIdle){
 
-    this->verticalRotation = &verticalRotation;
-    this->horizontalRotation = &horizontalRotation;
-    this->Inertial = &Inertial;
+    this->Sensors = &Sensors;
     this->verticalDistanceFromCenter = verticalDistanceFromCenter;
     this->verticalInchesPerDegree = verticalInchesPerDegree;
     this->horizontalDistanceFromCenter = horizontalDistanceFromCenter;
     this->horizontalInhcesPerDegree = horizontalInchesPerDegree;
     this->updateRateMilliseconds = updateRateMilliseconds;
-    this->usesRotation = true;
 }
 
 /**
- * Constructor method using the 3-Wire VEX Encoders
- * Creates an odom object
+ * Defualt constructor
+ */
+odom::odom() : isRunning(false), resets(0), resetState(resetIdle){};
+
+/**
+ * Getter for the latest published pose
+ * Never blocks the odometry loop and never allocates
  * 
- * @param   verticaEncoder                  The 3-Wire VEX Encoder that is on the vertical tracking wheel
- * @param   horizontalEncoder               The 3-wire VEX Encoder that is on the horizontal tracking wheel
- * @param   Inertial                        The V5 Inertial sensor that is on the robot
- * @param   verticalDistanceFromCenter      The physical distance from the tracking center to the vertical tracking wheel, in inches
- * @param   verticalIncherPerDegree         The number of inches per degree of rotation of the vertical tracking wheel
- * @param   horizontalDistanceFromCenter    The physical distance from the tracking center to the horizontal tracking wheel, in inches
- * @param   horizontalInchesPerDegree       The number of inches per degree of rotation of the horizontal tracking wheel
- * @param   updateRateMilliseconds          The desired time between cycles of the odometry loop, in milliseconds, generally 5 or 10
+ * @return  Pose containing (x, y, heading, timestamp) from a single odometry update
  */
-odom::odom(vex::encoder &verticalEncoder, vex::encoder &horizontalEncoder, vex::inertial &Inertial, \
-    float verticalDistanceFromCenter, float verticalInchesPerDegree, float horizontalDistanceFromCenter, \
-        float horizontalInchesPerDegree, int updateRateMilliseconds){
-            
-    this->verticalEncoder = &verticalEncoder;
-    this->horizontalEncoder = &horizontalEncoder;
-    this->Inertial = &Inertial;
-    this->verticalDistanceFromCenter = verticalDistanceFromCenter;
-    this->verticalInchesPerDegree = verticalInchesPerDegree;
-    this->horizontalDistanceFromCenter = horizontalDistanceFromCenter;
-    this->horizontalInhcesPerDegree = horizontalInchesPerDegree;
-    this->updateRateMilliseconds = updateRateMilliseconds;
-    this->usesRotation = false;
+Pose odom::getPose(){
+    Pose pose;
+    this->publishedPose.read(pose);
+    return pose;
 }
 
 /**
- * Defualt constructor
+ * Copies out the latest published pose along with its sequence number
+ * The sequence number increases with every update, so a consumer can tell a fresh pose from one it has already seen
+ * 
+ * @param   pose    where to copy the pose
+ * 
+ * @return  the sequence number of the copied pose
  */
-odom::odom(){};
+uint32_t odom::readPose(Pose &pose){
+    return this->publishedPose.read(pose);
+}
+
+/**
+ * Finds where the robot was at a past time, for matching sensors that report late
+ * Interpolates between the two odometry updates around the timestamp, the last 256 updates are kept
+ * 
+ * @param   timestamp   the time the reading was taken, vex::timer::systemHighResolution() in microseconds
+ * @param   pose        where to copy the pose, clamped to the oldest or newest kept pose when out of range
+ * 
+ * @return  false if the timestamp is not covered by the kept updates
+ */
+bool odom::poseAt(uint64_t timestamp, Pose &pose){
+    return this->history.poseAt(timestamp, pose);
+}
 
 /**
  * Getter for the full robot position
@@ -184,7 +249,8 @@ odom::odom(){};
  * @return  std::vector<float> containing robot position: (x, y, heading) in inches and degrees
  */
 std::vector<float> odom::getPosition(){
-    return this->robotPosition;
+    Pose pose = this->getPose();
+    return {pose.x, pose.y, pose.heading};
 }
 
 /**
@@ -193,7 +259,7 @@ std::vector<float> odom::getPosition(){
  * @return  float containing robot x position in inches
  */
 float odom::getX(){
-    return this->robotPosition.at(0);
+    return this->getPose().x;
 }
 
 /**
@@ -202,7 +268,7 @@ float odom::getX(){
  * @return  float containing robot y position in inches
  */
 float odom::getY(){
-    return this->robotPosition.at(1);
+    return this->getPose().y;
 }
 
 /**
@@ -211,23 +277,89 @@ float odom::getY(){
  * @return  float containing robot heading in degrees
  */
 float odom::getHeading(){
-    return this->robotPosition.at(2);
+    return this->getPose().heading;
+}
+
+/**
+ * Private function that publishes a pose changed by one of the setters
+ * Poses from before the change are in the old frame, so the history starts over,
+ * and the odom telemetry record counts the change so a replay can follow it
+ */
+void odom::publish(){
+    this->resets++;
+    this->pose.timestamp = vex::timer::systemHighResolution();
+    this->publishedPose.write(this->pose);
+    this->history.clear();
+    this->history.push(this->pose);
+}
+
+/**
+ * Private function that hands a change of the pose to the odometry task and waits for it to go in
+ * The odometry task is then the only one writing the pose, so readers never see half of a reset.
+ * With the loop not running the calling task applies it itself. Setters on different tasks take turns.
+ * 
+ * @param   x       the new x position in inches, if fields has PoseReset::x
+ * @param   y       the new y position in inches, if fields has PoseReset::y
+ * @param   heading the new heading in degrees, if fields has PoseReset::heading
+ * @param   fields  which of them to set
+ */
+void odom::requestReset(float x, float y, float heading, uint8_t fields){
+    uint8_t idle = resetIdle;
+    while(!this->resetState.compare_exchange_weak(idle, resetWriting, std::memory_order_acquire)){
+        idle = resetIdle;
+        vex::task::sleep(1);
+    }
+    this->pendingReset.values[0] = x;
+    this->pendingReset.values[1] = y;
+    this->pendingReset.values[2] = heading;
+    this->pendingReset.fields = fields;
+
+    if(!this->isRunning){
+        this->applyReset();
+        this->resetState.store(resetIdle, std::memory_order_release);
+        return;
+    }
+    this->resetState.store(resetPosted, std::memory_order_release);
+    while(this->resetState.load(std::memory_order_acquire) != resetIdle){
+        // the loop stopped before taking it, take it back and apply it here
+        uint8_t posted = resetPosted;
+        if(!this->isRunning && this->resetState.compare_exchange_strong(posted, resetWriting, std::memory_order_acquire)){
+            this->applyReset();
+            this->resetState.store(resetIdle, std::memory_order_release);
+            return;
+        }
+        vex::task::sleep(1);
+    }
+}
+
+/**
+ * Private function that applies the pending reset and publishes the new pose
+ * The next update measures from a new heading instead of seeing it as a turn
+ */
+void odom::applyReset(){
+    const PoseReset &reset = this->pendingReset;
+    if(reset.fields & PoseReset::x) this->pose.x = reset.values[0];
+    if(reset.fields & PoseReset::y) this->pose.y = reset.values[1];
+    if(reset.fields & PoseReset::heading){
+        this->pose.heading = reset.values[2];
+        this->Sensors->setHeading(reset.values[2]);
+        this->rebase = true;
+    }
+    this->filter.reset(this->pose.x, this->pose.y, this->pose.heading);
+    this->publish();
 }
 
 /**
  * Sets the position of the robot
  * Sets the heading and rotation of the V5 Inertial Sensor
+ * The next update measures from the new heading instead of seeing it as a turn
  * 
  * @param   x       the new robot x position in inches
  * @param   y       the new robot y position in inches
  * @param   heading the new robot heading in degrees
  */
 void odom::setPosition(float x, float y, float heading){
-    this->robotPosition.at(0) = x;
-    this->robotPosition.at(1) = y;
-    this->robotPosition.at(2) = heading;
-    this->Inertial->setHeading(heading, vex::rotationUnits::deg);
-    this->Inertial->setRotation(heading, vex::rotationUnits::deg);
+    this->requestReset(x, y, heading, PoseReset::x | PoseReset::y | PoseReset::heading);
 }
 
 /**
@@ -236,7 +368,7 @@ void odom::setPosition(float x, float y, float heading){
  * @param   x   new robot x position in inches
  */
 void odom::setX(float x){
-    this->robotPosition.at(0) = x;
+    this->requestReset(x, 0, 0, PoseReset::x);
 }
 
 /**
@@ -245,17 +377,16 @@ void odom::setX(float x){
  * @param   y   new robot y position in inches
  */
 void odom::setY(float y){
-    this->robotPosition.at(1) = y;
+    this->requestReset(0, y, 0, PoseReset::y);
 }
 
 /**
  * Sets the heading of the robot
  * Sets the heading and rotation of the V5 Inertial Sensor
+ * The next update measures from the new heading instead of seeing it as a turn
  * 
  * @param   heading the new heading of the robot in degrees
  */
 void odom::setHeading(float heading){
-    this->robotPosition.at(2) = heading;
-    this->Inertial->setHeading(heading, vex::rotationUnits::deg);
-    this->Inertial->setRotation(heading, vex::rotationUnits::deg);
+    this->requestReset(0, 0, heading, PoseReset::heading);
 }
\ No newline at end of file
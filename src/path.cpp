@@ -0,0 +1,120 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       path.cpp                                                  */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Polyline path source code                                 */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <math.h>
+#include "path.h"
+
+/**
+ * Constructor method
+ * Makes an empty path, the first point added is where it starts
+ */
+Path::Path(){
+}
+
+/**
+ * Constructor method
+ *
+ * @param   x   x coordinate the path starts at, in inches
+ * @param   y   y coordinate the path starts at, in inches
+ */
+Path::Path(float x, float y){
+    this->addPoint(x, y);
+}
+
+/**
+ * Removes every point
+ */
+void Path::clear(){
+    this->points.clear();
+}
+
+/**
+ * Adds a straight segment from the end of the path to (x, y)
+ * Points on top of the last one are skipped so no segment has zero length
+ *
+ * @param   x   x coordinate, in inches
+ * @param   y   y coordinate, in inches
+ */
+void Path::addPoint(float x, float y){
+    PathPoint point;
+    point.x = x;
+    point.y = y;
+    if(!this->points.empty()){
+        const PathPoint& last = this->points.back();
+        float length = hypotf(x - last.x, y - last.y);
+        if(length < 1e-3f) return;
+        point.distance = last.distance + length;
+    }
+    this->points.push_back(point);
+}
+
+/**
+ * Adds a cubic Bezier curve from the end of the path to (x, y)
+ * The curve leaves toward the first control point and arrives from the second
+ *
+ * @param   x1          first control point x, in inches
+ * @param   y1          first control point y, in inches
+ * @param   x2          second control point x, in inches
+ * @param   y2          second control point y, in inches
+ * @param   x           end x, in inches
+ * @param   y           end y, in inches
+ * @param   spacing     the rough length of each segment the curve is split into, in inches
+ */
+void Path::addBezier(float x1, float y1, float x2, float y2, float x, float y, float spacing){
+    if(this->points.empty()){
+        this->addPoint(x, y);
+        return;
+    }
+    float x0 = this->points.back().x;
+    float y0 = this->points.back().y;
+
+    // the control polygon is never shorter than the curve
+    float polygon = hypotf(x1 - x0, y1 - y0) + hypotf(x2 - x1, y2 - y1) + hypotf(x - x2, y - y2);
+    int segments = (int)ceilf(polygon / spacing);
+    if(segments < 1) segments = 1;
+
+    for(int i = 1; i <= segments; i++){
+        float t = (float)i / segments;
+        float u = 1 - t;
+        float a = u * u * u;
+        float b = 3 * u * u * t;
+        float c = 3 * u * t * t;
+        float d = t * t * t;
+        this->addPoint(a * x0 + b * x1 + c * x2 + d * x, a * y0 + b * y1 + c * y2 + d * y);
+    }
+}
+
+/**
+ * @param   index   the point, 0 is the start
+ *
+ * @return  the point
+ */
+PathPoint Path::getPoint(int index){
+    return this->points[index];
+}
+
+/**
+ * @return  the last point of the path
+ */
+PathPoint Path::getEnd(){
+    return this->points.back();
+}
+
+/**
+ * @return  the length of the path, in inches
+ */
+float Path::getLength(){
+    return this->points.empty() ? 0 : this->points.back().distance;
+}
+
+/**
+ * @return  the number of points
+ */
+int Path::size(){
+    return (int)this->points.size();
+}
@@ -0,0 +1,239 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       profile.cpp                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Trapezoidal and S-curve motion profile source code        */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include <math.h>
+#include "profile.h"
+
+/**
+ * Constructor method
+ * Starts as a step to 0 until generate is called
+ */
+MotionProfile::MotionProfile(){
+    this->points.push_back(ProfilePoint());
+}
+
+/**
+ * Private function that gives the time to change velocity, starting and ending with no acceleration
+ * The ramp is symmetric, so the distance covered doing it is the mean of the two velocities times the time
+ *
+ * @param   velocity        the change in velocity
+ * @param   maxAcceleration the acceleration limit
+ * @param   maxJerk         the jerk limit, 0 for none
+ *
+ * @return  the time, in seconds
+ */
+float MotionProfile::accelerationTime(float velocity, float maxAcceleration, float maxJerk){
+    if(maxJerk <= 0) return velocity / maxAcceleration;
+    if(velocity * maxJerk >= maxAcceleration * maxAcceleration) return velocity / maxAcceleration + maxAcceleration / maxJerk;
+    return 2 * sqrtf(velocity / maxJerk);
+}
+
+/**
+ * Private function that gives the distance to speed up from a start velocity to a peak and stop again
+ *
+ * @param   startVelocity   the velocity at the start, no more than the peak
+ * @param   peakVelocity    the velocity in between
+ * @param   maxAcceleration the acceleration limit
+ * @param   maxJerk         the jerk limit, 0 for none
+ *
+ * @return  the distance, without any cruise
+ */
+float MotionProfile::rampDistance(float startVelocity, float peakVelocity, float maxAcceleration, float maxJerk){
+    return (startVelocity + peakVelocity) / 2 * this->accelerationTime(peakVelocity - startVelocity, maxAcceleration, maxJerk)
+        + peakVelocity / 2 * this->accelerationTime(peakVelocity, maxAcceleration, maxJerk);
+}
+
+/**
+ * Private function that splits one velocity change into its three constant jerk phases
+ * Jerk up, constant acceleration, jerk down. A trapezoid has zero length jerk phases and
+ * jumps straight to the acceleration.
+ *
+ * @param   change          the size of the velocity change
+ * @param   direction       1 to speed up, -1 to slow down
+ * @param   maxAcceleration the acceleration limit
+ * @param   maxJerk         the jerk limit, 0 for none
+ * @param   phases          where to store the three phases
+ */
+void MotionProfile::buildRamp(float change, float direction, float maxAcceleration, float maxJerk, Phase* phases){
+    float acceleration = maxAcceleration;
+    float jerkTime = 0;
+    float constantTime = change / maxAcceleration;
+    if(maxJerk <= 0) maxJerk = 0;
+    else if(change * maxJerk >= maxAcceleration * maxAcceleration){
+        jerkTime = maxAcceleration / maxJerk;
+        constantTime = change / maxAcceleration - jerkTime;
+    }
+    else{
+        acceleration = sqrtf(change * maxJerk);
+        jerkTime = acceleration / maxJerk;
+        constantTime = 0;
+    }
+
+    phases[0] = {jerkTime, 0, direction * maxJerk};
+    phases[1] = {constantTime, direction * acceleration, 0};
+    phases[2] = {jerkTime, direction * acceleration, -direction * maxJerk};
+}
+
+/**
+ * Precomputes the profile for one move, starting and ending at rest
+ * If the move is too short to reach maxVelocity the peak velocity is lowered until it fits.
+ * The table holds at most 4096 points, very long moves are sampled more coarsely.
+ *
+ * @param   distance        the distance to move, negative to move backwards
+ * @param   maxVelocity     the velocity limit, per second, 0 for a step to the target
+ * @param   maxAcceleration the acceleration limit, per second squared
+ * @param   maxJerk         the jerk limit, per second cubed, 0 for a trapezoid
+ * @param   period          the time between points in the table, in seconds
+ */
+void MotionProfile::generate(float distance, float maxVelocity, float maxAcceleration, float maxJerk, float period){
+    this->generate(distance, maxVelocity, maxAcceleration, maxJerk, period, 0);
+}
+
+/**
+ * Precomputes the profile for one move, starting at a velocity and ending at rest
+ * The profile is seven constant jerk phases: speed up from the start velocity to the peak,
+ * cruise, then slow to a stop. A start velocity against the move starts from rest, one
+ * faster than maxVelocity or too fast to stop within the distance is lowered until it fits,
+ * so the first setpoint may be slower than the robot. If the move is too short to reach
+ * maxVelocity the peak velocity is lowered until it fits.
+ * The table holds at most 4096 points, very long moves are sampled more coarsely.
+ *
+ * @param   distance        the distance to move, negative to move backwards
+ * @param   maxVelocity     the velocity limit, per second, 0 for a step to the target
+ * @param   maxAcceleration the acceleration limit, per second squared
+ * @param   maxJerk         the jerk limit, per second cubed, 0 for a trapezoid
+ * @param   period          the time between points in the table, in seconds
+ * @param   startVelocity   the velocity the robot is already moving at, per second, in the same direction as distance
+ */
+void MotionProfile::generate(float distance, float maxVelocity, float maxAcceleration, float maxJerk, float period, float startVelocity){
+    this->points.clear();
+    this->duration = 0;
+    this->period = period;
+
+    float sign = distance < 0 ? -1 : 1;
+    distance = fabsf(distance);
+    if(maxVelocity <= 0 || maxAcceleration <= 0 || distance == 0 || period <= 0){
+        ProfilePoint target;
+        target.position = sign * distance;
+        this->points.push_back(target);
+        return;
+    }
+
+    float start = sign * startVelocity;
+    if(start < 0) start = 0;
+    if(start > maxVelocity) start = maxVelocity;
+    if(this->rampDistance(start, start, maxAcceleration, maxJerk) > distance){
+        float low = 0;
+        float high = start;
+        for(int i = 0; i < 40; i++){
+            float middle = (low + high) / 2;
+            if(this->rampDistance(middle, middle, maxAcceleration, maxJerk) > distance) high = middle;
+            else low = middle;
+        }
+        start = low;
+    }
+
+    float peakVelocity = maxVelocity;
+    if(this->rampDistance(start, peakVelocity, maxAcceleration, maxJerk) > distance){
+        float low = start;
+        float high = maxVelocity;
+        for(int i = 0; i < 40; i++){
+            float middle = (low + high) / 2;
+            if(this->rampDistance(start, middle, maxAcceleration, maxJerk) > distance) high = middle;
+            else low = middle;
+        }
+        peakVelocity = low;
+    }
+    float cruiseTime = 0;
+    if(peakVelocity > 0) cruiseTime = (distance - this->rampDistance(start, peakVelocity, maxAcceleration, maxJerk)) / peakVelocity;
+    if(cruiseTime < 0) cruiseTime = 0;
+
+    Phase phases[7];
+    this->buildRamp(peakVelocity - start, 1, maxAcceleration, maxJerk, phases);
+    phases[3] = {cruiseTime, 0, 0};
+    this->buildRamp(peakVelocity, -1, maxAcceleration, maxJerk, phases + 4);
+    for(int i = 0; i < 7; i++) this->duration += phases[i].duration;
+
+    if(this->duration / this->period > maxPoints - 1) this->period = this->duration / (maxPoints - 1);
+    int count = (int)ceilf(this->duration / this->period) + 1;
+    if(count > maxPoints) count = maxPoints;
+    this->points.resize(count);
+
+    // walk the phases once, carrying the position and velocity at the start of each
+    int phase = 0;
+    float phaseStart = 0;
+    float position = 0;
+    float velocity = start;
+    for(int i = 0; i < count - 1; i++){
+        float time = i * this->period;
+        while(phase < 6 && time > phaseStart + phases[phase].duration){
+            float d = phases[phase].duration;
+            position += velocity * d + phases[phase].acceleration * d * d / 2 + phases[phase].jerk * d * d * d / 6;
+            velocity += phases[phase].acceleration * d + phases[phase].jerk * d * d / 2;
+            phaseStart += d;
+            phase++;
+        }
+
+        float t = time - phaseStart;
+        if(t > phases[phase].duration) t = phases[phase].duration;
+        float acceleration = phases[phase].acceleration + phases[phase].jerk * t;
+        this->points[i].position = sign * (position + velocity * t + phases[phase].acceleration * t * t / 2 + phases[phase].jerk * t * t * t / 6);
+        this->points[i].velocity = sign * (velocity + phases[phase].acceleration * t + phases[phase].jerk * t * t / 2);
+        this->points[i].acceleration = sign * acceleration;
+    }
+    this->points[count - 1].position = sign * distance;
+    this->points[count - 1].velocity = 0;
+    this->points[count - 1].acceleration = 0;
+}
+
+/**
+ * Looks up the setpoint at a time into the motion
+ * Interpolates between table points, so the loop period does not have to match the table
+ *
+ * @param   time    seconds since the motion started
+ *
+ * @return  the setpoint, the final one once the profile is over
+ */
+ProfilePoint MotionProfile::sample(float time){
+    int last = (int)this->points.size() - 1;
+    if(time <= 0 || last == 0) return this->points[time <= 0 ? 0 : last];
+
+    float index = time / this->period;
+    int i = (int)index;
+    if(i >= last) return this->points[last];
+
+    float fraction = index - i;
+    const ProfilePoint& a = this->points[i];
+    const ProfilePoint& b = this->points[i + 1];
+    ProfilePoint point;
+    point.position = a.position + (b.position - a.position) * fraction;
+    point.velocity = a.velocity + (b.velocity - a.velocity) * fraction;
+    point.acceleration = a.acceleration + (b.acceleration - a.acceleration) * fraction;
+    return point;
+}
+
+/**
+ * @return  the length of the profile, in seconds
+ */
+float MotionProfile::getDuration(){
+    return this->duration;
+}
+
+/**
+ * @return  the distance the profile moves
+ */
+float MotionProfile::getDistance(){
+    return this->points.back().position;
+}
+
+/**
+ * @return  the number of points in the table
+ */
+int MotionProfile::size(){
+    return (int)this->points.size();
+}
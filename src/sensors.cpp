@@ -0,0 +1,170 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       sensors.cpp                                               */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Sensor Hub Class source code                              */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include "sensors.h"
+
+/**
+ * Constructor method
+ * The drive motors and inertial sensor are always sampled, tracking wheels are added with the setters
+ *
+ * @param   Left        a pointer to the left motor group of the drivetrain
+ * @param   Right       a pointer to the right motor group of the drivetrain
+ * @param   Inertial    a pointer to the v5 inertial sensor
+ */
+SensorHub::SensorHub(vex::motor_group* Left, vex::motor_group* Right, vex::inertial* Inertial) : stale(true), samples(0), requests(0){
+    this->Left = Left;
+    this->Right = Right;
+    this->Inertial = Inertial;
+}
+
+/**
+ * Sets the vertical tracking wheel to a v5 rotation sensor
+ *
+ * @param   verticalRotation    a pointer to the vertical rotation sensor
+ */
+void SensorHub::setVerticalTracking(vex::rotation* verticalRotation){
+    this->verticalRotation = verticalRotation;
+    this->verticalEncoder = 0;
+}
+
+/**
+ * Sets the vertical tracking wheel to a 3-wire optical shaft encoder
+ *
+ * @param   verticalEncoder     a pointer to the vertical encoder
+ */
+void SensorHub::setVerticalTracking(vex::encoder* verticalEncoder){
+    this->verticalEncoder = verticalEncoder;
+    this->verticalRotation = 0;
+}
+
+/**
+ * Sets the horizontal tracking wheel to a v5 rotation sensor
+ *
+ * @param   horizontalRotation  a pointer to the horizontal rotation sensor
+ */
+void SensorHub::setHorizontalTracking(vex::rotation* horizontalRotation){
+    this->horizontalRotation = horizontalRotation;
+    this->horizontalEncoder = 0;
+}
+
+/**
+ * Sets the horizontal tracking wheel to a 3-wire optical shaft encoder
+ *
+ * @param   horizontalEncoder   a pointer to the horizontal encoder
+ */
+void SensorHub::setHorizontalTracking(vex::encoder* horizontalEncoder){
+    this->horizontalEncoder = horizontalEncoder;
+    this->horizontalRotation = 0;
+}
+
+/**
+ * @return  true if a vertical tracking wheel is configured
+ */
+bool SensorHub::hasVerticalTracking(){
+    return this->verticalRotation || this->verticalEncoder;
+}
+
+/**
+ * @return  true if a horizontal tracking wheel is configured
+ */
+bool SensorHub::hasHorizontalTracking(){
+    return this->horizontalRotation || this->horizontalEncoder;
+}
+
+/**
+ * Sets how old a frame may be and still be shared
+ *
+ * @param   milliseconds    the maximum frame age handed out by getFrame, in milliseconds
+ */
+void SensorHub::setMaxAge(uint32_t milliseconds){
+    this->maxAgeMicroseconds = milliseconds * 1000;
+}
+
+/**
+ * Reads every configured device once and publishes the frame
+ * Heading is derived from the inertial rotation instead of being queried separately.
+ * This never yields, so on the cooperative V5 scheduler only one task is ever inside it,
+ * which is what seqlock.h asks of tasks that share a writer.
+ *
+ * @return  the new frame
+ */
+SensorFrame SensorHub::sample(){
+    SensorFrame frame;
+
+    if(this->verticalRotation) frame.vertical = this->verticalRotation->position(vex::rotationUnits::deg);
+    else if(this->verticalEncoder) frame.vertical = this->verticalEncoder->position(vex::rotationUnits::deg);
+    if(this->horizontalRotation) frame.horizontal = this->horizontalRotation->position(vex::rotationUnits::deg);
+    else if(this->horizontalEncoder) frame.horizontal = this->horizontalEncoder->position(vex::rotationUnits::deg);
+
+    frame.left = this->Left->position(vex::rotationUnits::deg);
+    frame.right = this->Right->position(vex::rotationUnits::deg);
+
+    frame.rotation = this->Inertial->rotation(vex::rotationUnits::deg);
+    frame.gyroRate = this->Inertial->gyroRate(vex::axisType::zaxis, vex::velocityUnits::dps);
+    frame.heading = fmodf(frame.rotation, 360);
+    if(frame.heading < 0) frame.heading += 360;
+
+    frame.timestamp = vex::timer::systemHighResolution();
+
+    this->latest.write(frame);
+    this->stale = false;
+    this->samples.fetch_add(1, std::memory_order_relaxed);
+    return frame;
+}
+
+/**
+ * Gives the current tick's frame to a consumer
+ * The first consumer in a tick samples the devices, later ones share that frame
+ *
+ * @return  a frame no older than the max age
+ */
+SensorFrame SensorHub::getFrame(){
+    this->requests.fetch_add(1, std::memory_order_relaxed);
+
+    SensorFrame frame;
+    this->latest.read(frame);
+    if(this->stale || vex::timer::systemHighResolution() - frame.timestamp >= this->maxAgeMicroseconds) return this->sample();
+    return frame;
+}
+
+/**
+ * Copies out the latest frame without sampling
+ *
+ * @param   frame   where to copy the frame
+ *
+ * @return  the sequence number of the frame
+ */
+uint32_t SensorHub::readFrame(SensorFrame &frame){
+    return this->latest.read(frame);
+}
+
+/**
+ * Sets the heading and rotation of the inertial sensor
+ * The next getFrame will sample fresh readings
+ *
+ * @param   heading the new heading, in degrees
+ */
+void SensorHub::setHeading(float heading){
+    this->Inertial->setHeading(heading, vex::rotationUnits::deg);
+    this->Inertial->setRotation(heading, vex::rotationUnits::deg);
+    this->stale = true;
+}
+
+/**
+ * @return  the number of times the devices have been sampled
+ */
+uint32_t SensorHub::getSampleCount(){
+    return this->samples.load(std::memory_order_relaxed);
+}
+
+/**
+ * @return  the number of frames handed out by getFrame
+ */
+uint32_t SensorHub::getRequestCount(){
+    return this->requests.load(std::memory_order_relaxed);
+}
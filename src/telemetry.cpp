@@ -0,0 +1,206 @@
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*    Module:       telemetry.cpp                                             */
+/*    Author:       UNLVEXU                                                   */
+/*    Created:      10/17/2026                                                */
+/*    Description:  Lock free telemetry rings drained to the SD card source   */
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+#include "telemetry.h"
+#include "logformat.h"
+
+static_assert(Telemetry::encodedBytes >= Telemetry::bufferRecords * logformat::maxRecordBytes + logformat::maxBlockOverhead,
+    "the encode buffer must hold a full block");
+
+/**
+ * Constructor method
+ *
+ * @param   SDcard      a pointer to the brain's SD card
+ * @param   fileName    the file to write, replaced when telemetry starts
+ */
+Telemetry::Telemetry(vex::brain::sdcard* SDcard, const char* fileName) : producers(0), isRunning(false){
+    this->SDcard = SDcard;
+    this->fileName = fileName;
+}
+
+/**
+ * Gives a producer its own ring, call once per pushing task during setup
+ *
+ * @return  the ring to push to, or 0 if every ring is taken
+ */
+TelemetryRing* Telemetry::addProducer(){
+    int count = this->producers.load(std::memory_order_relaxed);
+    if(count >= maxProducers) return 0;
+
+    this->rings[count] = new TelemetryRing(count);
+    this->reportedDrops[count] = 0;
+    this->producers.store(count + 1, std::memory_order_release);
+    return this->rings[count];
+}
+
+/**
+ * Sets how often the telemetry task drains the rings
+ * A ring holds 256 records, so a producer pushing every 10 ms fills it in 2.5 s.
+ *
+ * @param   milliseconds    the time between drains
+ */
+void Telemetry::setFlushPeriod(uint32_t milliseconds){
+    this->flushPeriod = milliseconds;
+}
+
+/**
+ * Sets the longest a partly filled buffer waits before it is written anyway
+ * Shorter loses less of a log cut off without stop, longer makes fewer and larger appends.
+ *
+ * @param   milliseconds    the time between writes of a buffer that has not filled
+ */
+void Telemetry::setWritePeriod(uint32_t milliseconds){
+    this->writePeriod = milliseconds;
+}
+
+/**
+ * Private function that moves records from every ring into the buffer, writing it each time it fills
+ *
+ * @return  the number of records moved
+ */
+uint32_t Telemetry::drain(){
+    int count = this->producers.load(std::memory_order_acquire);
+    uint32_t moved = 0;
+    for(int i = 0; i < count; i++){
+        uint32_t popped;
+        do{
+            popped = this->rings[i]->pop(this->buffer + this->buffered, bufferRecords - this->buffered);
+            this->buffered += popped;
+            moved += popped;
+            if(this->buffered == bufferRecords) this->flush();
+        } while(popped > 0);
+    }
+    this->reportDrops();
+    return moved;
+}
+
+/**
+ * Private function that adds a status record for every ring that dropped records since the last report
+ * A gap in a ring's sequence numbers only shows drops that a later record follows, the status
+ * records also cover the drops at the end of a log.
+ */
+void Telemetry::reportDrops(){
+    int count = this->producers.load(std::memory_order_acquire);
+    for(int i = 0; i < count; i++){
+        uint32_t dropped = this->rings[i]->getDropped();
+        if(dropped == this->reportedDrops[i]) continue;
+        this->reportedDrops[i] = dropped;
+
+        TelemetryRecord &record = this->buffer[this->buffered++];
+        record.timestamp = (uint32_t)vex::timer::systemHighResolution();
+        record.source = statusSource;
+        record.channel = (uint8_t)TelemetryChannel::status;
+        record.sequence = this->statusSequence++;
+        record.values[0] = i;
+        record.values[1] = dropped;
+        record.values[2] = this->lost;
+        if(this->buffered == bufferRecords) this->flush();
+    }
+}
+
+/**
+ * Private function that encodes the buffer as one log block and appends it to the file
+ * Records that cannot be written, with no card inserted or a full card, are counted as lost.
+ */
+void Telemetry::flush(){
+    if(this->buffered == 0) return;
+
+    int32_t bytes = logformat::encodeBlock(this->buffer, this->buffered, this->encoded);
+    int32_t saved = 0;
+    if(this->SDcard->isInserted()) saved = this->SDcard->appendfile(this->fileName, this->encoded, bytes);
+    if(saved == bytes){
+        this->written += this->buffered;
+        this->writtenBytes += bytes;
+        this->writes++;
+    }
+    else this->lost += this->buffered;
+    this->buffered = 0;
+    this->lastWrite = vex::timer::system();
+}
+
+/**
+ * Private function that drains the rings every flush period until telemetry stops, the body of the telemetry task
+ * Writes the buffer once it is writePeriod old even if it has not filled.
+ *
+ * @param   arg the telemetry
+ */
+int Telemetry::run(void* arg){
+    Telemetry* telemetry = (Telemetry*)arg;
+    while(telemetry->isRunning.load()){
+        telemetry->drain();
+        if(vex::timer::system() - telemetry->lastWrite >= telemetry->writePeriod) telemetry->flush();
+        vex::this_thread::sleep_for(telemetry->flushPeriod);
+    }
+    return 0;
+}
+
+/**
+ * Replaces the file with a new log header and starts the telemetry task at low priority
+ */
+void Telemetry::start(){
+    if(this->isRunning.load()) return;
+    if(this->SDcard->isInserted()){
+        int32_t bytes = logformat::writeHeader(this->encoded, encodedBytes);
+        this->writtenBytes = this->SDcard->savefile(this->fileName, this->encoded, bytes);
+    }
+
+    this->lastWrite = vex::timer::system();
+    this->isRunning.store(true);
+    this->task = vex::thread(Telemetry::run, this);
+    this->task.setPriority(vex::thread::threadPriorityLow);
+}
+
+/**
+ * Stops the telemetry task and writes whatever is left in the rings
+ */
+void Telemetry::stop(){
+    if(!this->isRunning.load()) return;
+    this->isRunning.store(false);
+    this->task.join();
+
+    this->drain();
+    this->flush();
+}
+
+/**
+ * Getter for the records dropped by every ring because it was full
+ */
+uint32_t Telemetry::getDropped(){
+    int count = this->producers.load(std::memory_order_acquire);
+    uint32_t dropped = 0;
+    for(int i = 0; i < count; i++) dropped += this->rings[i]->getDropped();
+    return dropped;
+}
+
+/**
+ * Getter for the records written to the card
+ */
+uint32_t Telemetry::getWritten(){
+    return this->written;
+}
+
+/**
+ * Getter for the size of the file written so far, in bytes
+ */
+uint32_t Telemetry::getWrittenBytes(){
+    return this->writtenBytes;
+}
+
+/**
+ * Getter for the number of appends to the file
+ */
+uint32_t Telemetry::getWrites(){
+    return this->writes;
+}
+
+/**
+ * Getter for the records that were drained but could not be written
+ */
+uint32_t Telemetry::getLost(){
+    return this->lost;
+}